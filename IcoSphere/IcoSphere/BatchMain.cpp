@@ -0,0 +1,388 @@
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ * Oct 19, 2026 |---| added a vertex cache report of the surface mesh
+ * Oct 19, 2026 |---| added a software rendered image of the surface
+ * Oct 19, 2026 |---| added a check of the finest LOD selection
+ *
+ * ****************************************************************************/
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Main for headless batch builds. Generates one world per seed and reports
+// throughput. Usage:
+//
+//   IcoSphereBatch size firstSeed worldCount [threadCount [outputDirectory]]
+//
+// When an output directory is given each world is written, as soon as it is
+// finished, to outputDirectory/world_<seed>.f32 as raw F32 elevations in cell
+// ID order.
+//
+//   IcoSphereBatch -mesh size [cacheSize]
+//
+// reports instead how well the surface mesh of a map of the given size uses a
+// vertex cache of cacheSize vertices, 16 by default, before and after
+// VertexCacheOptimizer reorders it.
+//
+//   IcoSphereBatch -render size outputPath [imageSize]
+//
+// generates a map of the given size, draws its surface with the software
+// rasterizer into an imageSize x imageSize image, 1024 by default, and writes
+// the image to outputPath as a PAM file. No GPU or window is needed.
+//
+//   IcoSphereBatch -lod size
+//
+// checks the IcosMapLod hierarchy of a generated map of the given size: the
+// tiles selected with no screen error allowed must draw the surface with no
+// geometric error and no more triangles than the full surface mesh. Returns 1
+// if they do not.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "IcosMap.h"
+#include "IcosMapBatch.h"
+#include "IcosMapLod.h"
+#include "IcosMapMesh.h"
+#include "IcosMapView.h"
+#include "RenderContext.h"
+#include "SoftwareRasterizer.h"
+#include "VertexCacheOptimizer.h"
+
+IcosMap g_Map;
+
+////////////////////////////////////////////////////////////////////////////////
+//! Writes each finished world to its own file.
+////////////////////////////////////////////////////////////////////////////////
+class FileSink : public IcosMapBatch::Sink
+{
+public:
+
+  FileSink(
+      const char * directory
+      ) throw ()
+      : Directory(directory)
+      , FailureCount(0u)
+  {
+  }
+
+  void
+  Consume(
+      U64 seed,
+      const F32 elevation[],
+      U16 cellCount
+      ) throw ()
+  {
+    if (nullptr == Directory) return;
+
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/world_%llu.f32", Directory, (unsigned long long)seed);
+
+    FILE * file = fopen(path, "wb");
+    if ((nullptr == file) || (fwrite(elevation, sizeof(F32), cellCount, file) != cellCount))
+    {
+      FailureCount++;
+    }
+    if (nullptr != file) fclose(file);
+  }
+
+  const char * Directory;
+
+  U32 FailureCount;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//! Prints the cache statistics of one ordering of the mesh.
+////////////////////////////////////////////////////////////////////////////////
+static
+void
+PrintCacheStatistics(
+    const char * order,
+    const std::vector<U32> & index,
+    U32 cacheSize
+    ) throw ()
+{
+  VertexCacheOptimizer::Statistics stats = VertexCacheOptimizer::Measure(&index[0], index.size(), cacheSize);
+  printf("%-15s ACMR %.3f  ATVR %.3f\n", order, stats.Acmr, stats.Atvr);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Reports the vertex cache use of the surface mesh in cell order and with
+//! its triangles reordered. Renumbering the vertices afterwards changes only
+//! the order they are fetched in, not the cache use.
+////////////////////////////////////////////////////////////////////////////////
+static
+int
+ReportMesh(
+    U8 size,
+    U32 cacheSize
+    ) throw ()
+{
+  IcosMapMesh * mesh = new IcosMapMesh();
+
+  try
+  {
+    g_Map.Initialize(size);
+    mesh->Initialize(g_Map.GetTopology());
+  }
+  catch (Exception::Type)
+  {
+    delete mesh;
+    printf("Error: invalid size or arguments.\n");
+    return 1;
+  }
+
+  U32 vertexCount = mesh->GetVertexCount();
+  std::vector<U32> index(3u * mesh->GetTriangleCount());
+  mesh->GetTriangles(0u, mesh->GetCellCount(), &index[0]);
+
+  printf("cells           %u\n", g_Map.GetCellCount());
+  printf("vertices        %u\n", vertexCount);
+  printf("triangles       %u\n", mesh->GetTriangleCount());
+  printf("cache size      %u\n", cacheSize);
+  PrintCacheStatistics("cell order", index, cacheSize);
+
+  VertexCacheOptimizer optimizer;
+  optimizer.OptimizeTriangles(&index[0], index.size(), vertexCount, cacheSize);
+  PrintCacheStatistics("optimized", index, cacheSize);
+
+  delete mesh;
+
+  return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Draws the surface of a map, generated with the default seed, looking down
+//! the Z axis with an orthographic projection, and writes the image.
+////////////////////////////////////////////////////////////////////////////////
+static
+int
+RenderMap(
+    U8 size,
+    const char * path,
+    U32 imageSize
+    ) throw ()
+{
+  static const F32 IDENTITY[16] = { 1.0f, 0.0f, 0.0f, 0.0f,
+                                    0.0f, 1.0f, 0.0f, 0.0f,
+                                    0.0f, 0.0f, 1.0f, 0.0f,
+                                    0.0f, 0.0f, 0.0f, 1.0f };
+
+  IcosMapView * view = new IcosMapView();
+  RenderContext context;
+
+  try
+  {
+    g_Map.Initialize(size);
+    g_Map.GenerateElevations();
+    view->SetMap(g_Map);
+
+    context.UseSoftwareRasterizer(imageSize, imageSize);
+    context.Reset();
+    context.SetTransform(IDENTITY);
+    view->SetView(IDENTITY);
+    view->Render(context);
+    context.Finish();
+
+    context.GetSoftwareRasterizer()->WriteImage(path);
+  }
+  catch (Exception::Type)
+  {
+    delete view;
+    printf("Error: invalid arguments, or the image could not be written.\n");
+    return 1;
+  }
+
+  const SoftwareRasterizer::Statistics & stats = context.GetSoftwareRasterizer()->GetStatistics();
+  printf("cells           %u\n", g_Map.GetCellCount());
+  printf("triangles       %u\n", view->GetVisibleTriangleCount());
+  printf("image           %u x %u\n", imageSize, imageSize);
+  printf("threads         %u\n", stats.ThreadCount);
+  printf("setup           %.3f s\n", stats.SetupSeconds);
+  printf("raster          %.3f s\n", stats.RasterSeconds);
+
+  delete view;
+
+  return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Prints the triangle count and largest geometric error of a selection.
+////////////////////////////////////////////////////////////////////////////////
+static
+void
+MeasureSelection(
+    const IcosMapLod & lod,
+    const IcosMapLod::Tile tile[],
+    U16 tileCount,
+    const char * name,
+    U32 & triangleCount,
+    F32 & error
+    ) throw (Exception::Type)
+{
+  U16 index[3u * IcosMapLod::MAX_TILE_TRIANGLE_COUNT];
+
+  triangleCount = 0u;
+  error = 0.0f;
+  for (U16 t = 0; t < tileCount; ++t)
+  {
+    triangleCount += lod.GetTileTriangles(tile[t], index);
+    F32 tileError = lod.GetGeometricError(tile[t]);
+    if (error < tileError) error = tileError;
+  }
+
+  printf("%-15s %u tiles, %u triangles, error %g\n", name, tileCount, triangleCount, error);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Checks that the finest selection of the LOD hierarchy is the surface mesh
+//! itself: no geometric error and no more triangles than 20 * size^2.
+////////////////////////////////////////////////////////////////////////////////
+static
+int
+ReportLod(
+    U8 size
+    ) throw ()
+{
+  IcosMapLod * lod = new IcosMapLod();
+  std::vector<IcosMapLod::Tile> tile(IcosMapLod::MAX_TILE_COUNT);
+  U32 meshTriangleCount = 20u * size * size;
+  U32 coarsestTriangleCount = 0u, finestTriangleCount = 0u;
+  F32 coarsestError = 0.0f, finestError = 0.0f;
+
+  try
+  {
+    g_Map.Initialize(size);
+    g_Map.GenerateElevations();
+    lod->Initialize(g_Map);
+
+    IcosMapLod::Camera camera = { { 0.0f, 0.0f, 3.0f }, 1.0f, 1024.0f };
+
+    printf("cells           %u\n", g_Map.GetCellCount());
+    printf("levels          %u\n", lod->GetLevelCount());
+    printf("mesh            %u triangles\n", meshTriangleCount);
+
+    U16 tileCount = lod->Select(camera, 1.0e30f, &tile[0], IcosMapLod::MAX_TILE_COUNT);
+    MeasureSelection(*lod, &tile[0], tileCount, "coarsest", coarsestTriangleCount, coarsestError);
+
+    tileCount = lod->Select(camera, 0.0f, &tile[0], IcosMapLod::MAX_TILE_COUNT);
+    MeasureSelection(*lod, &tile[0], tileCount, "finest", finestTriangleCount, finestError);
+  }
+  catch (Exception::Type)
+  {
+    delete lod;
+    printf("Error: invalid size or arguments.\n");
+    return 1;
+  }
+
+  delete lod;
+
+  if ((0.0f != finestError) || (meshTriangleCount < finestTriangleCount) || (finestTriangleCount < coarsestTriangleCount))
+  {
+    printf("Error: the finest selection is not the surface mesh.\n");
+    return 1;
+  }
+
+  return 0;
+}
+
+int main(int argc, char** argv)
+{
+  if ((2 < argc) && (0 == strcmp(argv[1], "-mesh")))
+  {
+    U32 cacheSize = (3 < argc) ? (U32)strtoul(argv[3], nullptr, 10) : VertexCacheOptimizer::DEFAULT_CACHE_SIZE;
+    return ReportMesh((U8)atoi(argv[2]), (0u < cacheSize) ? cacheSize : VertexCacheOptimizer::DEFAULT_CACHE_SIZE);
+  }
+
+  if ((3 < argc) && (0 == strcmp(argv[1], "-render")))
+  {
+    U32 imageSize = (4 < argc) ? (U32)strtoul(argv[4], nullptr, 10) : 1024u;
+    return RenderMap((U8)atoi(argv[2]), argv[3], imageSize);
+  }
+
+  if ((2 < argc) && (0 == strcmp(argv[1], "-lod")))
+  {
+    return ReportLod((U8)atoi(argv[2]));
+  }
+
+  U32 worldCount = (3 < argc) ? (U32)strtoul(argv[3], nullptr, 10) : 0u;
+
+  if (0u == worldCount)
+  {
+    printf("Usage: %s size firstSeed worldCount [threadCount [outputDirectory]]\n", argv[0]);
+    printf("       %s -mesh size [cacheSize]\n", argv[0]);
+    printf("       %s -render size outputPath [imageSize]\n", argv[0]);
+    printf("       %s -lod size\n", argv[0]);
+    return 1;
+  }
+
+  U8 size = (U8)atoi(argv[1]);
+  U64 firstSeed = strtoull(argv[2], nullptr, 10);
+  U32 threadCount = (4 < argc) ? (U32)strtoul(argv[4], nullptr, 10) : 0u;
+  FileSink sink((5 < argc) ? argv[5] : nullptr);
+
+  std::vector<U64> seed(worldCount);
+  for (U32 i = 0; i < worldCount; ++i)
+  {
+    seed[i] = firstSeed + i;
+  }
+
+  try
+  {
+    g_Map.Initialize(size);
+
+    IcosMapBatch batch(g_Map);
+    batch.Generate(&seed[0], worldCount, threadCount, sink);
+
+    const IcosMapBatch::Statistics & stats = batch.GetStatistics();
+    printf("worlds          %u\n", stats.WorldCount);
+    printf("threads         %u\n", stats.ThreadCount);
+    printf("cells           %u\n", g_Map.GetCellCount());
+    printf("elapsed         %.3f s\n", stats.ElapsedSeconds);
+    printf("worlds/second   %.2f\n", stats.WorldsPerSecond);
+    printf("displacement    %.3f s\n", stats.DisplacementSeconds);
+    printf("normalize       %.3f s\n", stats.NormalizeSeconds);
+    printf("output          %.3f s\n", stats.SinkSeconds);
+  }
+  catch (Exception::Type)
+  {
+    printf("Error: invalid size or arguments.\n");
+    return 1;
+  }
+
+  if (0u < sink.FailureCount)
+  {
+    printf("Error: %u worlds could not be written.\n", sink.FailureCount);
+    return 1;
+  }
+
+  return 0;
+}
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
@@ -0,0 +1,415 @@
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ *
+ * ****************************************************************************/
+
+
+#include <string.h>
+
+#include "Compression.h"
+
+//! Shortest match worth encoding.
+static const U32 MIN_MATCH = 4u;
+//! Farthest back a match may start.
+static const U32 MAX_OFFSET = 65535u;
+//! log2 of the number of entries in the match finder's hash table.
+static const U32 HASH_BITS = 12u;
+
+////////////////////////////////////////////////////////////////////////////////
+//! Reads four bytes without alignment requirements.
+////////////////////////////////////////////////////////////////////////////////
+static inline U32 Read32(const U8 * p) throw ()
+{
+  U32 value;
+  memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Hashes four bytes to a match finder table index.
+////////////////////////////////////////////////////////////////////////////////
+static inline U32 Hash(U32 value) throw ()
+{
+  return (value * 2654435761u) >> (32u - HASH_BITS);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Writes the part of a length that does not fit in its token nibble.
+////////////////////////////////////////////////////////////////////////////////
+static inline U8 * WriteLength(U32 length, U8 * out) throw ()
+{
+  for (; 255u <= length; length -= 255u) *out++ = 255u;
+  *out++ = (U8)length;
+  return out;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Reads the part of a length that did not fit in its token nibble.
+////////////////////////////////////////////////////////////////////////////////
+static inline U32 ReadLength(const U8 *& in, const U8 * end) throw (Exception::Type)
+{
+  U32 length = 0u;
+  U8 byte;
+
+  do
+  {
+    if (in == end) throw (Exception::FORMAT_ERROR);
+    byte = *in++;
+    length += byte;
+  } while (255u == byte);
+
+  return length;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Writes one sequence: a token, literalCount literals and, unless matchLength
+//! is zero, a match.
+////////////////////////////////////////////////////////////////////////////////
+static U8 * WriteSequence(
+    const U8 * literal,
+    U32 literalCount,
+    U32 offset,
+    U32 matchLength,
+    U8 * out
+    ) throw ()
+{
+  U32 matchCode = (0u < matchLength) ? matchLength - MIN_MATCH : 0u;
+  U8 * token = out++;
+
+  *token = (U8)(((literalCount < 15u) ? literalCount : 15u) << 4);
+  if (15u <= literalCount) out = WriteLength(literalCount - 15u, out);
+
+  memcpy(out, literal, literalCount);
+  out += literalCount;
+
+  if (0u < matchLength)
+  {
+    *token |= (U8)((matchCode < 15u) ? matchCode : 15u);
+    *out++ = (U8)(offset & 0xFFu);
+    *out++ = (U8)(offset >> 8);
+    if (15u <= matchCode) out = WriteLength(matchCode - 15u, out);
+  }
+
+  return out;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See Compression.h)
+////////////////////////////////////////////////////////////////////////////////
+U32
+Compression::GetCompressBound(
+    U32 sourceBytes
+    ) throw ()
+{
+  return sourceBytes + sourceBytes / 255u + 16u;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See Compression.h)
+//
+// The stream is a series of sequences, each a token byte whose high nibble is
+// the literal count and low nibble the match length less MIN_MATCH, either
+// extended by further bytes when 15, followed by the literals and a two byte
+// offset back into the output. The last sequence has literals only.
+////////////////////////////////////////////////////////////////////////////////
+U32
+Compression::Compress(
+    const U8 source[],
+    U32 sourceBytes,
+    U8 destination[]
+    ) throw ()
+{
+  // Positions are stored plus one so zero marks an empty entry.
+  U32 table[1u << HASH_BITS];
+  memset(table, 0, sizeof(table));
+
+  U8 * out = destination;
+  U32 anchor = 0u;
+  U32 position = 0u;
+
+  while (position + MIN_MATCH <= sourceBytes)
+  {
+    U32 value = Read32(&source[position]);
+    U32 & entry = table[Hash(value)];
+    U32 candidate = entry;
+    entry = position + 1u;
+
+    if ((0u == candidate)
+        || (MAX_OFFSET < position - (candidate - 1u))
+        || (Read32(&source[candidate - 1u]) != value))
+    {
+      ++position;
+      continue;
+    }
+
+    U32 match = candidate - 1u;
+    U32 length = MIN_MATCH;
+    while ((position + length < sourceBytes) && (source[match + length] == source[position + length])) ++length;
+
+    out = WriteSequence(&source[anchor], position - anchor, position - match, length, out);
+    position += length;
+    anchor = position;
+  }
+
+  out = WriteSequence(&source[anchor], sourceBytes - anchor, 0u, 0u, out);
+
+  return (U32)(out - destination);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See Compression.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+Compression::Decompress(
+    const U8 source[],
+    U32 sourceBytes,
+    U8 destination[],
+    U32 destinationBytes
+    ) throw (Exception::Type)
+{
+  const U8 * in = source;
+  const U8 * inEnd = source + sourceBytes;
+  U8 * out = destination;
+  U8 * outEnd = destination + destinationBytes;
+
+  for (;;)
+  {
+    if (in == inEnd) throw (Exception::FORMAT_ERROR);
+    U8 token = *in++;
+
+    U32 literalCount = token >> 4;
+    if (15u == literalCount) literalCount += ReadLength(in, inEnd);
+
+    if (((U32)(inEnd - in) < literalCount) || ((U32)(outEnd - out) < literalCount))
+    {
+      throw (Exception::FORMAT_ERROR);
+    }
+
+    memcpy(out, in, literalCount);
+    in += literalCount;
+    out += literalCount;
+
+    // Only the last sequence ends after its literals.
+    if (in == inEnd) break;
+
+    if (inEnd - in < 2) throw (Exception::FORMAT_ERROR);
+    U32 offset = (U32)in[0] | ((U32)in[1] << 8);
+    in += 2;
+
+    U32 length = token & 0x0Fu;
+    if (15u == length) length += ReadLength(in, inEnd);
+    length += MIN_MATCH;
+
+    if ((0u == offset) || ((U32)(out - destination) < offset) || ((U32)(outEnd - out) < length))
+    {
+      throw (Exception::FORMAT_ERROR);
+    }
+
+    // Byte by byte, as the match may overlap its own output.
+    const U8 * match = out - offset;
+    for (U32 i = 0; i < length; ++i) out[i] = match[i];
+    out += length;
+  }
+
+  if (out != outEnd)
+  {
+    throw (Exception::FORMAT_ERROR);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See Compression.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+Compression::Shuffle(
+    const void * source,
+    U32 valueCount,
+    U32 valueBytes,
+    U8 destination[]
+    ) throw ()
+{
+  const U8 * in = (const U8 *)source;
+
+  for (U32 b = 0; b < valueBytes; ++b)
+  {
+    U8 * plane = &destination[b * valueCount];
+
+    for (U32 i = 0; i < valueCount; ++i)
+    {
+      plane[i] = in[i * valueBytes + b];
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See Compression.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+Compression::Unshuffle(
+    const U8 source[],
+    U32 valueCount,
+    U32 valueBytes,
+    void * destination
+    ) throw ()
+{
+  U8 * out = (U8 *)destination;
+
+  for (U32 b = 0; b < valueBytes; ++b)
+  {
+    const U8 * plane = &source[b * valueCount];
+
+    for (U32 i = 0; i < valueCount; ++i)
+    {
+      out[i * valueBytes + b] = plane[i];
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See Compression.h)
+////////////////////////////////////////////////////////////////////////////////
+U32
+Compression::GetPackBound(
+    U32 valueCount
+    ) throw ()
+{
+  return 1u + valueCount * sizeof(U16);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the zig-zag code of the difference of two U16 values, taken modulo
+//! 2^16 so that every difference fits in 16 bits.
+////////////////////////////////////////////////////////////////////////////////
+static inline U16 EncodeDelta(U16 value, U16 previous) throw ()
+{
+  S16 delta = (S16)(U16)(value - previous);
+  return (U16)(((U16)delta << 1) ^ (U16)(delta >> 15));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Reverses EncodeDelta().
+////////////////////////////////////////////////////////////////////////////////
+static inline U16 DecodeDelta(U16 code, U16 previous) throw ()
+{
+  U16 delta = (U16)((code >> 1) ^ (U16)(0u - (code & 1u)));
+  return (U16)(previous + delta);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See Compression.h)
+//
+// The first byte is the bit width; the codes follow least significant bit
+// first.
+////////////////////////////////////////////////////////////////////////////////
+U32
+Compression::PackDeltas(
+    const U16 values[],
+    U32 valueCount,
+    U32 stride,
+    U8 destination[]
+    ) throw ()
+{
+  U16 largest = 0u;
+
+  for (U32 i = 0; i < valueCount; ++i)
+  {
+    U16 code = EncodeDelta(values[i], (stride <= i) ? values[i - stride] : 0u);
+    if (largest < code) largest = code;
+  }
+
+  U32 width = 0u;
+  while ((width < 16u) && ((U32)largest >> width) != 0u) ++width;
+
+  destination[0] = (U8)width;
+  U8 * out = &destination[1];
+  U32 packedBytes = (valueCount * width + 7u) / 8u;
+  memset(out, 0, packedBytes);
+
+  U32 bit = 0u;
+
+  for (U32 i = 0; (0u < width) && (i < valueCount); ++i)
+  {
+    U32 code = EncodeDelta(values[i], (stride <= i) ? values[i - stride] : 0u);
+
+    // A code spans at most three bytes.
+    U32 index = bit >> 3;
+    U32 part = code << (bit & 7u);
+    out[index] |= (U8)part;
+    if (index + 1u < packedBytes) out[index + 1u] |= (U8)(part >> 8);
+    if (index + 2u < packedBytes) out[index + 2u] |= (U8)(part >> 16);
+
+    bit += width;
+  }
+
+  return 1u + packedBytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See Compression.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+Compression::UnpackDeltas(
+    const U8 source[],
+    U32 sourceBytes,
+    U16 values[],
+    U32 valueCount,
+    U32 stride
+    ) throw (Exception::Type)
+{
+  if (sourceBytes < 1u) throw (Exception::FORMAT_ERROR);
+
+  U32 width = source[0];
+  const U8 * in = &source[1];
+  U32 packedBytes = (valueCount * width + 7u) / 8u;
+
+  if ((16u < width) || (sourceBytes - 1u < packedBytes))
+  {
+    throw (Exception::FORMAT_ERROR);
+  }
+
+  U32 mask = (1u << width) - 1u;
+  U32 bit = 0u;
+
+  for (U32 i = 0; i < valueCount; ++i)
+  {
+    U32 code = 0u;
+
+    if (0u < width)
+    {
+      U32 index = bit >> 3;
+      U32 window = in[index];
+      if (index + 1u < packedBytes) window |= (U32)in[index + 1u] << 8;
+      if (index + 2u < packedBytes) window |= (U32)in[index + 2u] << 16;
+      code = (window >> (bit & 7u)) & mask;
+    }
+
+    values[i] = DecodeDelta((U16)code, (stride <= i) ? values[i - stride] : 0u);
+    bit += width;
+  }
+}
+
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
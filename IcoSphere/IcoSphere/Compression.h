@@ -0,0 +1,138 @@
+#pragma once
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ *
+ * ****************************************************************************/
+
+
+#include "Exception.h"
+#include "NativeTypes.h"
+
+////////////////////////////////////////////////////////////////////////////////
+//! Lightweight, dependency free codecs for column data: a byte oriented LZ
+//! compressor, byte shuffling of fixed size values, and delta plus bit packing
+//! of U16 values.
+////////////////////////////////////////////////////////////////////////////////
+namespace Compression
+{
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the largest number of bytes Compress() can produce from
+  //! sourceBytes bytes.
+  //////////////////////////////////////////////////////////////////////////////
+  U32
+  GetCompressBound(
+      U32 sourceBytes
+      ) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! LZ compresses source[] into destination[], which must hold
+  //! GetCompressBound(sourceBytes) bytes, and returns the compressed size.
+  //////////////////////////////////////////////////////////////////////////////
+  U32
+  Compress(
+      const U8 source[],
+      U32 sourceBytes,
+      U8 destination[]
+      ) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Decompresses the output of Compress() into exactly destinationBytes bytes.
+  //! Throws FORMAT_ERROR if source[] is malformed or does not decompress to
+  //! exactly destinationBytes bytes.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  Decompress(
+      const U8 source[],
+      U32 sourceBytes,
+      U8 destination[],
+      U32 destinationBytes
+      ) throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Splits valueCount values of valueBytes bytes each into valueBytes planes,
+  //! the first holding byte 0 of every value, and so on. Slowly changing
+  //! values, such as the exponents of floats, then form long runs for
+  //! Compress().
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  Shuffle(
+      const void * source,
+      U32 valueCount,
+      U32 valueBytes,
+      U8 destination[]
+      ) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Reverses Shuffle().
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  Unshuffle(
+      const U8 source[],
+      U32 valueCount,
+      U32 valueBytes,
+      void * destination
+      ) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the largest number of bytes PackDeltas() can produce from
+  //! valueCount values.
+  //////////////////////////////////////////////////////////////////////////////
+  U32
+  GetPackBound(
+      U32 valueCount
+      ) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Replaces each value by its difference from the value stride places
+  //! before it (the first stride values by their difference from zero), zig-zag
+  //! encodes the differences and packs them with the fewest bits that hold the
+  //! largest. Returns the packed size; destination[] must hold
+  //! GetPackBound(valueCount) bytes.
+  //////////////////////////////////////////////////////////////////////////////
+  U32
+  PackDeltas(
+      const U16 values[],
+      U32 valueCount,
+      U32 stride,
+      U8 destination[]
+      ) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Reverses PackDeltas(). Throws FORMAT_ERROR if source[] is too short for
+  //! valueCount values.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  UnpackDeltas(
+      const U8 source[],
+      U32 sourceBytes,
+      U16 values[],
+      U32 valueCount,
+      U32 stride
+      ) throw (Exception::Type);
+}
+
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
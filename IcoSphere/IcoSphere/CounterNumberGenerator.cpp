@@ -0,0 +1,196 @@
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ *
+ * ****************************************************************************/
+
+#include "CounterNumberGenerator.hpp"
+
+#define PHILOX_M0         0xD2511F53UL
+#define PHILOX_M1         0xCD9E8D57UL
+#define PHILOX_W0         0x9E3779B9UL
+#define PHILOX_W1         0xBB67AE85UL
+#define PHILOX_ROUNDS     10
+
+static const U64 INVALID_BLOCK = ~(U64)0;
+
+CounterNumberGenerator::CounterNumberGenerator(
+    ) throw ()
+  : mStream(0)
+  , mPosition(0)
+  , mBlockIndex(INVALID_BLOCK)
+{
+  Seed(0);
+}
+
+CounterNumberGenerator::CounterNumberGenerator(
+    U64 seed,
+    U64 stream
+    ) throw ()
+  : mStream(stream)
+  , mPosition(0)
+  , mBlockIndex(INVALID_BLOCK)
+{
+  Seed(seed);
+}
+
+CounterNumberGenerator::CounterNumberGenerator(
+    const CounterNumberGenerator & other
+    ) throw ()
+  : mStream(other.mStream)
+  , mPosition(other.mPosition)
+  , mBlockIndex(other.mBlockIndex)
+{
+  mKey[0] = other.mKey[0];
+  mKey[1] = other.mKey[1];
+
+  for (U32 i = 0; i < BLOCK_SIZE; ++i) mBlock[i] = other.mBlock[i];
+}
+
+CounterNumberGenerator::~CounterNumberGenerator(
+    ) throw ()
+{
+}
+
+CounterNumberGenerator &
+CounterNumberGenerator::operator=(
+    const CounterNumberGenerator & other
+    ) throw ()
+{
+  mKey[0] = other.mKey[0];
+  mKey[1] = other.mKey[1];
+  mStream = other.mStream;
+  mPosition = other.mPosition;
+  mBlockIndex = other.mBlockIndex;
+
+  for (U32 i = 0; i < BLOCK_SIZE; ++i) mBlock[i] = other.mBlock[i];
+
+  return *this;
+}
+
+void
+CounterNumberGenerator::Seed(
+    U64 seed
+    ) throw ()
+{
+  mKey[0] = (U32)(seed & 0xFFFFFFFFUL);
+  mKey[1] = (U32)(seed >> 32);
+  mPosition = 0;
+  mBlockIndex = INVALID_BLOCK;
+}
+
+CounterNumberGenerator
+CounterNumberGenerator::Split(
+    U64 stream
+    ) const throw ()
+{
+  CounterNumberGenerator result(*this);
+
+  result.mStream = stream;
+  result.mPosition = 0;
+  result.mBlockIndex = INVALID_BLOCK;
+
+  return result;
+}
+
+void
+CounterNumberGenerator::Skip(
+    U64 count
+    ) throw ()
+{
+  mPosition += count;
+}
+
+U64
+CounterNumberGenerator::GetPosition(
+    ) const throw ()
+{
+  return mPosition;
+}
+
+U32
+CounterNumberGenerator::GenerateU32(
+    ) throw ()
+{
+  U64 block = mPosition / BLOCK_SIZE;
+
+  if (block != mBlockIndex)
+  {
+    GenerateBlock(block);
+  }
+
+  return mBlock[mPosition++ % BLOCK_SIZE];
+}
+
+F64
+CounterNumberGenerator::GenerateF64(
+    ) throw ()
+{
+  return ((F64)GenerateU32() * (1.0/4294967295.0));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Encrypts the 128 bit counter (block, stream) with the seed as key and keeps
+//! the result in mBlock.
+////////////////////////////////////////////////////////////////////////////////
+void
+CounterNumberGenerator::GenerateBlock(
+    U64 block
+    ) throw ()
+{
+  U32 c0 = (U32)(block & 0xFFFFFFFFUL);
+  U32 c1 = (U32)(block >> 32);
+  U32 c2 = (U32)(mStream & 0xFFFFFFFFUL);
+  U32 c3 = (U32)(mStream >> 32);
+  U32 k0 = mKey[0];
+  U32 k1 = mKey[1];
+
+  for (U32 round = 0; round < PHILOX_ROUNDS; ++round)
+  {
+    U64 product0 = (U64)PHILOX_M0 * c0;
+    U64 product1 = (U64)PHILOX_M1 * c2;
+
+    U32 hi0 = (U32)(product0 >> 32);
+    U32 lo0 = (U32)product0;
+    U32 hi1 = (U32)(product1 >> 32);
+    U32 lo1 = (U32)product1;
+
+    c0 = hi1 ^ c1 ^ k0;
+    c1 = lo1;
+    c2 = hi0 ^ c3 ^ k1;
+    c3 = lo0;
+
+    k0 += (U32)PHILOX_W0;
+    k1 += (U32)PHILOX_W1;
+  }
+
+  mBlock[0] = c0;
+  mBlock[1] = c1;
+  mBlock[2] = c2;
+  mBlock[3] = c3;
+  mBlockIndex = block;
+}
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
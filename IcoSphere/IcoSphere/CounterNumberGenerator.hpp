@@ -0,0 +1,164 @@
+#pragma once
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ *
+ * ****************************************************************************/
+
+
+#include "NativeTypes.h"
+
+/* *****************************************************************************
+ *
+ * A counter-based PRNG (Philox4x32-10, Salmon et al., "Parallel Random Numbers:
+ * As Easy as 1, 2, 3"). The N-th number of a stream is a pure function of the
+ * seed, the stream, and N, so a generator can jump to any position in constant
+ * time. Work item i of a parallel stage can therefore draw exactly the numbers
+ * it would have drawn serially by skipping to its first position, independent
+ * of how many threads share the work.
+ *
+ * ****************************************************************************/
+class CounterNumberGenerator
+{
+public:
+
+  /* ***************************************************************************
+   *
+   * Seed zero, stream zero, position zero.
+   *
+   * **************************************************************************/
+  CounterNumberGenerator(
+      ) throw ();
+
+  /* ***************************************************************************
+   *
+   * Position zero of the given seed and stream.
+   *
+   * **************************************************************************/
+  CounterNumberGenerator(
+      U64 seed,
+      U64 stream
+      ) throw ();
+
+  /* ***************************************************************************
+   *
+   * **************************************************************************/
+  CounterNumberGenerator(
+      const CounterNumberGenerator & other
+      ) throw ();
+
+  /* ***************************************************************************
+   *
+   * **************************************************************************/
+  ~CounterNumberGenerator(
+      ) throw ();
+
+  /* ***************************************************************************
+   *
+   * **************************************************************************/
+  CounterNumberGenerator &
+  operator=(
+      const CounterNumberGenerator & other
+      ) throw ();
+
+  /* ***************************************************************************
+   *
+   * Selects the seed and rewinds to position zero of the current stream.
+   *
+   * **************************************************************************/
+  void Seed(
+      U64 seed
+      ) throw ();
+
+  /* ***************************************************************************
+   *
+   * Returns a generator with the same seed positioned at the start of the given
+   * stream. Streams never overlap, so each one can be handed to an independent
+   * subsystem or thread.
+   *
+   * **************************************************************************/
+  CounterNumberGenerator
+  Split(
+      U64 stream
+      ) const throw ();
+
+  /* ***************************************************************************
+   *
+   * Advances the position by count numbers without generating them.
+   *
+   * **************************************************************************/
+  void
+  Skip(
+      U64 count
+      ) throw ();
+
+  /* ***************************************************************************
+   *
+   * Returns the number of values generated or skipped since position zero.
+   *
+   * **************************************************************************/
+  U64
+  GetPosition(
+      ) const throw ();
+
+  /* ***************************************************************************
+   *
+   * **************************************************************************/
+  U32
+  GenerateU32(
+      ) throw ();
+
+  /* ***************************************************************************
+   *
+   * **************************************************************************/
+  F64
+  GenerateF64(
+      ) throw ();
+
+private:
+
+  static const U32 BLOCK_SIZE = 4;
+
+  void
+  GenerateBlock(
+      U64 block
+      ) throw ();
+
+private:
+
+  U32 mKey[2];
+
+  U64 mStream;
+
+  U64 mPosition;
+
+  //! Index of the block held in mBlock, or ~0 if mBlock is not valid.
+  U64 mBlockIndex;
+
+  U32 mBlock[BLOCK_SIZE];
+
+};
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
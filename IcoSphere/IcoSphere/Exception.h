@@ -19,6 +19,7 @@
  * Chagne Date        Description
  * -----------------------------------------------------------------------------
  * Aug 19, 2019 |---| added license notice
+ * Oct 19, 2026 |---| added file I/O and file format errors
  *
  * ****************************************************************************/
 
@@ -29,6 +30,10 @@ namespace Exception
   static const Type PARAMETER_ERROR = 100;
 
   static const Type INITIALIZATION_ERROR = 101;
+
+  static const Type IO_ERROR = 102;
+
+  static const Type FORMAT_ERROR = 103;
 }
 
 /* *****************************************************************************
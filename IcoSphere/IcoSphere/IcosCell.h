@@ -19,6 +19,7 @@
  * Chagne Date        Description
  * -----------------------------------------------------------------------------
  * Aug 19, 2019 |---| added license notice
+ * Oct 19, 2026 |---| moved elevation into a per-map column
  *
  * ****************************************************************************/
 
@@ -132,7 +133,6 @@ public:
   U16 AdjacentID[MAX_ADJACENT_CELLS];
   Coordinates::UnitSphereDegrees Coordinates;
   Vector Normal;
-  F32 Elevation;
 };
 
 /* *****************************************************************************
@@ -18,6 +18,7 @@
  * Chagne Date        Description
  * -----------------------------------------------------------------------------
  * Aug 19, 2019 |---| added license notice
+ * Oct 19, 2026 |---| read elevation from the map's elevation column
  *
  * ****************************************************************************/
 
@@ -84,9 +85,9 @@ IcosCellView::SetMapCell(
   else if (cellID % 7 == 6) SurfaceVertexArray.Color = ColorRGBA(0.0f, 1.0f, 0.5f);
 #endif
 
-  SurfaceVertexArray.Color = ColorRGBA(Cell->Elevation, Cell->Elevation, Cell->Elevation);
+  F32 cellElevation = Map->GetElevation(Cell->GetID());
 
-  F32 cellElevation = Cell->Elevation;
+  SurfaceVertexArray.Color = ColorRGBA(cellElevation, cellElevation, cellElevation);
 
   Vector cellVertex = Cell->GetCoordinates();
   cellVertex = cellVertex * (0.8F + cellElevation / 5.0F);
@@ -97,9 +98,9 @@ IcosCellView::SetMapCell(
   for (U8 i = 0; i <= Cell->GetAdjacentCount(); ++i)
   {
     Vector firstAdjacentVertex = (Map->GetCell(Cell->GetAdjacentID(i))).GetCoordinates();
-    F32 firstAdjacentElevation = (Map->GetCell(Cell->GetAdjacentID(i))).Elevation;
+    F32 firstAdjacentElevation = Map->GetElevation(Cell->GetAdjacentID(i));
     Vector secondAdjacentVertex = (Map->GetCell(Cell->GetAdjacentID(i+1))).GetCoordinates();
-    F32 secondAdjacentElevation = (Map->GetCell(Cell->GetAdjacentID(i+1))).Elevation;
+    F32 secondAdjacentElevation = Map->GetElevation(Cell->GetAdjacentID(i+1));
 
     Vector sum = (cellVertex + firstAdjacentVertex + secondAdjacentVertex);
     sum.Normalize();
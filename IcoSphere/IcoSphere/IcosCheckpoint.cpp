@@ -0,0 +1,429 @@
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ *
+ * ****************************************************************************/
+
+
+#include <chrono>
+#include <condition_variable>
+#include <errno.h>
+#include <fcntl.h>
+#include <mutex>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "IcosCheckpoint.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static const char MAGIC[8] = "ICOSCKP";
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the 32-bit FNV-1a hash of bytes[].
+////////////////////////////////////////////////////////////////////////////////
+static
+U32
+Checksum(
+    const U8 bytes[],
+    U64 count
+    ) throw ()
+{
+  U32 hash = 2166136261u;
+
+  for (U64 i = 0; i < count; ++i)
+  {
+    hash = (hash ^ bytes[i]) * 16777619u;
+  }
+
+  return hash;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Writes image[] to path + ".tmp", flushes it to disk and renames it over
+//! path. Returns false on any failure, leaving path as it was.
+////////////////////////////////////////////////////////////////////////////////
+static
+bool
+WriteFile(
+    const std::string & path,
+    const std::vector<U8> & image
+    ) throw ()
+{
+  std::string temporaryPath = path + ".tmp";
+
+  int descriptor = open(temporaryPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (descriptor < 0)
+  {
+    return false;
+  }
+
+  const U8 * bytes = &image[0];
+  U64 count = image.size();
+  bool isWritten = true;
+
+  while (isWritten && (0u < count))
+  {
+    ssize_t written = write(descriptor, bytes, count);
+
+    if (0 <= written)
+    {
+      bytes += written;
+      count -= written;
+    }
+    else
+    {
+      isWritten = (EINTR == errno);
+    }
+  }
+
+  isWritten = isWritten && (0 == fsync(descriptor));
+  isWritten = (0 == close(descriptor)) && isWritten;
+  isWritten = isWritten && (0 == rename(temporaryPath.c_str(), path.c_str()));
+
+  if (! isWritten)
+  {
+    unlink(temporaryPath.c_str());
+  }
+
+  return isWritten;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! State shared between a Writer and its background thread.
+////////////////////////////////////////////////////////////////////////////////
+struct IcosCheckpoint::Writer::Worker
+{
+  std::string Path;
+  std::thread Thread;
+  //! Guards everything below.
+  std::mutex Lock;
+  std::condition_variable Changed;
+  //! Checkpoint image waiting to be written.
+  std::vector<U8> Pending;
+  bool IsPending;
+  bool IsWriting;
+  bool IsFailed;
+  bool IsStopping;
+  F64 StallSeconds;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosCheckpoint.h)
+////////////////////////////////////////////////////////////////////////////////
+IcosCheckpoint::Writer::Writer(
+    ) throw ()
+    : Background(nullptr)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosCheckpoint.h)
+////////////////////////////////////////////////////////////////////////////////
+IcosCheckpoint::Writer::~Writer(
+    ) throw ()
+{
+  Close();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosCheckpoint.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosCheckpoint::Writer::Open(
+    const char * path
+    ) throw (Exception::Type)
+{
+  if (nullptr == path)
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  Close();
+
+  Background = new Worker;
+  Background->Path = path;
+  Background->IsPending = false;
+  Background->IsWriting = false;
+  Background->IsFailed = false;
+  Background->IsStopping = false;
+  Background->StallSeconds = 0.0;
+  Background->Thread = std::thread(Work, Background);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosCheckpoint.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosCheckpoint::Writer::Save(
+    U64 step,
+    const IcosMap & map,
+    const NumberGenerator generator[],
+    U32 generatorCount
+    ) throw (Exception::Type)
+{
+  if (! ((nullptr != Background) && (0u < map.GetCellCount())
+      && ((nullptr != generator) || (0u == generatorCount))
+      && (generatorCount <= MAX_GENERATOR_COUNT)))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  U32 cellCount = map.GetCellCount();
+  U64 elevationBytes = (U64)cellCount * sizeof(F32);
+  U64 generatorBytes = (U64)NumberGenerator::STATE_WORD_COUNT * sizeof(U32);
+
+  Header header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.Magic, MAGIC, sizeof(header.Magic));
+  header.Version = VERSION;
+  header.ByteOrderMark = BYTE_ORDER_MARK;
+  header.Step = step;
+  header.Size = map.GetTopology().GetSize();
+  header.GeneratorCount = (U16)generatorCount;
+  header.CellCount = cellCount;
+  header.PayloadBytes = elevationBytes + generatorCount * generatorBytes;
+
+  // The copy is taken here, on the calling thread, so the pipeline may carry
+  // on changing the map as soon as Save() returns.
+  std::vector<U8> image(sizeof(header) + header.PayloadBytes);
+  U8 * payload = &image[sizeof(header)];
+
+  memcpy(payload, map.GetElevations(), elevationBytes);
+
+  for (U32 i = 0; i < generatorCount; ++i)
+  {
+    generator[i].SaveState((U32 *)(payload + elevationBytes + i * generatorBytes));
+  }
+
+  header.Checksum = Checksum(payload, header.PayloadBytes);
+  memcpy(&image[0], &header, sizeof(header));
+
+  std::unique_lock<std::mutex> lock(Background->Lock);
+
+  if (Background->IsPending || Background->IsWriting)
+  {
+    Clock::time_point start = Clock::now();
+    while (Background->IsPending || Background->IsWriting) Background->Changed.wait(lock);
+    Background->StallSeconds += std::chrono::duration<F64>(Clock::now() - start).count();
+  }
+
+  if (Background->IsFailed)
+  {
+    Background->IsFailed = false;
+    throw (Exception::IO_ERROR);
+  }
+
+  Background->Pending.swap(image);
+  Background->IsPending = true;
+  Background->Changed.notify_all();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosCheckpoint.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosCheckpoint::Writer::Wait(
+    ) throw (Exception::Type)
+{
+  if (nullptr == Background)
+  {
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(Background->Lock);
+
+  while (Background->IsPending || Background->IsWriting) Background->Changed.wait(lock);
+
+  if (Background->IsFailed)
+  {
+    Background->IsFailed = false;
+    throw (Exception::IO_ERROR);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosCheckpoint.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosCheckpoint::Writer::Close(
+    ) throw ()
+{
+  if (nullptr == Background)
+  {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(Background->Lock);
+    Background->IsStopping = true;
+    Background->Changed.notify_all();
+  }
+
+  Background->Thread.join();
+
+  delete Background;
+  Background = nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosCheckpoint.h)
+////////////////////////////////////////////////////////////////////////////////
+F64
+IcosCheckpoint::Writer::GetStallSeconds(
+    ) const throw ()
+{
+  if (nullptr == Background)
+  {
+    return 0.0;
+  }
+
+  std::lock_guard<std::mutex> lock(Background->Lock);
+  return Background->StallSeconds;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Writes each checkpoint handed over by Save() until the writer is closed
+//! and nothing is left pending.
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosCheckpoint::Writer::Work(
+    Worker * worker
+    ) throw ()
+{
+  std::vector<U8> image;
+  std::unique_lock<std::mutex> lock(worker->Lock);
+
+  for (;;)
+  {
+    while (! (worker->IsPending || worker->IsStopping)) worker->Changed.wait(lock);
+
+    if (! worker->IsPending)
+    {
+      break;
+    }
+
+    image.swap(worker->Pending);
+    worker->IsPending = false;
+    worker->IsWriting = true;
+
+    lock.unlock();
+    bool isWritten = WriteFile(worker->Path, image);
+    lock.lock();
+
+    worker->IsWriting = false;
+    worker->IsFailed = worker->IsFailed || ! isWritten;
+    worker->Changed.notify_all();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosCheckpoint.h)
+////////////////////////////////////////////////////////////////////////////////
+U64
+IcosCheckpoint::Load(
+    const char * path,
+    IcosMap & map,
+    NumberGenerator generator[],
+    U32 generatorCount
+    ) throw (Exception::Type)
+{
+  if (! ((nullptr != path) && ((nullptr != generator) || (0u == generatorCount))))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  FILE * file = fopen(path, "rb");
+  if (nullptr == file)
+  {
+    throw (Exception::IO_ERROR);
+  }
+
+  Header header;
+  std::vector<U8> payload;
+
+  bool isRead = (fread(&header, sizeof(header), 1u, file) == 1u);
+
+  bool isValid = isRead
+      && (0 == memcmp(header.Magic, MAGIC, sizeof(header.Magic)))
+      && (VERSION == header.Version)
+      && (BYTE_ORDER_MARK == header.ByteOrderMark)
+      && (IcosMap::MIN_SIZE <= header.Size) && (header.Size <= IcosMap::MAX_SIZE)
+      && (10u * header.Size * header.Size + 2u == header.CellCount)
+      && (header.GeneratorCount <= MAX_GENERATOR_COUNT)
+      && (header.PayloadBytes == (U64)header.CellCount * sizeof(F32)
+          + (U64)header.GeneratorCount * NumberGenerator::STATE_WORD_COUNT * sizeof(U32));
+
+  if (isValid)
+  {
+    payload.resize(header.PayloadBytes);
+    isValid = (fread(&payload[0], 1u, payload.size(), file) == payload.size())
+        && (header.Checksum == Checksum(&payload[0], payload.size()));
+  }
+
+  fclose(file);
+
+  if (! isValid)
+  {
+    throw (Exception::FORMAT_ERROR);
+  }
+
+  if (header.GeneratorCount != generatorCount)
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  U64 elevationBytes = (U64)header.CellCount * sizeof(F32);
+  const U32 * state = (const U32 *)&payload[elevationBytes];
+
+  // Validate every generator state on a scratch generator before changing
+  // anything, so a bad state leaves the generators and the map untouched.
+  for (U32 i = 0; i < generatorCount; ++i)
+  {
+    NumberGenerator scratch;
+    scratch.LoadState(state + i * NumberGenerator::STATE_WORD_COUNT);
+  }
+
+  if (map.GetCellCount() != header.CellCount)
+  {
+    map.Initialize((U8)header.Size);
+  }
+
+  for (U32 i = 0; i < generatorCount; ++i)
+  {
+    generator[i].LoadState(state + i * NumberGenerator::STATE_WORD_COUNT);
+  }
+
+  memcpy(map.GetElevations(), &payload[0], elevationBytes);
+  map.MarkDirty(0u, map.GetCellCount());
+
+  return header.Step;
+}
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
@@ -0,0 +1,177 @@
+#pragma once
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ *
+ * ****************************************************************************/
+
+
+#include "Exception.h"
+#include "IcosMap.h"
+#include "NativeTypes.h"
+#include "NumberGenerator.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+//! Checkpoint and restart of a generation pipeline. A checkpoint holds
+//! everything a deterministic pipeline needs to carry on: the step it was
+//! taken at, every field of the map and the complete state of each of the
+//! pipeline's number generators:
+//!
+//!   Header       fixed size
+//!   Elevation    F32[CellCount]
+//!   Generators   U32[NumberGenerator::STATE_WORD_COUNT] per generator
+//!
+//! A pipeline restarted from the checkpoint of step n and run on produces bit
+//! for bit what the uninterrupted run produces, provided it draws from the
+//! same generators in the same order.
+//!
+//! Save() copies the state, which takes a few microseconds, and returns; a
+//! background thread writes the copy to path + ".tmp", flushes it to disk
+//! and renames it over path. The file at path is therefore always a complete
+//! checkpoint, the last one written, however the process ends. Values are
+//! stored in the byte order of the writing machine, which the header records.
+////////////////////////////////////////////////////////////////////////////////
+class IcosCheckpoint
+{
+public:
+
+  static const U32 VERSION = 1u;
+  static const U32 BYTE_ORDER_MARK = 0x01020304u;
+  static const U32 MAX_GENERATOR_COUNT = 16u;
+
+  struct Header
+  {
+    char Magic[8];
+    U32 Version;
+    U32 ByteOrderMark;
+    U64 Step;
+    U16 Size;
+    U16 GeneratorCount;
+    U32 CellCount;
+    U64 PayloadBytes;     //!< Bytes of the elevations and generator states.
+    U32 Checksum;         //!< FNV-1a of those bytes.
+    U32 Reserved;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Writes checkpoints to one path in the background. Save() and Wait() may
+  //! be called by one thread at a time.
+  //////////////////////////////////////////////////////////////////////////////
+  class Writer
+  {
+  public:
+
+    Writer(
+        ) throw ();
+
+    //////////////////////////////////////////////////////////////////////////
+    //! Waits for the checkpoint being written, if any.
+    //////////////////////////////////////////////////////////////////////////
+    ~Writer(
+        ) throw ();
+
+    //////////////////////////////////////////////////////////////////////////
+    //! Sets the path checkpoints are written to and starts the background
+    //! thread.
+    //////////////////////////////////////////////////////////////////////////
+    void
+    Open(
+        const char * path
+        ) throw (Exception::Type);
+
+    //////////////////////////////////////////////////////////////////////////
+    //! Copies the state of step and hands it to the background thread. If the
+    //! previous checkpoint is still being written, waits for it first. Throws
+    //! IO_ERROR if writing the previous checkpoint failed.
+    //////////////////////////////////////////////////////////////////////////
+    void
+    Save(
+        U64 step,
+        const IcosMap & map,
+        const NumberGenerator generator[],
+        U32 generatorCount
+        ) throw (Exception::Type);
+
+    //////////////////////////////////////////////////////////////////////////
+    //! Waits until every saved checkpoint is on disk. Throws IO_ERROR if
+    //! writing one failed.
+    //////////////////////////////////////////////////////////////////////////
+    void
+    Wait(
+        ) throw (Exception::Type);
+
+    //////////////////////////////////////////////////////////////////////////
+    //! Waits for the last checkpoint and stops the background thread.
+    //////////////////////////////////////////////////////////////////////////
+    void
+    Close(
+        ) throw ();
+
+    //////////////////////////////////////////////////////////////////////////
+    //! Returns the seconds Save() spent waiting for an earlier checkpoint, the
+    //! only time the pipeline is stalled beyond copying.
+    //////////////////////////////////////////////////////////////////////////
+    F64
+    GetStallSeconds(
+        ) const throw ();
+
+  private:
+
+    Writer(
+        const Writer &
+        ) throw ();
+
+    Writer &
+    operator=(
+        const Writer &
+        ) throw ();
+
+    struct Worker;
+
+    static
+    void
+    Work(
+        Worker * worker
+        ) throw ();
+
+    Worker * Background;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Restores the checkpoint at path: initializes map with its size and
+  //! fields, loads the state of generatorCount generators, which must be the
+  //! number saved, and returns the step it was taken at.
+  //////////////////////////////////////////////////////////////////////////////
+  static
+  U64
+  Load(
+      const char * path,
+      IcosMap & map,
+      NumberGenerator generator[],
+      U32 generatorCount
+      ) throw (Exception::Type);
+};
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
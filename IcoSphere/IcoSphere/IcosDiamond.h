@@ -0,0 +1,68 @@
+#pragma once
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ *
+ * ****************************************************************************/
+
+
+#include "NativeTypes.h"
+
+////////////////////////////////////////////////////////////////////////////////
+//! The 10 diamonds of the icosahedron, each a pair of faces T,L,R and L,R,B
+//! sharing the edge L-R. Corners are icosahedron vertex IDs: 0 is the north
+//! pole, 1-5 the northern ring, 6-10 the southern ring and 11 the south pole.
+//! Diamonds 0-4 touch the north pole and diamonds 5-9 the south pole.
+//!
+//! A size n diamond is an n x n lattice. Lattice point (i,k) lies at
+//! T + (i/n)(L-T) + (k/n)(R-T) on the flat diamond, and the diamond owns the
+//! points 0 <= i < n, 1 <= k <= n: its T-R and R-B edges and its R corner.
+//! Every cell of the sphere except the two poles is owned by exactly one
+//! diamond.
+////////////////////////////////////////////////////////////////////////////////
+struct IcosDiamond
+{
+  U8 T;
+  U8 L;
+  U8 R;
+  U8 B;
+};
+
+static const U8 ICOS_DIAMOND_COUNT = 10u;
+
+static const IcosDiamond ICOS_DIAMOND[ICOS_DIAMOND_COUNT] = {
+    {  0u,  1u,  2u,  6u }, //  0
+    {  0u,  2u,  3u,  7u }, //  1
+    {  0u,  3u,  4u,  8u }, //  2
+    {  0u,  4u,  5u,  9u }, //  3
+    {  0u,  5u,  1u, 10u }, //  4
+    {  2u,  6u,  7u, 11u }, //  5
+    {  3u,  7u,  8u, 11u }, //  6
+    {  4u,  8u,  9u, 11u }, //  7
+    {  5u,  9u, 10u, 11u }, //  8
+    {  1u, 10u,  6u, 11u }, //  9
+};
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
@@ -0,0 +1,344 @@
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ *
+ * ****************************************************************************/
+
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "IcosFieldStore.h"
+#include "IcosMapPatches.h"
+
+static const char MAGIC[8] = "ICOSFLD";
+
+////////////////////////////////////////////////////////////////////////////////
+//! Rounds bytes up to a multiple of IcosFieldStore::ALIGNMENT.
+////////////////////////////////////////////////////////////////////////////////
+static inline U64 Align(U64 bytes) throw ()
+{
+  return (bytes + IcosFieldStore::ALIGNMENT - 1u) & ~(U64)(IcosFieldStore::ALIGNMENT - 1u);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the number of values of a column of a map of the given size.
+////////////////////////////////////////////////////////////////////////////////
+static U32 GetLayoutValueCount(U16 size, U8 layout) throw ()
+{
+  if (IcosFieldStore::LAYOUT_PATCH == layout)
+  {
+    // (See IcosMapPatches::GetSlotCount())
+    U32 stride = size + 2u;
+    return IcosMapPatches::PATCH_COUNT * stride * stride + 2u;
+  }
+
+  return 10u * size * size + 2u;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosFieldStore.h)
+////////////////////////////////////////////////////////////////////////////////
+IcosFieldStore::IcosFieldStore(
+    ) throw ()
+    : Mapping(nullptr)
+    , Length(0u)
+    , IsWritable(false)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosFieldStore.h)
+////////////////////////////////////////////////////////////////////////////////
+IcosFieldStore::~IcosFieldStore(
+    ) throw ()
+{
+  Close();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosFieldStore.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosFieldStore::Create(
+    const char * path,
+    const IcosTopology & topology,
+    U8 layout,
+    const char * const name[],
+    U8 columnCount
+    ) throw (Exception::Type)
+{
+  if (! ((nullptr != path) && (nullptr != name)
+      && (layout <= LAYOUT_PATCH)
+      && (0u < columnCount) && (columnCount <= MAX_COLUMN_COUNT)))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  Header header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.Magic, MAGIC, sizeof(header.Magic));
+  header.Version = VERSION;
+  header.ByteOrderMark = BYTE_ORDER_MARK;
+  header.CellCount = topology.GetCellCount();
+  header.Size = topology.GetSize();
+  header.Layout = layout;
+  header.ColumnCount = columnCount;
+  header.ValueCount = GetLayoutValueCount(header.Size, layout);
+
+  U64 offset = Align(sizeof(header));
+
+  for (U8 i = 0; i < columnCount; ++i)
+  {
+    if (! ((nullptr != name[i]) && (strlen(name[i]) <= MAX_COLUMN_NAME_LENGTH)))
+    {
+      throw (Exception::PARAMETER_ERROR);
+    }
+
+    strcpy(header.Columns[i].Name, name[i]);
+    header.Columns[i].Offset = offset;
+    offset += Align((U64)header.ValueCount * sizeof(F32));
+  }
+
+  header.FileBytes = offset;
+
+  Close();
+
+  int descriptor = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (descriptor < 0)
+  {
+    throw (Exception::IO_ERROR);
+  }
+
+  // The columns are a hole in the file, read as zeros, until written.
+  if (0 != ftruncate(descriptor, (off_t)header.FileBytes))
+  {
+    close(descriptor);
+    throw (Exception::IO_ERROR);
+  }
+
+  MapFile(descriptor, header.FileBytes, true);
+  memcpy(Mapping, &header, sizeof(header));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosFieldStore.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosFieldStore::Open(
+    const char * path,
+    bool isWritable
+    ) throw (Exception::Type)
+{
+  if (nullptr == path)
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  Close();
+
+  int descriptor = open(path, isWritable ? O_RDWR : O_RDONLY);
+  if (descriptor < 0)
+  {
+    throw (Exception::IO_ERROR);
+  }
+
+  Header header;
+  struct stat status;
+
+  if (! ((0 == fstat(descriptor, &status))
+      && (pread(descriptor, &header, sizeof(header), 0) == (ssize_t)sizeof(header))))
+  {
+    close(descriptor);
+    throw (Exception::FORMAT_ERROR);
+  }
+
+  bool isValid = (0 == memcmp(header.Magic, MAGIC, sizeof(header.Magic)))
+      && (VERSION == header.Version)
+      && (BYTE_ORDER_MARK == header.ByteOrderMark)
+      && (IcosTopology::MIN_SIZE <= header.Size) && (header.Size <= IcosTopology::MAX_SIZE)
+      && (10u * header.Size * header.Size + 2u == header.CellCount)
+      && (header.Layout <= LAYOUT_PATCH)
+      && (GetLayoutValueCount(header.Size, header.Layout) == header.ValueCount)
+      && (0u < header.ColumnCount) && (header.ColumnCount <= MAX_COLUMN_COUNT)
+      && (header.FileBytes == (U64)status.st_size);
+
+  for (U8 i = 0; isValid && (i < header.ColumnCount); ++i)
+  {
+    const Column & column = header.Columns[i];
+    isValid = (0u == column.Offset % ALIGNMENT)
+        && (column.Offset + (U64)header.ValueCount * sizeof(F32) <= header.FileBytes)
+        && (memchr(column.Name, '\0', sizeof(column.Name)) != nullptr);
+  }
+
+  if (! isValid)
+  {
+    close(descriptor);
+    throw (Exception::FORMAT_ERROR);
+  }
+
+  MapFile(descriptor, header.FileBytes, isWritable);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Maps the whole file shared and closes its descriptor, which the mapping
+//! does not need.
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosFieldStore::MapFile(
+    int descriptor,
+    U64 length,
+    bool isWritable
+    ) throw (Exception::Type)
+{
+  void * mapping = mmap(nullptr, length, isWritable ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, descriptor, 0);
+  close(descriptor);
+
+  if (MAP_FAILED == mapping)
+  {
+    throw (Exception::IO_ERROR);
+  }
+
+  Mapping = mapping;
+  Length = length;
+  IsWritable = isWritable;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosFieldStore.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosFieldStore::Close(
+    ) throw ()
+{
+  if (nullptr != Mapping)
+  {
+    munmap(Mapping, Length);
+  }
+
+  Mapping = nullptr;
+  Length = 0u;
+  IsWritable = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosFieldStore.h)
+////////////////////////////////////////////////////////////////////////////////
+U8
+IcosFieldStore::GetSize(
+    ) const throw ()
+{
+  return (nullptr != Mapping) ? (U8)((const Header *)Mapping)->Size : 0u;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosFieldStore.h)
+////////////////////////////////////////////////////////////////////////////////
+U8
+IcosFieldStore::GetLayout(
+    ) const throw ()
+{
+  return (nullptr != Mapping) ? ((const Header *)Mapping)->Layout : LAYOUT_CELL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosFieldStore.h)
+////////////////////////////////////////////////////////////////////////////////
+U8
+IcosFieldStore::GetColumnCount(
+    ) const throw ()
+{
+  return (nullptr != Mapping) ? ((const Header *)Mapping)->ColumnCount : 0u;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosFieldStore.h)
+////////////////////////////////////////////////////////////////////////////////
+U32
+IcosFieldStore::GetValueCount(
+    ) const throw ()
+{
+  return (nullptr != Mapping) ? ((const Header *)Mapping)->ValueCount : 0u;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosFieldStore.h)
+////////////////////////////////////////////////////////////////////////////////
+U8
+IcosFieldStore::FindColumn(
+    const char * name
+    ) const throw (Exception::Type)
+{
+  if (! ((nullptr != name) && (nullptr != Mapping)))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  const Header & header = *(const Header *)Mapping;
+
+  for (U8 i = 0; i < header.ColumnCount; ++i)
+  {
+    if (0 == strcmp(header.Columns[i].Name, name))
+    {
+      return i;
+    }
+  }
+
+  throw (Exception::PARAMETER_ERROR);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosFieldStore.h)
+////////////////////////////////////////////////////////////////////////////////
+F32 *
+IcosFieldStore::GetValues(
+    U8 column
+    ) const throw (Exception::Type)
+{
+  if (! (column < GetColumnCount()))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  return (F32 *)((U8 *)Mapping + ((const Header *)Mapping)->Columns[column].Offset);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosFieldStore.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosFieldStore::Flush(
+    ) throw (Exception::Type)
+{
+  if ((nullptr != Mapping) && IsWritable && (0 != msync(Mapping, Length, MS_SYNC)))
+  {
+    throw (Exception::IO_ERROR);
+  }
+}
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
@@ -0,0 +1,196 @@
+#pragma once
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ *
+ * ****************************************************************************/
+
+
+#include "Exception.h"
+#include "IcosTopology.h"
+#include "NativeTypes.h"
+
+////////////////////////////////////////////////////////////////////////////////
+//! File backed storage for the F32 field columns of a map. A store is mapped
+//! into memory and used in place, so a set of fields is saved and restored
+//! without being read or written as a whole, and several processes may map
+//! the same store:
+//!
+//!   Header       fixed size, padded to ALIGNMENT bytes
+//!   Columns      one array of GetValueCount() values per field, each padded
+//!                to ALIGNMENT bytes
+//!
+//! The file is mapped shared, so values written through GetValues() reach the
+//! file, Flush() forcing them to disk. Columns are laid out either in cell ID
+//! order, which IcosMap::Initialize() can use as a world's elevation column,
+//! or in IcosMapPatches slot order, so that work on one patch touches one
+//! contiguous run of memory.
+//!
+//! Values are stored in the byte order of the writing machine, which the
+//! header records.
+////////////////////////////////////////////////////////////////////////////////
+class IcosFieldStore
+{
+public:
+
+  static const U32 VERSION = 1u;
+  static const U32 BYTE_ORDER_MARK = 0x01020304u;
+  //! A multiple of the page size of every supported machine.
+  static const U32 ALIGNMENT = 16384u;
+  static const U8 MAX_COLUMN_COUNT = 8u;
+  static const U8 MAX_COLUMN_NAME_LENGTH = 15u;
+
+  static const U8 LAYOUT_CELL = 0u;
+  static const U8 LAYOUT_PATCH = 1u;
+
+  struct Column
+  {
+    char Name[MAX_COLUMN_NAME_LENGTH + 1u];
+    U64 Offset;
+  };
+
+  struct Header
+  {
+    char Magic[8];
+    U32 Version;
+    U32 ByteOrderMark;
+    U64 FileBytes;
+    U32 CellCount;
+    U32 ValueCount;       //!< Values of each column.
+    U16 Size;
+    U8 Layout;
+    U8 ColumnCount;
+    U32 Reserved;
+    Column Columns[MAX_COLUMN_COUNT];
+  };
+
+  IcosFieldStore(
+      ) throw ();
+
+  ~IcosFieldStore(
+      ) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Creates a store at path, replacing any file there, with columnCount
+  //! zeroed columns of the given names for topology in the given layout, and
+  //! maps it writable. Pages are not allocated until they are written.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  Create(
+      const char * path,
+      const IcosTopology & topology,
+      U8 layout,
+      const char * const name[],
+      U8 columnCount
+      ) throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Maps the store at path, writable or read-only. Writing to the columns of
+  //! a read-only store faults.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  Open(
+      const char * path,
+      bool isWritable
+      ) throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Releases the mapping. Changes not yet flushed still reach the file, but
+  //! at a time of the operating system's choosing.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  Close(
+      ) throw ();
+
+  U8
+  GetSize(
+      ) const throw ();
+
+  U8
+  GetLayout(
+      ) const throw ();
+
+  U8
+  GetColumnCount(
+      ) const throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the number of values of each column: the cell count, or the
+  //! IcosMapPatches slot count.
+  //////////////////////////////////////////////////////////////////////////////
+  U32
+  GetValueCount(
+      ) const throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the index of the column with the given name. Throws
+  //! PARAMETER_ERROR if there is none.
+  //////////////////////////////////////////////////////////////////////////////
+  U8
+  FindColumn(
+      const char * name
+      ) const throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the values of a column, which stay valid until Close().
+  //////////////////////////////////////////////////////////////////////////////
+  F32 *
+  GetValues(
+      U8 column
+      ) const throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Writes every changed page to the file and waits for it to reach the
+  //! disk. Does nothing for a read-only store.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  Flush(
+      ) throw (Exception::Type);
+
+private:
+
+  IcosFieldStore(
+      const IcosFieldStore &
+      ) throw ();
+
+  IcosFieldStore &
+  operator=(
+      const IcosFieldStore &
+      ) throw ();
+
+  void
+  MapFile(
+      int descriptor,
+      U64 length,
+      bool isWritable
+      ) throw (Exception::Type);
+
+  //! Mapping of the whole file, or null.
+  void * Mapping;
+  U64 Length;
+  bool IsWritable;
+};
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
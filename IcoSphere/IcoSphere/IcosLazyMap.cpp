@@ -0,0 +1,461 @@
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ *
+ * ****************************************************************************/
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "Coordinates.h"
+#include "IcosDiamond.h"
+#include "IcosLazyMap.h"
+#include "NumberGenerator.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+//! Icosahedron vertices, the same as those IcosMap is built on: 0 is the north
+//! pole, 1-5 the northern ring, 6-10 the southern ring and 11 the south pole.
+////////////////////////////////////////////////////////////////////////////////
+static const U8 ICOS_VERTEX_COUNT = 12u;
+
+static const Coordinates::UnitSphereDegrees ICOS_VERTEX[ICOS_VERTEX_COUNT] = {
+    { +90.0f,           0.0f }, //  0
+    { +26.477362752,    0.0f }, //  1
+    { +26.477362752,   72.0f }, //  2
+    { +26.477362752,  144.0f }, //  3
+    { +26.477362752,  216.0f }, //  4
+    { +26.477362752,  288.0f }, //  5
+    { -26.477362752,   36.0f }, //  6
+    { -26.477362752,  108.0f }, //  7
+    { -26.477362752,  180.0f }, //  8
+    { -26.477362752,  252.0f }, //  9
+    { -26.477362752,  324.0f }, // 10
+    { -90.0f,           0.0f }, // 11
+};
+
+static const U32 TILE_CELL_COUNT = IcosLazyMap::TILE_SIZE * IcosLazyMap::TILE_SIZE;
+
+////////////////////////////////////////////////////////////////////////////////
+//! Resident tiles, most recently used first.
+////////////////////////////////////////////////////////////////////////////////
+struct IcosLazyMap::Cache
+{
+  struct Tile
+  {
+    U64 Key;
+    F32 Value[TILE_CELL_COUNT];
+  };
+
+  typedef std::list<Tile> TileList;
+
+  TileList Tiles;
+
+  std::unordered_map<U64, TileList::iterator> Index;
+
+  U32 MaxTileCount;
+
+  Statistics Stats;
+
+  mutable std::mutex Lock;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosLazyMap.h)
+////////////////////////////////////////////////////////////////////////////////
+IcosLazyMap::IcosLazyMap(
+    ) throw ()
+    : Size(0u)
+    , TilesPerSide(0u)
+    , FieldCount(0u)
+    , TileCache(new Cache())
+{
+  TileCache->MaxTileCount = 1u;
+  TileCache->Stats = Statistics();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosLazyMap.h)
+////////////////////////////////////////////////////////////////////////////////
+IcosLazyMap::~IcosLazyMap(
+    ) throw ()
+{
+  delete TileCache;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosLazyMap.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosLazyMap::Initialize(
+    U32 size,
+    U64 memoryBudget
+    ) throw (Exception::Type)
+{
+  if (size < MIN_SIZE || MAX_SIZE < size)
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  std::lock_guard<std::mutex> lock(TileCache->Lock);
+
+  Size = size;
+  TilesPerSide = (size + TILE_SIZE - 1u) / TILE_SIZE;
+  FieldCount = 0u;
+
+  U64 maxTileCount = memoryBudget / sizeof(Cache::Tile);
+  if (maxTileCount < 1u) maxTileCount = 1u;
+  if (maxTileCount > 0xFFFFFFFFUL) maxTileCount = 0xFFFFFFFFUL;
+
+  TileCache->Tiles.clear();
+  TileCache->Index.clear();
+  TileCache->MaxTileCount = (U32)maxTileCount;
+  TileCache->Stats = Statistics();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosLazyMap.h)
+////////////////////////////////////////////////////////////////////////////////
+U32
+IcosLazyMap::AddField(
+    const Field & field
+    ) throw (Exception::Type)
+{
+  if (! (FieldCount < MAX_FIELD_COUNT))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  FieldFunction[FieldCount] = &field;
+
+  return FieldCount++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosLazyMap.h)
+////////////////////////////////////////////////////////////////////////////////
+U32
+IcosLazyMap::GetSize(
+    ) const throw ()
+{
+  return Size;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosLazyMap.h)
+////////////////////////////////////////////////////////////////////////////////
+U64
+IcosLazyMap::GetCellCount(
+    ) const throw ()
+{
+  return (0u < Size) ? (DIAMOND_COUNT * (U64)Size * Size + 2u) : 0u;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosLazyMap.h)
+////////////////////////////////////////////////////////////////////////////////
+U64
+IcosLazyMap::GetCellID(
+    U32 diamond,
+    U32 i,
+    U32 j
+    ) const throw (Exception::Type)
+{
+  if (! ((diamond < DIAMOND_COUNT) && (i < Size) && (j < Size)))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  return 1u + ((U64)diamond * Size + i) * Size + j;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosLazyMap.h)
+////////////////////////////////////////////////////////////////////////////////
+Vector
+IcosLazyMap::GetUnitVector(
+    U64 cellID
+    ) const throw (Exception::Type)
+{
+  U64 cellCount = GetCellCount();
+
+  if (! (cellID < cellCount))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  if (0u == cellID)
+  {
+    return Vector(ICOS_VERTEX[0]);
+  }
+  else if ((cellCount - 1u) == cellID)
+  {
+    return Vector(ICOS_VERTEX[ICOS_VERTEX_COUNT - 1u]);
+  }
+
+  U64 index = cellID - 1u;
+  U64 diamondCellCount = (U64)Size * Size;
+  U32 diamond = (U32)(index / diamondCellCount);
+  index %= diamondCellCount;
+
+  return GetUnitVector(diamond, (U32)(index / Size), (U32)(index % Size));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosLazyMap.h)
+////////////////////////////////////////////////////////////////////////////////
+F32
+IcosLazyMap::GetValue(
+    U32 field,
+    U64 cellID
+    ) throw (Exception::Type)
+{
+  U64 cellCount = GetCellCount();
+
+  if (! ((field < FieldCount) && (cellID < cellCount)))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  // The poles belong to no diamond and are cheaper to evaluate than to cache.
+  if ((0u == cellID) || ((cellCount - 1u) == cellID))
+  {
+    return FieldFunction[field]->Evaluate(GetUnitVector(cellID));
+  }
+
+  U64 index = cellID - 1u;
+  U64 diamondCellCount = (U64)Size * Size;
+  U32 diamond = (U32)(index / diamondCellCount);
+  index %= diamondCellCount;
+  U32 i = (U32)(index / Size);
+  U32 j = (U32)(index % Size);
+  U32 tileI = i / TILE_SIZE;
+  U32 tileJ = j / TILE_SIZE;
+  U32 offset = (i % TILE_SIZE) * TILE_SIZE + (j % TILE_SIZE);
+
+  U64 key = (((U64)field * DIAMOND_COUNT + diamond) * TilesPerSide + tileI) * TilesPerSide + tileJ;
+
+  Cache & cache = *TileCache;
+
+  {
+    std::lock_guard<std::mutex> lock(cache.Lock);
+
+    std::unordered_map<U64, Cache::TileList::iterator>::iterator found = cache.Index.find(key);
+
+    if (found != cache.Index.end())
+    {
+      cache.Stats.Hits++;
+      cache.Tiles.splice(cache.Tiles.begin(), cache.Tiles, found->second);
+      return found->second->Value[offset];
+    }
+
+    cache.Stats.Misses++;
+  }
+
+  // Evaluate outside the lock so other threads keep hitting the cache. If two
+  // threads miss the same tile both evaluate it and the first insert wins.
+  Cache::TileList fresh(1u);
+  fresh.front().Key = key;
+  EvaluateTile(field, diamond, tileI, tileJ, fresh.front().Value);
+  F32 value = fresh.front().Value[offset];
+
+  std::lock_guard<std::mutex> lock(cache.Lock);
+
+  if (cache.Index.find(key) == cache.Index.end())
+  {
+    while (cache.MaxTileCount <= cache.Tiles.size())
+    {
+      cache.Index.erase(cache.Tiles.back().Key);
+      cache.Tiles.pop_back();
+      cache.Stats.Evictions++;
+    }
+
+    cache.Tiles.splice(cache.Tiles.begin(), fresh);
+    cache.Index[key] = cache.Tiles.begin();
+  }
+
+  return value;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosLazyMap.h)
+////////////////////////////////////////////////////////////////////////////////
+IcosLazyMap::Statistics
+IcosLazyMap::GetStatistics(
+    ) const throw ()
+{
+  std::lock_guard<std::mutex> lock(TileCache->Lock);
+
+  Statistics stats = TileCache->Stats;
+  stats.ResidentTiles = (U32)TileCache->Tiles.size();
+  stats.ResidentBytes = (U64)stats.ResidentTiles * sizeof(Cache::Tile);
+
+  return stats;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the unit vector of cell (i,j) of a diamond.
+////////////////////////////////////////////////////////////////////////////////
+Vector
+IcosLazyMap::GetUnitVector(
+    U32 diamond,
+    U32 i,
+    U32 j
+    ) const throw ()
+{
+  // Cell (i,j) is lattice point (i,j+1) of the diamond, see IcosDiamond.h.
+  const IcosDiamond & corner = ICOS_DIAMOND[diamond];
+
+  F64 s = (F64)i / Size;
+  F64 t = (F64)(j + 1u) / Size;
+
+  // Corners of the face the cell lies in, and its position relative to them.
+  // The lower face is walked from B: T + s(L-T) + t(R-T) equals
+  // B + (1-s)(R-B) + (1-t)(L-B) on a flat diamond.
+  Vector origin;
+  Vector sAxis;
+  Vector tAxis;
+
+  if ((i + j + 1u) <= Size)
+  {
+    origin = Vector(ICOS_VERTEX[corner.T]);
+    sAxis = Vector(ICOS_VERTEX[corner.L]);
+    tAxis = Vector(ICOS_VERTEX[corner.R]);
+  }
+  else
+  {
+    origin = Vector(ICOS_VERTEX[corner.B]);
+    sAxis = Vector(ICOS_VERTEX[corner.R]);
+    tAxis = Vector(ICOS_VERTEX[corner.L]);
+    s = 1.0 - s;
+    t = 1.0 - t;
+  }
+
+  F64 x = origin.X + s * (sAxis.X - origin.X) + t * (tAxis.X - origin.X);
+  F64 y = origin.Y + s * (sAxis.Y - origin.Y) + t * (tAxis.Y - origin.Y);
+  F64 z = origin.Z + s * (sAxis.Z - origin.Z) + t * (tAxis.Z - origin.Z);
+
+  Vector result((F32)x, (F32)y, (F32)z);
+  result.Normalize();
+
+  return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Evaluates a field at every cell of a tile. Cells of a partial tile beyond
+//! the edge of the diamond are set to zero.
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosLazyMap::EvaluateTile(
+    U32 field,
+    U32 diamond,
+    U32 tileI,
+    U32 tileJ,
+    F32 value[]
+    ) const throw ()
+{
+  const Field & function = *FieldFunction[field];
+
+  for (U32 a = 0; a < TILE_SIZE; ++a)
+  {
+    U32 i = tileI * TILE_SIZE + a;
+
+    for (U32 b = 0; b < TILE_SIZE; ++b)
+    {
+      U32 j = tileJ * TILE_SIZE + b;
+
+      value[a * TILE_SIZE + b] = ((i < Size) && (j < Size)) ? function.Evaluate(GetUnitVector(diamond, i, j)) : 0.0f;
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Converts a random U32 to [0,1] exactly as NumberGenerator::GenerateF64().
+////////////////////////////////////////////////////////////////////////////////
+static inline F64 UnitF64(U32 value) throw ()
+{
+  return ((F64)value * (1.0/4294967295.0));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosLazyMap.h)
+////////////////////////////////////////////////////////////////////////////////
+IcosDisplacementField::IcosDisplacementField(
+    U64 seed,
+    U16 planeCount
+    ) throw ()
+    : PlaneCount(planeCount)
+    , Origin(new Vector[planeCount])
+    , Direction(new Vector[planeCount])
+{
+  // Planes are drawn in the same order as IcosMap draws them.
+  NumberGenerator rand;
+  rand.Seed(seed);
+
+  for (U16 i = 0; i < PlaneCount; ++i)
+  {
+    U32 n[6];
+    rand.FillU32(n, 6);
+
+    Origin[i] = Vector((UnitF64(n[0])-0.5f), (UnitF64(n[1])-0.5f), (UnitF64(n[2])-0.5f));
+    Origin[i].Normalize();
+
+    Direction[i] = Vector((UnitF64(n[3])-0.5f), (UnitF64(n[4])-0.5f), (UnitF64(n[5])-0.5f));
+    Direction[i].Normalize();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosLazyMap.h)
+////////////////////////////////////////////////////////////////////////////////
+IcosDisplacementField::~IcosDisplacementField(
+    ) throw ()
+{
+  delete [] Origin;
+  delete [] Direction;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosLazyMap.h)
+////////////////////////////////////////////////////////////////////////////////
+F32
+IcosDisplacementField::Evaluate(
+    const Vector & unitVector
+    ) const throw ()
+{
+  U16 count = 0;
+
+  for (U16 i = 0; i < PlaneCount; ++i)
+  {
+    if ((Direction[i] * (unitVector - Origin[i])) > 0.0f)
+    {
+      count++;
+    }
+  }
+
+  return (0u < PlaneCount) ? ((F32)count / PlaneCount) : 0.0f;
+}
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
@@ -0,0 +1,246 @@
+#pragma once
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ *
+ * ****************************************************************************/
+
+
+#include "Exception.h"
+#include "NativeTypes.h"
+#include "Vector.h"
+
+////////////////////////////////////////////////////////////////////////////////
+//! A map for resolutions far beyond IcosMap::MAX_SIZE whose cells are never
+//! stored up front. Every field is a pure function of the cell's unit vector,
+//! evaluated on first access one tile at a time and kept in an LRU cache with a
+//! fixed memory budget, so memory follows the working set rather than the map.
+//!
+//! The sphere is addressed as 10 diamonds, each a pair of icosahedral faces
+//! sharing an edge, plus the two poles. Diamonds 0-4 touch the north pole and
+//! diamonds 5-9 the south pole. Each diamond is a size x size grid of cells
+//! (i,j), so there are 10 * size * size + 2 cells, as in IcosMap. Cell 0 is the
+//! north pole, the last cell is the south pole, and the cells of diamond d
+//! follow in row order from 1 + d * size * size. Cell (i,j) is lattice point
+//! (i,j+1) of its diamond as described in IcosDiamond.h.
+////////////////////////////////////////////////////////////////////////////////
+class IcosLazyMap
+{
+public:
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! A procedural cell field. Evaluate() must be a pure function of its
+  //! argument and safe to call from several threads at once.
+  //////////////////////////////////////////////////////////////////////////////
+  class Field
+  {
+  public:
+
+    virtual
+    ~Field(
+        ) throw ()
+    {
+    }
+
+    virtual
+    F32
+    Evaluate(
+        const Vector & unitVector
+        ) const throw () = 0;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Cache activity since Initialize().
+  //////////////////////////////////////////////////////////////////////////////
+  struct Statistics
+  {
+    U64 Hits;
+    U64 Misses;
+    U64 Evictions;
+    U32 ResidentTiles;
+    U64 ResidentBytes;
+  };
+
+  static const U32 MIN_SIZE = 1u;
+  static const U32 MAX_SIZE = 1000000u;
+
+  static const U32 DIAMOND_COUNT = 10u;
+
+  //! Tiles are TILE_SIZE x TILE_SIZE cells of one diamond.
+  static const U32 TILE_SIZE = 32u;
+
+  static const U32 MAX_FIELD_COUNT = 8u;
+
+  IcosLazyMap(
+      ) throw ();
+
+  ~IcosLazyMap(
+      ) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Sets the size and the most memory the tile cache may hold. At least one
+  //! tile is always cached. Drops all fields and cached tiles.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  Initialize(
+      U32 size,
+      U64 memoryBudget
+      ) throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Adds a field and returns its index. The field must outlive the map.
+  //////////////////////////////////////////////////////////////////////////////
+  U32
+  AddField(
+      const Field & field
+      ) throw (Exception::Type);
+
+  U32
+  GetSize(
+      ) const throw ();
+
+  U64
+  GetCellCount(
+      ) const throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the ID of cell (i,j) of the given diamond.
+  //////////////////////////////////////////////////////////////////////////////
+  U64
+  GetCellID(
+      U32 diamond,
+      U32 i,
+      U32 j
+      ) const throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the position of a cell on the unit sphere. Computed, never cached.
+  //////////////////////////////////////////////////////////////////////////////
+  Vector
+  GetUnitVector(
+      U64 cellID
+      ) const throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the value of a field at a cell, evaluating and caching the cell's
+  //! tile if it is not resident. Safe to call from several threads at once.
+  //////////////////////////////////////////////////////////////////////////////
+  F32
+  GetValue(
+      U32 field,
+      U64 cellID
+      ) throw (Exception::Type);
+
+  Statistics
+  GetStatistics(
+      ) const throw ();
+
+private:
+
+  struct Cache;
+
+  Vector
+  GetUnitVector(
+      U32 diamond,
+      U32 i,
+      U32 j
+      ) const throw ();
+
+  void
+  EvaluateTile(
+      U32 field,
+      U32 diamond,
+      U32 tileI,
+      U32 tileJ,
+      F32 value[]
+      ) const throw ();
+
+  U32 Size;
+
+  U32 TilesPerSide;
+
+  U32 FieldCount;
+
+  const Field * FieldFunction[MAX_FIELD_COUNT];
+
+  Cache * TileCache;
+
+private:
+
+  IcosLazyMap(
+      const IcosLazyMap &
+      ) throw ();
+
+  IcosLazyMap &
+  operator=(
+      const IcosLazyMap &
+      ) throw ();
+
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//! The displacement algorithm of IcosMap as a pure function: the fraction of
+//! random planes a point lies in front of. Unlike IcosMap the result is not
+//! normalized over the map, which would need every cell.
+////////////////////////////////////////////////////////////////////////////////
+class IcosDisplacementField : public IcosLazyMap::Field
+{
+public:
+
+  IcosDisplacementField(
+      U64 seed,
+      U16 planeCount
+      ) throw ();
+
+  ~IcosDisplacementField(
+      ) throw ();
+
+  F32
+  Evaluate(
+      const Vector & unitVector
+      ) const throw ();
+
+private:
+
+  U16 PlaneCount;
+
+  Vector * Origin;
+
+  Vector * Direction;
+
+private:
+
+  IcosDisplacementField(
+      const IcosDisplacementField &
+      ) throw ();
+
+  IcosDisplacementField &
+  operator=(
+      const IcosDisplacementField &
+      ) throw ();
+
+};
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
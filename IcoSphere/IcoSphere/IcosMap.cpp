@@ -18,1053 +18,312 @@
  * Chagne Date        Description
  * -----------------------------------------------------------------------------
  * Aug 19, 2019 |---| added license notice
+ * Oct 19, 2026 |---| added seeded elevation generation into external storage
+ * Oct 19, 2026 |---| draw displacement planes with bulk number generation
+ * Oct 19, 2026 |---| arrays may point into a mapped map file
+ * Oct 19, 2026 |---| topology may be shared through IcosTopologyCache
+ * Oct 19, 2026 |---| split topology into shared IcosTopology
+ * Oct 19, 2026 |---| added dirty block tracking of the fields
+ * Oct 19, 2026 |---| elevation may live in caller storage
  *
  * ****************************************************************************/
 
 #include <string.h>
 
-#include "RotationAxis.h"
-#include "Coordinates.h"
 #include "IcosMap.h"
-#include "Matrix.h"
 #include "Memory.h"
 #include "Vector.h"
 #include "NumberGenerator.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
-static const U8 ICOS_VERTEX_COUNT = 12u;
-
-////////////////////////////////////////////////////////////////////////////////
-//! The 20 faces of sphere are organized like:
-//! /\/\/\/\/\
-//! \/\/\/\/\/\
-//!  \/\/\/\/\/
-//! Rows run from from North (row 0) to South (row N). The first cell of each
-//! row is the left most edge or vertex cell.
-////////////////////////////////////////////////////////////////////////////////
-
-////////////////////////////////////////////////////////////////////////////////
-//! The order of these vertices is important to the setup algorithm. Cells are
-//! traversed from most northerly vertex traversing all cells at a given
-//! latitude before traversing the cells in the next more southerly latitude.
+//! Converts a random U32 to [0,1] exactly as NumberGenerator::GenerateF64().
 ////////////////////////////////////////////////////////////////////////////////
-static const Coordinates::UnitSphereDegrees ICOS_VERTEX[ICOS_VERTEX_COUNT] = {
-    { +90.0f,           0.0f }, //  0
-    { +26.477362752,    0.0f }, //  1
-    { +26.477362752,   72.0f }, //  2
-    { +26.477362752,  144.0f }, //  3
-    { +26.477362752,  216.0f }, //  4
-    { +26.477362752,  288.0f }, //  5
-    { -26.477362752,   36.0f }, //  6
-    { -26.477362752,  108.0f }, //  7
-    { -26.477362752,  180.0f }, //  8
-    { -26.477362752,  252.0f }, //  9
-    { -26.477362752,  324.0f }, // 10
-    { -90.0f,           0.0f }, // 11
-};
-
-////////////////////////////////////////////////////////////////////////////////
-struct IcosEdge
+static inline F64 UnitF64(U32 value) throw ()
 {
-  U8 V1;
-  U8 V2;
-};
-
-static const U8 ICOS_EDGE_COUNT = 30u;
-
-////////////////////////////////////////////////////////////////////////////////
-//! The order of these edges is important to the setup algorithm. Edges must be
-//! in cell traversal order.
-////////////////////////////////////////////////////////////////////////////////
-static const IcosEdge ICOS_EDGE[ICOS_EDGE_COUNT] = {
-    {  0u,  1u  }, //  0
-    {  0u,  2u  }, //  1
-    {  0u,  3u  }, //  2
-    {  0u,  4u  }, //  3
-    {  0u,  5u  }, //  4
-    {  1u,  2u  }, //  5
-    {  2u,  3u  }, //  6
-    {  3u,  4u  }, //  7
-    {  4u,  5u  }, //  8
-    {  5u,  1u  }, //  9
-    {  1u,  6u  }, //  10
-    {  2u,  6u  }, //  11
-    {  2u,  7u  }, //  12
-    {  3u,  7u  }, //  13
-    {  3u,  8u  }, //  14
-    {  4u,  8u  }, //  15
-    {  4u,  9u  }, //  16
-    {  5u,  9u  }, //  17
-    {  5u, 10u  }, //  18
-    {  1u, 10u  }, //  19
-    {  6u,  7u  }, //  20
-    {  7u,  8u  }, //  21
-    {  8u,  9u  }, //  22
-    {  9u, 10u  }, //  23
-    { 10u,  6u  }, //  24
-    {  6u, 11u  }, //  25
-    {  7u, 11u  }, //  26
-    {  8u, 11u  }, //  27
-    {  9u, 11u  }, //  28
-    { 10u, 11u  }, //  29
-};
-
-////////////////////////////////////////////////////////////////////////////////
-struct IcosFace
-{
-  U8 E1; // Edge ID of west edge.
-  U8 E2; // Edge ID of east edge.
-  bool Inverted; // True if face is /\, false if \/
-};
-
-static const U8 ICOS_FACE_COUNT = 20u;
-
-////////////////////////////////////////////////////////////////////////////////
-//! The order of these faces is important to the setup algorithm. Faces must be
-//! in cell traversal order.
-////////////////////////////////////////////////////////////////////////////////
-static const IcosFace ICOS_FACE[ICOS_FACE_COUNT] = {
-    {  0u,  1u, false  }, //  0
-    {  1u,  2u, false  }, //  1
-    {  2u,  3u, false  }, //  2
-    {  3u,  4u, false  }, //  3
-    {  4u,  0u, false  }, //  4
-    { 10u, 11u, true   }, //  5
-    { 11u, 12u, false  }, //  6
-    { 12u, 13u, true   }, //  7
-    { 13u, 14u, false  }, //  8
-    { 14u, 15u, true   }, //  9
-    { 15u, 16u, false  }, // 10
-    { 16u, 17u, true   }, // 11
-    { 17u, 18u, false  }, // 12
-    { 18u, 19u, true   }, // 13
-    { 19u, 10u, false  }, // 14
-    { 25u, 26u, true   }, // 15
-    { 26u, 27u, true   }, // 16
-    { 27u, 28u, true   }, // 17
-    { 28u, 29u, true   }, // 18
-    { 29u, 25u, true   }, // 19
-};
+  return ((F64)value * (1.0/4294967295.0));
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 IcosMap::IcosMap()
-: Size(0u)
-, CellCount(0u)
-, ExpectedEdgeCellCount(0u)
-, ExpectedFaceCellCount(0u)
-, RowCount(0u)
+: Topology(nullptr)
+, Elevation(nullptr)
+, IsElevationOwned(false)
 {
-  memset(VertexCell, 0, sizeof(VertexCell));
-  memset(EdgeCellCount, 0, sizeof(EdgeCellCount));
-  memset(EdgeCell, 0, sizeof(EdgeCell));
-  memset(FaceCellCount, 0, sizeof(FaceCellCount));
-  memset(FaceCell, 0, sizeof(FaceCell));
-  memset(RowCellCount, 0, sizeof(RowCellCount));
-  memset(RowCell, 0, sizeof(RowCell));
+  ClearDirtyBlocks();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 IcosMap::~IcosMap()
 {
+  Attach(nullptr, nullptr);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-// (See IcosMap.h)
+//! Replaces the map's topology and elevation, releasing the old ones. The map
+//! takes over the caller's reference to topology. A null elevation allocates
+//! zeroed elevations owned by the map.
 ////////////////////////////////////////////////////////////////////////////////
-void IcosMap::Initialize(U8 size) throw (Exception::Type)
+void IcosMap::Attach(const IcosTopology * topology, F32 elevation[]) throw ()
 {
-  // Check parameters.
-  if (size < MIN_SIZE || MAX_SIZE < size)
+  if (IsElevationOwned)
   {
-    throw (Exception::PARAMETER_ERROR);
+    delete [] Elevation;
   }
 
-  // Initialize member variables.
-  Size = size;
-  CellCount = 10u * Size * Size + 2u;
-  ExpectedEdgeCellCount = Size - 1u;
-  ExpectedFaceCellCount = ((Size - 2u) * (Size - 1u)) / 2;
-  memset(VertexCell, 0, sizeof(VertexCell));
-  memset(EdgeCellCount, 0, sizeof(EdgeCellCount));
-  memset(EdgeCell, 0, sizeof(EdgeCell));
-  memset(FaceCellCount, 0, sizeof(FaceCellCount));
-  memset(FaceCell, 0, sizeof(FaceCell));
-
-  RowCount = 3u * size + 1;
-  memset(RowCellCount, 0, sizeof(RowCellCount));
-  memset(RowCell, 0, sizeof(RowCell));
-
-  for (U16 i = 0; i < MAX_CELL_COUNT; ++i)
+  if (Topology != nullptr)
   {
-    Cell[i].Initialize();
+    Topology->Release();
   }
 
-  // Initialize row cell count. Row cell counts follow this progression:
-  // Size 1 :  1  5  5  1
-  // Size 2 :  1  5 10 10 10  5  1
-  // Size 3 :  1  5 10 15 15 15 15 10 5  1
-  // Size 4 :  1  5 10 15 20 20 20 20 20 15 10  5  1
-  for (U16 y = 0; y < RowCount; ++y)
-  {
-    U16 count;
+  Topology = topology;
+  Elevation = elevation;
+  IsElevationOwned = false;
 
-    if (y == 0)
-    {
-      count = 1;
-    }
-    else if (y <= Size)
-    {
-      count = 5 * y;
-    }
-    else if (y <= (2 * Size))
-    {
-      count = 5 * Size;
-    }
-    else if (y < (RowCount - 1))
-    {
-      count = 5 * (RowCount - y - 1);
-    }
-    else
-    {
-      count = 1;
-    }
-
-    RowCellCount[y] = count;
-  }
-
-  // Initialize cell attributes and row cell arrays.
-  U16 nextCellID = 0u;
-  for (U16 y = 0; y < RowCount; ++y)
+  if ((topology != nullptr) && (elevation == nullptr))
   {
-    RowCell[y] = &Cell[nextCellID];
-
-    for (U16 x = 0; x < RowCellCount[y]; ++x)
-    {
-      Cell[nextCellID].ID = nextCellID;
-      Cell[nextCellID].X = x;
-      Cell[nextCellID].Y = y;
-      CalculateCellTypeAndTypeID(nextCellID); // Must not be called before X and Y are set.
-      ++nextCellID;
-    }
+    Elevation = new F32[topology->GetCellCount()];
+    memset(Elevation, 0, sizeof(F32) * topology->GetCellCount());
+    IsElevationOwned = true;
   }
 
-  // Run initialization checks.
-  CheckEdgeCellCounts();
-  CheckFaceCellCounts();
-
-  // Calculate longitude and latitude.
-  CalculateLatitudeLongitudeForVertexCells();
-
-  CalculateLatitudeLongitudeForEdgeCells(); // Must not be called before vertex cell latitude
-                                            // and longitude have been calculated.
-  CalculateLatitudeLongitudeForFaceCells(); // Must not be called before edge cell latitude
-                                            // and longitude have been calculated.
-
-  // Calculate adjacent cells.
-  CalculateAdjacentCellsForVertexCells();
-  CalculateAdjacentCellsForEdgeCells(); // Must not be called before adjacent cells for
-                                        // vertex cells have been calculated.
-  CalculateAdjacentCellsForFaceCells(); // Must not be called before adjacent cells for
-                                        // vertex cells have been calculated.
-}
-
-////////////////////////////////////////////////////////////////////////////////
-// (See IcosCell.h)
-////////////////////////////////////////////////////////////////////////////////
-U16 IcosMap::GetCellCount() const throw ()
-{
-  return CellCount;
+  MarkDirty(0u, GetCellCount());
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-// (See IcosCell.h)
+// (See IcosMap.h)
 ////////////////////////////////////////////////////////////////////////////////
-U16 IcosMap::GetCellID(S16 x, U16 y) throw (Exception::Type)
+void IcosMap::MarkDirty(U16 firstCellID, U16 cellCount) throw ()
 {
-  if (! (y < RowCount))
+  if (0u == cellCount)
   {
-    throw (Exception::PARAMETER_ERROR);
+    return;
   }
 
-  x = x % RowCellCount[y];
-
-  if (x < 0) x = x + RowCellCount[y];
+  U16 lastBlock = (firstCellID + cellCount - 1u) / DIRTY_BLOCK_CELL_COUNT;
 
-  return RowCell[y][x].ID;
+  for (U16 block = firstCellID / DIRTY_BLOCK_CELL_COUNT; block <= lastBlock; ++block)
+  {
+    DirtyBlock[block / 64u] |= (1ull << (block % 64u));
+  }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-// (See IcosCell.h)
+// (See IcosMap.h)
 ////////////////////////////////////////////////////////////////////////////////
-U16 IcosMap::GetCellType(U16 x, U16 y) throw (Exception::Type)
+void IcosMap::ClearDirtyBlocks() throw ()
 {
-  if (! ((y < RowCount) && (x < RowCellCount[y])) )
-  {
-    throw (Exception::PARAMETER_ERROR);
-  }
-
-  return RowCell[y][x].Type;
+  memset(DirtyBlock, 0, sizeof(DirtyBlock));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-// (See IcosCell.h)
+// (See IcosMap.h)
 ////////////////////////////////////////////////////////////////////////////////
-U16 IcosMap::GetCellTypeID(U16 x, U16 y) throw (Exception::Type)
+void IcosMap::Initialize(U8 size) throw (Exception::Type)
 {
-  if (! ((y < RowCount) && (x < RowCellCount[y])) )
+  // Check parameters.
+  if (size < MIN_SIZE || MAX_SIZE < size)
   {
     throw (Exception::PARAMETER_ERROR);
   }
 
-  return RowCell[y][x].TypeID;
+  Attach(IcosTopology::Create(size), nullptr);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-// (See IcosCell.h)
+// (See IcosMap.h)
 ////////////////////////////////////////////////////////////////////////////////
-Coordinates::UnitSphereDegrees
-IcosMap::GetCoordinates(
-    U16 x,
-    U16 y
-    ) throw (Exception::Type)
+void IcosMap::Initialize(const IcosTopology & topology) throw ()
 {
-  if (! ((y < RowCount) && (x < RowCellCount[y])) )
-  {
-    throw (Exception::PARAMETER_ERROR);
-  }
+  topology.AddReference();
 
-  return RowCell[y][x].Coordinates;
+  Attach(&topology, nullptr);
 }
 
-void
-IcosMap::GetAdjacentCellIDs(
-    const U16 x,
-    const U16 y,
-    AdjacentCellIterator & iterator
-    ) const throw (Exception::Type)
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMap.h)
+////////////////////////////////////////////////////////////////////////////////
+void IcosMap::Initialize(const IcosTopology & topology, F32 elevation[]) throw (Exception::Type)
 {
-  if (! ((y < RowCount) && (x < RowCellCount[y])) )
+  if (elevation == nullptr)
   {
     throw (Exception::PARAMETER_ERROR);
   }
 
-  iterator.CellID = RowCell[y][x].ID;
-  iterator.CurrentIndex = 0u;
-  iterator.AdjacentCellCount = RowCell[y][x].AdjacentCount;
-  Memory_Copy(RowCell[y][x].AdjacentID, iterator.AdjacentCellID);
-}
+  topology.AddReference();
 
-////////////////////////////////////////////////////////////////////////////////
-//! Add cell cellID to vertex vertexID.
-////////////////////////////////////////////////////////////////////////////////
-void IcosMap::AddVertexCellID(U16 vertexID, U16 cellID) throw ()
-{
-  VertexCell[vertexID] = cellID;
+  Attach(&topology, elevation);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-//! Add cell cellID to edge edgeID.
+// (See IcosCell.h)
 ////////////////////////////////////////////////////////////////////////////////
-void IcosMap::AddEdgeCellID(U16 edgeID, U16 cellID) throw ()
+U16 IcosMap::GetCellCount() const throw ()
 {
-  EdgeCell[edgeID][EdgeCellCount[edgeID]] = cellID;
-  EdgeCellCount[edgeID]++;
+  return (Topology != nullptr) ? Topology->GetCellCount() : 0u;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-//! Add cell cellID to face faceID.
+// (See IcosCell.h)
 ////////////////////////////////////////////////////////////////////////////////
-void IcosMap::AddFaceCellID(U16 faceID, U16 cellID) throw ()
+U16 IcosMap::GetCellID(S16 x, U16 y) throw (Exception::Type)
 {
-  FaceCell[faceID][FaceCellCount[faceID]] = cellID;
-  FaceCellCount[faceID]++;
+  return Topology->GetCellID(x, y);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-//! Calculates the cell type and vertex, edge, or face it belongs to. Must not
-//! be called before cell X and Y attributes are initialized.
-////////////////////////////////////////////////////////////////////////////////
-void IcosMap::CalculateCellTypeAndTypeID(U16 cellID) throw ()
-{
-  U16 x = Cell[cellID].X;
-  U16 y = Cell[cellID].Y;
-
-  U16 cellType = IcosCell::TYPE_NONE;
-  U16 cellTypeID = 0u;
-
-  if (y == 0)
-  {
-    cellType = IcosCell::TYPE_VERTEX;
-    cellTypeID = 0;
-  }
-  else if (y < Size)
-  {
-    if ((x % y) == 0)
-    {
-      cellType = IcosCell::TYPE_EDGE;
-    }
-    else
-    {
-      cellType = IcosCell::TYPE_FACE;
-    }
-    cellTypeID = (x / y);
-  }
-  else if (y == Size)
-  {
-    if ((x % Size) == 0)
-    {
-      cellType = IcosCell::TYPE_VERTEX;
-      cellTypeID = 1;
-    }
-    else
-    {
-      cellType = IcosCell::TYPE_EDGE;
-      cellTypeID = 5;
-    }
-    cellTypeID += (x / Size);
-  }
-  else if (y < (2 * Size))
-  {
-    U8 even = (2 * Size) - y;
-    U8 odd = y - Size;
-    U8 nextEdge = 0;
-    if (x == nextEdge)
-    {
-      cellType = IcosCell::TYPE_EDGE;
-      cellTypeID = 10;
-    }
-    else if (x < (nextEdge += even))
-    {
-      cellType = IcosCell::TYPE_FACE;
-      cellTypeID = 5;
-    }
-    else if (x == nextEdge)
-    {
-      cellType = IcosCell::TYPE_EDGE;
-      cellTypeID = 11;
-    }
-    else if (x < (nextEdge += odd))
-    {
-      cellType = IcosCell::TYPE_FACE;
-      cellTypeID = 6;
-    }
-    else if (x == nextEdge)
-    {
-      cellType = IcosCell::TYPE_EDGE;
-      cellTypeID = 12;
-    }
-    else if (x < (nextEdge += even))
-    {
-      cellType = IcosCell::TYPE_FACE;
-      cellTypeID = 7;
-    }
-    else if (x == nextEdge)
-    {
-      cellType = IcosCell::TYPE_EDGE;
-      cellTypeID = 13;
-    }
-    else if (x < (nextEdge += odd))
-    {
-      cellType = IcosCell::TYPE_FACE;
-      cellTypeID = 8;
-    }
-    else if (x == nextEdge)
-    {
-      cellType = IcosCell::TYPE_EDGE;
-      cellTypeID = 14;
-    }
-    else if (x < (nextEdge += even))
-    {
-      cellType = IcosCell::TYPE_FACE;
-      cellTypeID = 9;
-    }
-    else if (x == nextEdge)
-    {
-      cellType = IcosCell::TYPE_EDGE;
-      cellTypeID = 15;
-    }
-    else if (x < (nextEdge += odd))
-    {
-      cellType = IcosCell::TYPE_FACE;
-      cellTypeID = 10;
-    }
-    else if (x == nextEdge)
-    {
-      cellType = IcosCell::TYPE_EDGE;
-      cellTypeID = 16;
-    }
-    else if (x < (nextEdge += even))
-    {
-      cellType = IcosCell::TYPE_FACE;
-      cellTypeID = 11;
-    }
-    else if (x == nextEdge)
-    {
-      cellType = IcosCell::TYPE_EDGE;
-      cellTypeID = 17;
-    }
-    else if (x < (nextEdge += odd))
-    {
-      cellType = IcosCell::TYPE_FACE;
-      cellTypeID = 12;
-    }
-    else if (x == nextEdge)
-    {
-      cellType = IcosCell::TYPE_EDGE;
-      cellTypeID = 18;
-    }
-    else if (x < (nextEdge += even))
-    {
-      cellType = IcosCell::TYPE_FACE;
-      cellTypeID = 13;
-    }
-    else if (x == nextEdge)
-    {
-      cellType = IcosCell::TYPE_EDGE;
-      cellTypeID = 19;
-    }
-    else
-    {
-      cellType = IcosCell::TYPE_FACE;
-      cellTypeID = 14;
-    }
-  }
-  else if (y == (2 * Size))
-  {
-    if ((x % Size) == 0)
-    {
-      cellType = IcosCell::TYPE_VERTEX;
-      cellTypeID = 6;
-    }
-    else
-    {
-      cellType = IcosCell::TYPE_EDGE;
-      cellTypeID = 20;
-    }
-    cellTypeID += (x / Size);
-  }
-  else if (y < (RowCount - 1))
-  {
-    if ((x % (RowCount - y - 1)) == 0)
-    {
-      cellType = IcosCell::TYPE_EDGE;
-      cellTypeID = 25;
-    }
-    else
-    {
-      cellType = IcosCell::TYPE_FACE;
-      cellTypeID = 15;
-    }
-    cellTypeID += (x / (RowCount - y - 1));
-  }
-  else
-  {
-    cellType = IcosCell::TYPE_VERTEX;
-    cellTypeID = 11;
-  }
-
-  if (IcosCell::TYPE_VERTEX == cellType)
-  {
-    AddVertexCellID(cellTypeID, cellID);
-  }
-  else if (IcosCell::TYPE_EDGE == cellType)
-  {
-    AddEdgeCellID(cellTypeID, cellID);
-  }
-  else if (IcosCell::TYPE_FACE == cellType)
-  {
-    AddFaceCellID(cellTypeID, cellID);
-  }
-
-  Cell[cellID].Type = cellType;
-  Cell[cellID].TypeID = cellTypeID;
-}
-
-////////////////////////////////////////////////////////////////////////////////
-//! Calculates the cell latitude and longitude for vertex cells.
+// (See IcosCell.h)
 ////////////////////////////////////////////////////////////////////////////////
-void IcosMap::CalculateLatitudeLongitudeForVertexCells() throw ()
+U16 IcosMap::GetCellType(U16 x, U16 y) throw (Exception::Type)
 {
-  for (U16 i = 0; i < VERTEX_COUNT; ++i)
-  {
-    U16 cellID = VertexCell[i];
-
-    Cell[cellID].Coordinates = ICOS_VERTEX[i];
-    // Assign normal vector.
-    Cell[cellID].Normal = Vector(Cell[cellID].Coordinates);
-    Cell[cellID].Elevation = 0.0f;
-  }
+  return Topology->GetCell(x, y).Type;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-//! Calculates the cell latitude and longitude for edge cells.
+// (See IcosCell.h)
 ////////////////////////////////////////////////////////////////////////////////
-void IcosMap::CalculateLatitudeLongitudeForEdgeCells() throw ()
+U16 IcosMap::GetCellTypeID(U16 x, U16 y) throw (Exception::Type)
 {
-  if (0u < ExpectedEdgeCellCount)
-  {
-    for (U16 i = 0; i < EDGE_COUNT; ++i)
-    {
-      // Get vertex IDs.
-      U16 vertexID1 = ICOS_EDGE[i].V1;
-      U16 vertexID2 = ICOS_EDGE[i].V2;
-      // Convert vertex latitude longitude to Cartesian vector.
-      Vector vectorID1(ICOS_VERTEX[vertexID1]);
-      Vector vectorID2(ICOS_VERTEX[vertexID2]);
-      // Calculate angle between vertices.
-      F32 angleID1toID2 = Vector::LeastAngleRadians(vectorID1, vectorID2);
-      // Calculate angle between edge cells.
-      F32 angleBetweenCells = angleID1toID2 / (ExpectedEdgeCellCount + 1);
-      // Calculate axis of rotation.
-      RotationAxis axisOfRotation = Vector::CrossProduct(vectorID1, vectorID2);
-
-      // Calculate latitude and longitude of each edge cell.
-      for (U16 j = 0; j < ExpectedEdgeCellCount; ++j)
-      {
-        U16 cellID = EdgeCell[i][j];
-
-        // Calculate angle of rotation that will rotate vertex ID1 to the edge cell.
-        F32 angleOfRotation = (j + 1) * angleBetweenCells;
-
-        // Get the rotation matrix that will rotate vertex ID1 to the edge cell.
-        CMatrix rotationMatrix;
-        axisOfRotation.GetRotationMatrix(angleOfRotation, rotationMatrix);
-
-        // Rotate vertex ID1.
-        Vector rotatedVertexID1;
-        rotationMatrix.Multiply(vectorID1, rotatedVertexID1);
-
-        // Assign latitude and longitude to edge cell.
-        Cell[cellID].Coordinates = rotatedVertexID1;
-        // Assign normal vector.
-        Cell[cellID].Normal = Vector(Cell[cellID].Coordinates);
-        Cell[cellID].Elevation = 0.0f;
-      }
-    }
-  }
+  return Topology->GetCell(x, y).TypeID;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-//! Calculates the cell latitude and longitude for face cells.
+// (See IcosCell.h)
 ////////////////////////////////////////////////////////////////////////////////
-void IcosMap::CalculateLatitudeLongitudeForFaceCells() throw ()
+Coordinates::UnitSphereDegrees
+IcosMap::GetCoordinates(
+    U16 x,
+    U16 y
+    ) throw (Exception::Type)
 {
-  if ((0u < ExpectedEdgeCellCount) && (0u < ExpectedFaceCellCount))
-  {
-    for (U16 i = 0; i < FACE_COUNT; ++i)
-    {
-      U16 edgeID1 = ICOS_FACE[i].E1; // west most edge
-      U16 edgeID2 = ICOS_FACE[i].E2; // east most edge
-      U16 faceCellIndex = 0;
-
-      if (!ICOS_FACE[i].Inverted)
-      {
-        // iterate over each row, the first row has no face cells and vertex rows
-        // are not counted so start with second row.
-        for (U16 row = 1; row < ExpectedEdgeCellCount; ++row)
-        {
-          // Get coordinates of edge cells
-          U16 westCellID = EdgeCell[edgeID1][row];
-          U16 eastCellID = EdgeCell[edgeID2][row];
-          Coordinates::UnitSphereDegrees westCoordinates = Cell[westCellID].Coordinates;
-          Coordinates::UnitSphereDegrees eastCoordinates = Cell[eastCellID].Coordinates;
-          // number of cells in each row is equal to the row: 1, 2, 3, 4. Think
-          // of a pyramid to visualize this, with row 1 at the top, and row N at
-          // the bottom.
-          Vector westVector(westCoordinates);
-          Vector eastVector(eastCoordinates);
-          // Calculate angle between vertices.
-          F32 angleWesttoEast = Vector::LeastAngleRadians(westVector, eastVector);
-          // Calculate angle between face cells.
-          F32 angleBetweenCells = angleWesttoEast / (row + 1);
-          // Calculate axis of rotation.
-          RotationAxis axisOfRotation = Vector::CrossProduct(westVector, eastVector);
-
-          // Calculate latitude and longitude of each face cell in this row.
-          for (U16 j = 0; j < row; ++j)
-          {
-            U16 cellID = FaceCell[i][faceCellIndex];
-
-            // Calculate angle of rotation that will rotate West vector to the face cell.
-            F32 angleOfRotation = (j + 1) * angleBetweenCells;
-
-            // Get the rotation matrix that will rotate West to the face cell.
-            CMatrix rotationMatrix;
-            axisOfRotation.GetRotationMatrix(angleOfRotation, rotationMatrix);
-
-            // Rotate West vector.
-            Vector rotatedWestVector;
-            rotationMatrix.Multiply(westVector, rotatedWestVector);
-
-            // Assign latitude and longitude to edge cell.
-            Cell[cellID].Coordinates = rotatedWestVector;
-            // Assign normal vector.
-            Cell[cellID].Normal = Vector(Cell[cellID].Coordinates);
-            Cell[cellID].Elevation = 0.0f;
-
-            faceCellIndex++;
-          }
-        }
-      }
-      else
-      {
-        // iterate over each row, the last row has no face cells and vertex rows
-        // are not counted.
-        for (U16 row = 0; row < (ExpectedEdgeCellCount-1u); ++row)
-        {
-          // Get coordinates of edge cells
-          U16 westCellID = EdgeCell[edgeID1][row];
-          U16 eastCellID = EdgeCell[edgeID2][row];
-          Coordinates::UnitSphereDegrees westCoordinates = Cell[westCellID].Coordinates;
-          Coordinates::UnitSphereDegrees eastCoordinates = Cell[eastCellID].Coordinates;
-          // the number of cells in each row is equal to the number of edge cells
-          // minus the row: 4, 3, 2, 1. Think of an inverted pyramid to visualize
-          // this, with row 1 at the top, and row N at the bottom.
-          Vector westVector(westCoordinates);
-          Vector eastVector(eastCoordinates);
-          // Calculate angle between vertices.
-          F32 angleWesttoEast = Vector::LeastAngleRadians(westVector, eastVector);
-          // Calculate angle between face cells.
-          F32 angleBetweenCells = angleWesttoEast / (ExpectedEdgeCellCount - row);
-          // Calculate axis of rotation.
-          RotationAxis axisOfRotation = Vector::CrossProduct(westVector, eastVector);
-
-          // Calculate latitude and longitude of each face cell in this row.
-          for (U16 j = 0; j < (ExpectedEdgeCellCount-1u - row); ++j)
-          {
-            U16 cellID = FaceCell[i][faceCellIndex];
-
-            // Calculate angle of rotation that will rotate West vector to the face cell.
-            F32 angleOfRotation = (j + 1) * angleBetweenCells;
-
-            // Get the rotation matrix that will rotate West to the face cell.
-            CMatrix rotationMatrix;
-            axisOfRotation.GetRotationMatrix(angleOfRotation, rotationMatrix);
-
-            // Rotate West vector.
-            Vector rotatedWestVector;
-            rotationMatrix.Multiply(westVector, rotatedWestVector);
-
-            // assign latitude and longitude to edge cell
-            Cell[cellID].Coordinates = rotatedWestVector;
-            // assign normal vector
-            Cell[cellID].Normal = Vector(Cell[cellID].Coordinates);
-            Cell[cellID].Elevation = 0.0f;
-
-            faceCellIndex++;
-          }
-        }
-      }
-    }
-  }
+  return Topology->GetCell(x, y).Coordinates;
 }
 
-////////////////////////////////////////////////////////////////////////////////
-//! Calculates the adjacent cells for each vertex cell.
-////////////////////////////////////////////////////////////////////////////////
 void
-IcosMap::CalculateAdjacentCellsForVertexCells(
-    ) throw ()
+IcosMap::GetAdjacentCellIDs(
+    const U16 x,
+    const U16 y,
+    AdjacentCellIterator & iterator
+    ) const throw (Exception::Type)
 {
-  // All of these cells only have 5 neighbors.
-
-  // North Pole Cell
-  U16 cellID = VertexCell[0];
-  // Order adjacent IDs so the form a triangle fan with right hand rotation.
-  Cell[cellID].AddAdjacentCellID(1);
-  Cell[cellID].AddAdjacentCellID(2);
-  Cell[cellID].AddAdjacentCellID(3);
-  Cell[cellID].AddAdjacentCellID(4);
-  Cell[cellID].AddAdjacentCellID(5);
-
-  // Northern Equatorial Cells
-  for (U16 i = 1; i <= 5; ++i)
-  {
-    cellID = VertexCell[i];
-    U16 x = Cell[cellID].X;
-    U16 y = Cell[cellID].Y;
-    // Order adjacent IDs so the form a triangle fan with right hand rotation.
-    Cell[cellID].AddAdjacentCellID(GetCellID((x/y)*(y-1u)   ,y-1u));
-    Cell[cellID].AddAdjacentCellID(GetCellID(x-1u           ,y  ));
-    Cell[cellID].AddAdjacentCellID(GetCellID(x-1u           ,y+1u));
-    Cell[cellID].AddAdjacentCellID(GetCellID(x              ,y+1u));
-    Cell[cellID].AddAdjacentCellID(GetCellID(x+1u           ,y  ));
-  }
+  const IcosCell & cell = Topology->GetCell(x, y);
 
-  // Southern Equatorial Cells
-  for (U16 i = 6; i <= 10; ++i)
-  {
-    cellID = VertexCell[i];
-    U16 x = Cell[cellID].X;
-    U16 y = Cell[cellID].Y;
-    // Order adjacent IDs so the form a triangle fan with right hand rotation.
-    Cell[cellID].AddAdjacentCellID(GetCellID(x                                                   ,y-1u));
-    Cell[cellID].AddAdjacentCellID(GetCellID(x-1u                                                ,y  ));
-    Cell[cellID].AddAdjacentCellID(GetCellID((x/((RowCount-1u)-(y   )))*((RowCount-1u)-(y+1u))   ,y+1u));
-    Cell[cellID].AddAdjacentCellID(GetCellID(x+1u                                                ,y  ));
-    Cell[cellID].AddAdjacentCellID(GetCellID(x+1u                                                ,y-1u));
-  }
-
-  // Vertex 11 always has neighbors (CellCount-6) to (CellCount-2)
-  cellID = VertexCell[11];
-  // Order adjacent IDs so the form a triangle fan with right hand rotation.
-  Cell[cellID].AddAdjacentCellID(CellCount-6);
-  Cell[cellID].AddAdjacentCellID(CellCount-5);
-  Cell[cellID].AddAdjacentCellID(CellCount-4);
-  Cell[cellID].AddAdjacentCellID(CellCount-3);
-  Cell[cellID].AddAdjacentCellID(CellCount-2);
+  iterator.CellID = cell.ID;
+  iterator.CurrentIndex = 0u;
+  iterator.AdjacentCellCount = cell.AdjacentCount;
+  Memory_Copy(cell.AdjacentID, iterator.AdjacentCellID);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-//! Calculates the adjacent cells for each edge cell.
+//! Generates elevations using a displacement algorithm.
 ////////////////////////////////////////////////////////////////////////////////
-void
-IcosMap::CalculateAdjacentCellsForEdgeCells(
-    ) throw ()
+void IcosMap::GenerateElevations_Displacement(U64 seed, F32 elevation[]) const throw ()
 {
-  // Northern Pole Edges
-  for (U16 i = 0; i <= 4; ++i)
-  {
-    for (U16 j = 0; j < ExpectedEdgeCellCount; ++j)
-    {
-      U16 cellID = EdgeCell[i][j];
-      U16 x = Cell[cellID].X;
-      U16 y = Cell[cellID].Y;
-      // Order adjacent IDs so the form a triangle fan with right hand rotation.
-      Cell[cellID].AddAdjacentCellID(GetCellID((x/y)*(y-1u)   ,y-1u));
-      Cell[cellID].AddAdjacentCellID(GetCellID(x-1u           ,y  ));
-      Cell[cellID].AddAdjacentCellID(GetCellID((x/y)*(y+1u)-1u,y+1u));
-      Cell[cellID].AddAdjacentCellID(GetCellID((x/y)*(y+1u)   ,y+1u));
-      Cell[cellID].AddAdjacentCellID(GetCellID((x/y)*(y+1u)+1u,y+1u));
-      Cell[cellID].AddAdjacentCellID(GetCellID(x+1u           ,y  ));
-    }
-  }
+  NumberGenerator rand;
 
-  // Northern Belt Edges
-  for (U16 i = 5; i <= 9; ++i)
-  {
-    for (U16 j = 0; j < ExpectedEdgeCellCount; ++j)
-    {
-      U16 cellID = EdgeCell[i][j];
-      U16 x = Cell[cellID].X;
-      U16 y = Cell[cellID].Y;
-      // Order adjacent IDs so the form a triangle fan with right hand rotation.
-      Cell[cellID].AddAdjacentCellID(GetCellID((x%y)+(x/y)*(y-1u)-1u,y-1u));
-      Cell[cellID].AddAdjacentCellID(GetCellID(x-1u                 ,y  ));
-      Cell[cellID].AddAdjacentCellID(GetCellID(x-1u                 ,y+1u));
-      Cell[cellID].AddAdjacentCellID(GetCellID(x                    ,y+1u));
-      Cell[cellID].AddAdjacentCellID(GetCellID(x+1u                 ,y  ));
-      Cell[cellID].AddAdjacentCellID(GetCellID((x%y)+(x/y)*(y-1u)   ,y-1u));
-    }
-  }
+  rand.Seed(seed);
 
-  // Equatorial Edges
-  for (U16 i = 10; i <= 19; ++i)
-  {
-    for (U16 j = 0; j < ExpectedEdgeCellCount; ++j)
-    {
-      U16 cellID = EdgeCell[i][j];
-      U16 x = Cell[cellID].X;
-      U16 y = Cell[cellID].Y;
-      // order adjacent IDs so the form a triangle fan
-      Cell[cellID].AddAdjacentCellID(GetCellID(x  ,y-1));
-      Cell[cellID].AddAdjacentCellID(GetCellID(x-1,y  ));
-      Cell[cellID].AddAdjacentCellID(GetCellID(x-1,y+1));
-      Cell[cellID].AddAdjacentCellID(GetCellID(x  ,y+1));
-      Cell[cellID].AddAdjacentCellID(GetCellID(x+1,y  ));
-      Cell[cellID].AddAdjacentCellID(GetCellID(x+1,y-1));
-    }
-  }
+  static const U16 ITERATIONS = 5000;
+//  static const U16 ITERATIONS = 10;
 
-  // Southern Belt Edges
-  for (U16 i = 20; i <= 24; ++i)
-  {
-    for (U16 j = 0; j < ExpectedEdgeCellCount; ++j)
-    {
-      U16 cellID = EdgeCell[i][j];
-      U16 x = Cell[cellID].X;
-      U16 y = Cell[cellID].Y;
-      // Order adjacent IDs so the form a triangle fan with right hand rotation.
-      Cell[cellID].AddAdjacentCellID(GetCellID(x                                                                         ,y-1u));
-      Cell[cellID].AddAdjacentCellID(GetCellID(x-1u                                                                      ,y   ));
-      Cell[cellID].AddAdjacentCellID(GetCellID((x%((RowCount-1u)-y))+(x/((RowCount-1u)-(y   )))*((RowCount-1u)-(y+1u))-1u,y+1u));
-      Cell[cellID].AddAdjacentCellID(GetCellID((x%((RowCount-1u)-y))+(x/((RowCount-1u)-(y   )))*((RowCount-1u)-(y+1u))   ,y+1u));
-      Cell[cellID].AddAdjacentCellID(GetCellID(x+1u                                                                      ,y   ));
-      Cell[cellID].AddAdjacentCellID(GetCellID(x+1u                                                                      ,y-1u));
-    }
-  }
+  // Random numbers are drawn in bulk, enough for a chunk of iterations at a
+  // time: three for the origin followed by three for the direction.
+  static const U16 CHUNK_ITERATIONS = 64;
+  static const U16 NUMBERS_PER_ITERATION = 6;
+  U32 number[CHUNK_ITERATIONS * NUMBERS_PER_ITERATION];
 
-  // Southern Pole Edges
-  for (U16 i = 25; i <= 29; ++i)
-  {
-    for (U16 j = 0; j < ExpectedEdgeCellCount; ++j)
-    {
-      U16 cellID = EdgeCell[i][j];
-      U16 x = Cell[cellID].X;
-      U16 y = Cell[cellID].Y;
-      // Order adjacent IDs so the form a triangle fan with right hand rotation.
-      Cell[cellID].AddAdjacentCellID(GetCellID((x/((RowCount-1u)-(y   )))*((RowCount-1u)-(y-1u))   ,y-1u));
-      Cell[cellID].AddAdjacentCellID(GetCellID((x/((RowCount-1u)-(y   )))*((RowCount-1u)-(y-1u))-1u,y-1u));
-      Cell[cellID].AddAdjacentCellID(GetCellID(x-1u                                                ,y  ));
-      Cell[cellID].AddAdjacentCellID(GetCellID((x/((RowCount-1u)-(y   )))*((RowCount-1u)-(y+1u))   ,y+1u));
-      Cell[cellID].AddAdjacentCellID(GetCellID(x+1u                                                ,y  ));
-      Cell[cellID].AddAdjacentCellID(GetCellID((x/((RowCount-1u)-(y   )))*((RowCount-1u)-(y-1u))+1u,y-1u));
-    }
-  }
-}
+  const U16 cellCount = GetCellCount();
+  const IcosCell * cell = &Topology->GetCell(0u);
 
-////////////////////////////////////////////////////////////////////////////////
-//! Calculates the adjacent cells for each face cell.
-////////////////////////////////////////////////////////////////////////////////
-void
-IcosMap::CalculateAdjacentCellsForFaceCells(
-    ) throw ()
-{
-  // Northern Pole Faces
-  for (U16 i = 0; i <= 4; ++i)
+  for (U16 j = 0; j < cellCount; ++j)
   {
-    for (U16 j = 0; j < ExpectedFaceCellCount; ++j)
-    {
-      U16 cellID = FaceCell[i][j];
-      U16 x = Cell[cellID].X;
-      U16 y = Cell[cellID].Y;
-      // Order adjacent IDs so the form a triangle fan with right hand rotation.
-      Cell[cellID].AddAdjacentCellID(GetCellID((x%y)+(x/y)*(y-1u)-1u,y-1u));
-      Cell[cellID].AddAdjacentCellID(GetCellID(x-1u                 ,y  ));
-      Cell[cellID].AddAdjacentCellID(GetCellID((x%y)+(x/y)*(y+1u)   ,y+1u));
-      Cell[cellID].AddAdjacentCellID(GetCellID((x%y)+(x/y)*(y+1u)+1u,y+1u));
-      Cell[cellID].AddAdjacentCellID(GetCellID(x+1u                 ,y  ));
-      Cell[cellID].AddAdjacentCellID(GetCellID((x%y)+(x/y)*(y-1u)   ,y-1u));
-    }
+    elevation[j] = 0.0f;
   }
 
-  // Equatorial Faces
-  for (U16 i = 5; i <= 14; ++i)
+  for (U16 i = 0; i < ITERATIONS; ++i)
   {
-    for (U16 j = 0; j < ExpectedFaceCellCount; ++j)
-    {
-      U16 cellID = FaceCell[i][j];
-      U16 x = Cell[cellID].X;
-      U16 y = Cell[cellID].Y;
-      // Order adjacent IDs so the form a triangle fan with right hand rotation.
-      Cell[cellID].AddAdjacentCellID(GetCellID(x  ,y-1));
-      Cell[cellID].AddAdjacentCellID(GetCellID(x+1,y-1));
-      Cell[cellID].AddAdjacentCellID(GetCellID(x+1,y  ));
-      Cell[cellID].AddAdjacentCellID(GetCellID(x  ,y+1));
-      Cell[cellID].AddAdjacentCellID(GetCellID(x-1,y+1));
-      Cell[cellID].AddAdjacentCellID(GetCellID(x-1,y  ));
-    }
-  }
+    U16 chunkIndex = i % CHUNK_ITERATIONS;
 
-  // Southern Pole Faces
-  // Rows in these faces slope to the east from top to bottom.
-  for (U16 i = 15; i <= 19; ++i)
-  {
-    for (U16 j = 0; j < ExpectedFaceCellCount; ++j)
+    if (0 == chunkIndex)
     {
-      U16 cellID = FaceCell[i][j];
-      U16 x = Cell[cellID].X;
-      U16 y = Cell[cellID].Y;
-      // Order adjacent IDs so the form a triangle fan with right hand rotation.
-      Cell[cellID].AddAdjacentCellID(GetCellID((x%((RowCount-1u)-(y   )))+(x/((RowCount-1u)-(y   )))*((RowCount-1u)-(y-1u))   ,y-1u));
-      Cell[cellID].AddAdjacentCellID(GetCellID(x-1u                                                                 ,y  ));
-      Cell[cellID].AddAdjacentCellID(GetCellID((x%((RowCount-1u)-(y   )))+(x/((RowCount-1u)-(y   )))*((RowCount-1u)-(y+1u))-1u,y+1u));
-      Cell[cellID].AddAdjacentCellID(GetCellID((x%((RowCount-1u)-(y   )))+(x/((RowCount-1u)-(y   )))*((RowCount-1u)-(y+1u))   ,y+1u));
-      Cell[cellID].AddAdjacentCellID(GetCellID(x+1u                                                                 ,y  ));
-      Cell[cellID].AddAdjacentCellID(GetCellID((x%((RowCount-1u)-(y   )))+(x/((RowCount-1u)-(y   )))*((RowCount-1u)-(y-1u))+1u,y-1u));
+      U16 chunkIterations = ITERATIONS - i;
+      if (CHUNK_ITERATIONS < chunkIterations) chunkIterations = CHUNK_ITERATIONS;
+      rand.FillU32(number, chunkIterations * NUMBERS_PER_ITERATION);
     }
-  }
-}
 
-////////////////////////////////////////////////////////////////////////////////
-//! Checks all edge cell counts for equality.
-////////////////////////////////////////////////////////////////////////////////
-void IcosMap::CheckEdgeCellCounts() throw (Exception::Type)
-{
-  for (U16 i = 0; i < EDGE_COUNT; ++i)
-  {
-    if (EdgeCellCount[i] != ExpectedEdgeCellCount)
-    {
-      throw (Exception::INITIALIZATION_ERROR);
-    }
-  }
-}
+    const U32 * n = &number[chunkIndex * NUMBERS_PER_ITERATION];
 
-////////////////////////////////////////////////////////////////////////////////
-//! Check all face cell counts for equality.
-////////////////////////////////////////////////////////////////////////////////
-void IcosMap::CheckFaceCellCounts() throw (Exception::Type)
-{
-  for (U16 i = 0; i < FACE_COUNT; ++i)
-  {
-    if (FaceCellCount[i] != ExpectedFaceCellCount)
-    {
-      throw (Exception::INITIALIZATION_ERROR);
-    }
-  }
-}
-
-////////////////////////////////////////////////////////////////////////////////
-//! Generates elevations using a displacement algorithm.
-////////////////////////////////////////////////////////////////////////////////
-void IcosMap::GenerateElevations_Displacement() throw ()
-{
-  NumberGenerator rand;
-
-  rand.Seed(45234523U);
-
-  static const U16 ITERATIONS = 5000;
-//  static const U16 ITERATIONS = 10;
-
-  for (U16 i = 0; i < ITERATIONS; ++i)
-  {
-    Vector origin = Vector((rand.GenerateF64()-0.5f), (rand.GenerateF64()-0.5f), (rand.GenerateF64()-0.5f));
+    Vector origin = Vector((UnitF64(n[0])-0.5f), (UnitF64(n[1])-0.5f), (UnitF64(n[2])-0.5f));
     origin.Normalize();
 
-    Vector direction = Vector((rand.GenerateF64()-0.5f), (rand.GenerateF64()-0.5f), (rand.GenerateF64()-0.5f));
+    Vector direction = Vector((UnitF64(n[3])-0.5f), (UnitF64(n[4])-0.5f), (UnitF64(n[5])-0.5f));
     direction.Normalize();
 
-    for (U16 j = 0; j < CellCount; ++j)
+    for (U16 j = 0; j < cellCount; ++j)
     {
       // Calculate vector from origin to cell center
-      Vector originDifference = Cell[j].Normal - origin;
+      Vector originDifference = cell[j].Normal - origin;
       // calculate dot product of direction and that vector
       F32 dotProduct = direction * originDifference;
       // if result greater than zero raise elevation of cell by X
       if (dotProduct > 0.0)
       {
-        Cell[j].Elevation += 1.0;
+        elevation[j] += 1.0;
       }
     }
   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-//! Generates elevations using a displacement algorithm.
+//! Scales elevations into the range [0,1].
 ////////////////////////////////////////////////////////////////////////////////
-void IcosMap::GenerateElevations() throw ()
+void IcosMap::GenerateElevations_Normalize(F32 elevation[]) const throw ()
 {
-  GenerateElevations_Displacement();
+  const U16 cellCount = GetCellCount();
 
-  // Normalize elevations.
   F32 minElev = (F32)100000000;
   F32 maxElev = 0.0f;
 
-  for (U16 j = 0; j < CellCount; ++j)
+  for (U16 j = 0; j < cellCount; ++j)
   {
-    if (Cell[j].Elevation < minElev) minElev = Cell[j].Elevation;
-    if (Cell[j].Elevation > maxElev) maxElev = Cell[j].Elevation;
+    if (elevation[j] < minElev) minElev = elevation[j];
+    if (elevation[j] > maxElev) maxElev = elevation[j];
   }
 
   F32 scaleElev = maxElev - minElev;
 
-  for (U16 j = 0; j < CellCount; ++j)
+  for (U16 j = 0; j < cellCount; ++j)
   {
-    Cell[j].Elevation -= minElev;
-    Cell[j].Elevation /= scaleElev;
+    elevation[j] -= minElev;
+    elevation[j] /= scaleElev;
   }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMap.h)
+////////////////////////////////////////////////////////////////////////////////
+void IcosMap::GenerateElevations() throw ()
+{
+  GenerateElevations(DEFAULT_SEED);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMap.h)
+////////////////////////////////////////////////////////////////////////////////
+void IcosMap::GenerateElevations(U64 seed) throw ()
+{
+  GenerateElevations(seed, Elevation);
+  MarkDirty(0u, GetCellCount());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMap.h)
+////////////////////////////////////////////////////////////////////////////////
+void IcosMap::GenerateElevations(U64 seed, F32 elevation[]) const throw ()
+{
+  GenerateElevations_Displacement(seed, elevation);
+  GenerateElevations_Normalize(elevation);
+}
+
 /* *****************************************************************************
  *
  * Copyright (C) 2014, 2019 by owner of https://github.com/JDubs-S.
@@ -19,13 +19,28 @@
  * Chagne Date        Description
  * -----------------------------------------------------------------------------
  * Aug 19, 2019 |---| added license notice
+ * Oct 19, 2026 |---| added seeded elevation generation into external storage
+ * Oct 19, 2026 |---| added edge cell lookup for patch decomposition
+ * Oct 19, 2026 |---| arrays may point into a mapped map file
+ * Oct 19, 2026 |---| topology may be shared through IcosTopologyCache
+ * Oct 19, 2026 |---| split topology into shared IcosTopology
+ * Oct 19, 2026 |---| added access to the elevation column
+ * Oct 19, 2026 |---| elevation column may be written by importers
+ * Oct 19, 2026 |---| added dirty block tracking of the fields
+ * Oct 19, 2026 |---| elevation may live in caller storage
  *
  * ****************************************************************************/
 
 #include "Exception.h"
 #include "IcosCell.h"
+#include "IcosTopology.h"
 #include "NativeTypes.h"
 
+////////////////////////////////////////////////////////////////////////////////
+//! One world: a reference to a shared IcosTopology plus the fields of each
+//! cell. Worlds of one size share a single topology, so each costs little more
+//! than its field columns.
+////////////////////////////////////////////////////////////////////////////////
 class IcosMap
 {
 public:
@@ -35,13 +50,39 @@ public:
   ~IcosMap();
 
   //////////////////////////////////////////////////////////////////////////////
-  //! Initializes the map.
+  //! Initializes the map. While IcosTopologyCache is enabled the topology is
+  //! shared read-only with every other map of the same size instead of being
+  //! computed.
   //////////////////////////////////////////////////////////////////////////////
-  static const U8 MIN_SIZE = 1;
-  static const U8 MAX_SIZE = 50;
+  static const U8 MIN_SIZE = IcosTopology::MIN_SIZE;
+  static const U8 MAX_SIZE = IcosTopology::MAX_SIZE;
   void Initialize(U8 size) throw (Exception::Type);
 
-  static const U16 MAX_CELL_COUNT = 10u * MAX_SIZE * MAX_SIZE + 2u;
+  //////////////////////////////////////////////////////////////////////////////
+  //! Initializes the map as a new world on an existing topology.
+  //////////////////////////////////////////////////////////////////////////////
+  void Initialize(const IcosTopology & topology) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Initializes the map as a new world on an existing topology whose
+  //! elevation column lives in caller storage of topology.GetCellCount()
+  //! values, such as a column of an IcosFieldStore. The storage must outlive
+  //! the map's use of it and is not released by the map.
+  //////////////////////////////////////////////////////////////////////////////
+  void Initialize(const IcosTopology & topology, F32 elevation[]) throw (Exception::Type);
+
+  static const U16 MAX_CELL_COUNT = IcosTopology::MAX_CELL_COUNT;
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the topology of an initialized map.
+  //////////////////////////////////////////////////////////////////////////////
+  inline
+  const IcosTopology &
+  GetTopology(
+      ) const throw ()
+  {
+    return *Topology;
+  }
 
   //////////////////////////////////////////////////////////////////////////////
   //! Returns the total number of cells in the map.
@@ -69,7 +110,7 @@ public:
   //////////////////////////////////////////////////////////////////////////////
   Coordinates::UnitSphereDegrees GetCoordinates(U16 x, U16 y) throw (Exception::Type);
 
-  static const U16 MAX_ADJACENT_CELLS = 6u;
+  static const U16 MAX_ADJACENT_CELLS = IcosTopology::MAX_ADJACENT_CELLS;
 
   class AdjacentCellIterator
   {
@@ -105,7 +146,7 @@ public:
       U16 cellId
       ) throw ()
   {
-    return Cell[cellId].Coordinates;
+    return Topology->GetCell(cellId).Coordinates;
   }
 
   inline
@@ -114,7 +155,7 @@ public:
       U16 cellId
       ) throw ()
   {
-    return Cell[cellId].AdjacentCount;
+    return Topology->GetCell(cellId).AdjacentCount;
   }
 
   inline
@@ -124,7 +165,7 @@ public:
       U8 i
       ) throw ()
   {
-    return Cell[cellId].AdjacentID[i];
+    return Topology->GetCell(cellId).AdjacentID[i];
   }
 
   inline
@@ -135,7 +176,8 @@ public:
       U16 i
       )
   {
-    return RowCell[y % RowCount][x % RowCellCount[y % RowCount]].AdjacentID[i % MAX_ADJACENT_CELLS];
+    U16 rowCount = Topology->GetRowCount();
+    return Topology->GetCell(x % Topology->GetRowCellCount(y % rowCount), y % rowCount).AdjacentID[i % MAX_ADJACENT_CELLS];
   }
 
   inline
@@ -144,65 +186,138 @@ public:
       U16 cellID
       ) const throw ()
   {
-    return Cell[cellID];
+    return Topology->GetCell(cellID);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the elevation of a cell.
+  //////////////////////////////////////////////////////////////////////////////
+  inline
+  F32
+  GetElevation(
+      U16 cellID
+      ) const throw ()
+  {
+    return Elevation[cellID];
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the elevation column, one value per cell in cell ID order.
+  //////////////////////////////////////////////////////////////////////////////
+  inline
+  const F32 *
+  GetElevations(
+      ) const throw ()
+  {
+    return Elevation;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the writable elevation column. Callers writing through it must
+  //! MarkDirty() the cells they change.
+  //////////////////////////////////////////////////////////////////////////////
+  inline
+  F32 *
+  GetElevations(
+      ) throw ()
+  {
+    return Elevation;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Sets the elevation of a cell and marks its block dirty.
+  //////////////////////////////////////////////////////////////////////////////
+  inline
+  void
+  SetElevation(
+      U16 cellID,
+      F32 elevation
+      ) throw ()
+  {
+    Elevation[cellID] = elevation;
+    U16 block = cellID / DIRTY_BLOCK_CELL_COUNT;
+    DirtyBlock[block / 64u] |= (1ull << (block % 64u));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! The fields are cut into blocks of DIRTY_BLOCK_CELL_COUNT cells, and a bit
+  //! per block records whether any cell in it changed since the last call to
+  //! ClearDirtyBlocks(). A new world starts with every block dirty.
+  //////////////////////////////////////////////////////////////////////////////
+  static const U16 DIRTY_BLOCK_CELL_COUNT = 64u;
+  static const U16 MAX_DIRTY_BLOCK_COUNT = (MAX_CELL_COUNT + DIRTY_BLOCK_CELL_COUNT - 1u) / DIRTY_BLOCK_CELL_COUNT;
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the number of blocks of the map's fields.
+  //////////////////////////////////////////////////////////////////////////////
+  inline
+  U16
+  GetBlockCount(
+      ) const throw ()
+  {
+    return (GetCellCount() + DIRTY_BLOCK_CELL_COUNT - 1u) / DIRTY_BLOCK_CELL_COUNT;
   }
 
+  inline
+  bool
+  IsBlockDirty(
+      U16 block
+      ) const throw ()
+  {
+    return (0u != (DirtyBlock[block / 64u] & (1ull << (block % 64u))));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Marks the blocks holding cells [firstCellID, firstCellID + cellCount)
+  //! dirty.
+  //////////////////////////////////////////////////////////////////////////////
+  void MarkDirty(U16 firstCellID, U16 cellCount) throw ();
+
+  void ClearDirtyBlocks() throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Seed used by GenerateElevations() when no seed is given.
+  //////////////////////////////////////////////////////////////////////////////
+  static const U64 DEFAULT_SEED = 45234523U;
+
   void GenerateElevations() throw ();
 
+  //////////////////////////////////////////////////////////////////////////////
+  //! Generates elevations from the given seed into the cells of this map.
+  //////////////////////////////////////////////////////////////////////////////
+  void GenerateElevations(U64 seed) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Generates elevations from the given seed into elevation[], which must hold
+  //! GetCellCount() values. The map itself is not modified, so any number of
+  //! threads may generate worlds from one initialized map at the same time.
+  //////////////////////////////////////////////////////////////////////////////
+  void GenerateElevations(U64 seed, F32 elevation[]) const throw ();
+
 private:
 
-  void AddVertexCellID(U16 vertexID, U16 cellID) throw ();
-  void AddEdgeCellID(U16 edgeID, U16 cellID) throw ();
-  void AddFaceCellID(U16 faceID, U16 cellID) throw ();
-  void CalculateCellTypeAndTypeID(U16 cellID) throw ();
-  void CalculateLatitudeLongitudeForVertexCells() throw ();
-  void CalculateLatitudeLongitudeForEdgeCells() throw ();
-  void CalculateLatitudeLongitudeForFaceCells() throw ();
-  void CalculateAdjacentCellsForVertexCells() throw ();
-  void CalculateAdjacentCellsForEdgeCells() throw ();
-  void CalculateAdjacentCellsForFaceCells() throw ();
-  void CheckEdgeCellCounts() throw (Exception::Type);
-  void CheckFaceCellCounts() throw (Exception::Type);
-
-  void GenerateElevations_Displacement() throw ();
+  IcosMap(const IcosMap &);
+  IcosMap & operator=(const IcosMap &);
+
+  friend class IcosMapBatch;
+  friend class IcosMapFile;
+
+  void Attach(const IcosTopology * topology, F32 elevation[]) throw ();
+
+  void GenerateElevations_Displacement(U64 seed, F32 elevation[]) const throw ();
+  void GenerateElevations_Normalize(F32 elevation[]) const throw ();
   void GenerateElevations_Cratering() throw ();
   void GenerateElevations_VolcanicEruptions() throw ();
   void GenerateElevations_PlateTectonics() throw ();
 
-  static const U16 VERTEX_COUNT = 12u;
-  static const U16 EDGE_COUNT = 30u;
-  static const U16 FACE_COUNT = 20u;
-
-  static const U16 MAX_ROW_COUNT = 3u * MAX_SIZE + 1u;
-  static const U16 MAX_EDGE_CELL_COUNT = MAX_SIZE - 1u;
-  static const U16 MAX_FACE_CELL_COUNT = ((MAX_SIZE - 2u) * (MAX_SIZE - 1u)) / 2;
-
-  //! Size of map.
-  U16 Size;
-  //! Total number of cells in map.
-  U16 CellCount;
-  //! Coordinates of each vertex cell.
-  U16 VertexCell[VERTEX_COUNT];
-  //! Expected number of cells in each edge.
-  U16 ExpectedEdgeCellCount;
-  //! Total number of cells in each edge.
-  U16 EdgeCellCount[EDGE_COUNT];
-  //! Coordinates of each edge cell.
-  U16 EdgeCell[EDGE_COUNT][MAX_EDGE_CELL_COUNT];
-  //! Expected number of cells in each face.
-  U16 ExpectedFaceCellCount;
-  //! Total number of cells in each face.
-  U16 FaceCellCount[FACE_COUNT];
-  //! Coordinate of each face cell.
-  U16 FaceCell[FACE_COUNT][MAX_FACE_CELL_COUNT];
-  //! Total number of rows.
-  U16 RowCount;
-  //! Total number of cells in a row.
-  U16 RowCellCount[MAX_ROW_COUNT];
-  //! The cells in this map.
-  IcosCell Cell[MAX_CELL_COUNT];
-  //! Pointers to the first cell of each row.
-  IcosCell* RowCell[MAX_ROW_COUNT];
+  //! Shared cells and tables of this map.
+  const IcosTopology * Topology;
+  //! Elevation of each cell.
+  F32 * Elevation;
+  //! False when Elevation lives in the topology's map file image.
+  bool IsElevationOwned;
+  //! One bit per block of DIRTY_BLOCK_CELL_COUNT cells.
+  U64 DirtyBlock[(MAX_DIRTY_BLOCK_COUNT + 63u) / 64u];
 };
 
 /* *****************************************************************************
@@ -0,0 +1,194 @@
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ *
+ * ****************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "IcosMapBatch.h"
+
+typedef std::chrono::steady_clock Clock;
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the seconds elapsed between two clock readings.
+////////////////////////////////////////////////////////////////////////////////
+static
+F64
+Seconds(
+    const Clock::time_point & start,
+    const Clock::time_point & stop
+    ) throw ()
+{
+  return std::chrono::duration<F64>(stop - start).count();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! State shared by the worker threads of one call to Generate().
+////////////////////////////////////////////////////////////////////////////////
+struct IcosMapBatch::Job
+{
+  const IcosMap * Map;
+  const U64 * Seed;
+  U32 SeedCount;
+  Sink * Output;
+  //! Index of the next seed to be claimed by a worker.
+  std::atomic<U32> NextSeed;
+  //! Serializes calls to Output and updates to Stats.
+  std::mutex Lock;
+  Statistics * Stats;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapBatch.h)
+////////////////////////////////////////////////////////////////////////////////
+IcosMapBatch::IcosMapBatch(
+    const IcosMap & map
+    ) throw ()
+    : Map(map)
+    , Stats()
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapBatch.h)
+////////////////////////////////////////////////////////////////////////////////
+IcosMapBatch::~IcosMapBatch(
+    ) throw ()
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapBatch.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapBatch::Generate(
+    const U64 seed[],
+    U32 seedCount,
+    U32 threadCount,
+    Sink & sink
+    ) throw (Exception::Type)
+{
+  if (! ((nullptr != seed) && (0u < Map.GetCellCount())))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  if (0u == threadCount)
+  {
+    threadCount = std::thread::hardware_concurrency();
+    if (0u == threadCount) threadCount = 1u;
+  }
+
+  if (seedCount < threadCount)
+  {
+    threadCount = (0u < seedCount) ? seedCount : 1u;
+  }
+
+  Stats = Statistics();
+  Stats.ThreadCount = threadCount;
+
+  Job job;
+  job.Map = &Map;
+  job.Seed = seed;
+  job.SeedCount = seedCount;
+  job.Output = &sink;
+  job.NextSeed = 0u;
+  job.Stats = &Stats;
+
+  Clock::time_point start = Clock::now();
+
+  // The calling thread is the last worker.
+  std::vector<std::thread> worker;
+  for (U32 i = 1; i < threadCount; ++i)
+  {
+    worker.push_back(std::thread(Work, &job));
+  }
+
+  Work(&job);
+
+  for (U32 i = 0; i < worker.size(); ++i)
+  {
+    worker[i].join();
+  }
+
+  Stats.ElapsedSeconds = Seconds(start, Clock::now());
+  Stats.WorldsPerSecond = (0.0 < Stats.ElapsedSeconds) ? (Stats.WorldCount / Stats.ElapsedSeconds) : 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapBatch.h)
+////////////////////////////////////////////////////////////////////////////////
+const IcosMapBatch::Statistics &
+IcosMapBatch::GetStatistics(
+    ) const throw ()
+{
+  return Stats;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Claims seeds until none are left, generating each world into storage owned
+//! by this thread.
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapBatch::Work(
+    Job * job
+    ) throw ()
+{
+  const IcosMap & map = *job->Map;
+  U16 cellCount = map.GetCellCount();
+  std::vector<F32> elevation(cellCount);
+
+  F64 displacementSeconds = 0.0;
+  F64 normalizeSeconds = 0.0;
+
+  for (U32 i = job->NextSeed++; i < job->SeedCount; i = job->NextSeed++)
+  {
+    Clock::time_point start = Clock::now();
+    map.GenerateElevations_Displacement(job->Seed[i], &elevation[0]);
+    Clock::time_point displaced = Clock::now();
+    map.GenerateElevations_Normalize(&elevation[0]);
+    Clock::time_point normalized = Clock::now();
+
+    displacementSeconds += Seconds(start, displaced);
+    normalizeSeconds += Seconds(displaced, normalized);
+
+    std::lock_guard<std::mutex> lock(job->Lock);
+    Clock::time_point consuming = Clock::now();
+    job->Output->Consume(job->Seed[i], &elevation[0], cellCount);
+    job->Stats->SinkSeconds += Seconds(consuming, Clock::now());
+    job->Stats->WorldCount++;
+  }
+
+  std::lock_guard<std::mutex> lock(job->Lock);
+  job->Stats->DisplacementSeconds += displacementSeconds;
+  job->Stats->NormalizeSeconds += normalizeSeconds;
+}
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
@@ -0,0 +1,135 @@
+#pragma once
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ *
+ * ****************************************************************************/
+
+
+#include "Exception.h"
+#include "IcosMap.h"
+#include "NativeTypes.h"
+
+////////////////////////////////////////////////////////////////////////////////
+//! Generates many worlds concurrently from one initialized map. The map is only
+//! read, so its topology is set up once and shared by every worker thread. Each
+//! worker owns the elevation storage of the world it is generating.
+////////////////////////////////////////////////////////////////////////////////
+class IcosMapBatch
+{
+public:
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Receives finished worlds. Calls are made one at a time, in the order the
+  //! worlds finish, from whichever worker thread finished the world.
+  //////////////////////////////////////////////////////////////////////////////
+  class Sink
+  {
+  public:
+
+    virtual
+    ~Sink(
+        ) throw ()
+    {
+    }
+
+    virtual
+    void
+    Consume(
+        U64 seed,                 //!< Seed the world was generated from.
+        const F32 elevation[],    //!< Elevation of each cell, valid only during the call.
+        U16 cellCount             //!< Number of values in elevation[].
+        ) throw () = 0;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Throughput and per-stage timings of the last call to Generate(). Stage
+  //! times are summed over all worker threads.
+  //////////////////////////////////////////////////////////////////////////////
+  struct Statistics
+  {
+    U32 WorldCount;
+    U32 ThreadCount;
+    F64 ElapsedSeconds;
+    F64 WorldsPerSecond;
+    F64 DisplacementSeconds;
+    F64 NormalizeSeconds;
+    F64 SinkSeconds;
+  };
+
+  IcosMapBatch(
+      const IcosMap & map   //!< Initialized map shared by all worlds.
+      ) throw ();
+
+  ~IcosMapBatch(
+      ) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Generates one world for each seed and passes each to sink as it finishes.
+  //! A threadCount of zero uses one thread per core.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  Generate(
+      const U64 seed[],
+      U32 seedCount,
+      U32 threadCount,
+      Sink & sink
+      ) throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the statistics of the last call to Generate().
+  //////////////////////////////////////////////////////////////////////////////
+  const Statistics &
+  GetStatistics(
+      ) const throw ();
+
+private:
+
+  struct Job;
+
+  static
+  void
+  Work(
+      Job * job
+      ) throw ();
+
+  const IcosMap & Map;
+
+  Statistics Stats;
+
+private:
+
+  IcosMapBatch(
+      const IcosMapBatch &
+      ) throw ();
+
+  IcosMapBatch &
+  operator=(
+      const IcosMapBatch &
+      ) throw ();
+
+};
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
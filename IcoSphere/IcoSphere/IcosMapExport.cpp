@@ -0,0 +1,674 @@
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ *
+ * ****************************************************************************/
+
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <fcntl.h>
+#include <mutex>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "Compression.h"
+#include "IcosMapExport.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static const char MAGIC[8] = "ICOSCOL";
+
+//! Columns written by IcosMapExport::Write(), in file order.
+enum ColumnID
+{
+  COLUMN_X,
+  COLUMN_Y,
+  COLUMN_TYPE,
+  COLUMN_TYPE_ID,
+  COLUMN_ADJACENT_COUNT,
+  COLUMN_ADJACENT_ID,
+  COLUMN_LATITUDE,
+  COLUMN_LONGITUDE,
+  COLUMN_ELEVATION,
+  COLUMN_COUNT
+};
+
+struct ColumnSpec
+{
+  const char * Name;
+  U8 ValueType;
+  U8 ValuesPerCell;
+};
+
+static const ColumnSpec COLUMN_SPEC[COLUMN_COUNT] =
+{
+  { "x",              IcosMapExport::TYPE_U16, 1u },
+  { "y",              IcosMapExport::TYPE_U16, 1u },
+  { "type",           IcosMapExport::TYPE_U16, 1u },
+  { "type_id",        IcosMapExport::TYPE_U16, 1u },
+  { "adjacent_count", IcosMapExport::TYPE_U16, 1u },
+  { "adjacent_id",    IcosMapExport::TYPE_U16, IcosCell::MAX_ADJACENT_CELLS },
+  { "latitude",       IcosMapExport::TYPE_F32, 1u },
+  { "longitude",      IcosMapExport::TYPE_F32, 1u },
+  { "elevation",      IcosMapExport::TYPE_F32, 1u },
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the size of one value of a column type, or zero for an unknown type.
+////////////////////////////////////////////////////////////////////////////////
+static
+U32
+GetValueBytes(
+    U8 valueType
+    ) throw ()
+{
+  switch (valueType)
+  {
+    case IcosMapExport::TYPE_U16: return sizeof(U16);
+    case IcosMapExport::TYPE_F32: return sizeof(F32);
+    default: return 0u;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the number of blocks that hold cellCount cells.
+////////////////////////////////////////////////////////////////////////////////
+static
+U32
+CountBlocks(
+    U32 cellCount,
+    U32 blockCellCount
+    ) throw ()
+{
+  return (cellCount + blockCellCount - 1u) / blockCellCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Copies the values of cells [firstCell, firstCell + cellCount) of a column
+//! into values[].
+////////////////////////////////////////////////////////////////////////////////
+static
+void
+Extract(
+    const IcosMap & map,
+    U32 column,
+    U32 firstCell,
+    U32 cellCount,
+    void * values
+    ) throw ()
+{
+  U16 * u16 = (U16 *)values;
+  F32 * f32 = (F32 *)values;
+
+  for (U32 i = 0; i < cellCount; ++i)
+  {
+    U16 id = (U16)(firstCell + i);
+    const IcosCell & cell = map.GetCell(id);
+
+    switch (column)
+    {
+      case COLUMN_X: u16[i] = cell.X; break;
+      case COLUMN_Y: u16[i] = cell.Y; break;
+      case COLUMN_TYPE: u16[i] = cell.Type; break;
+      case COLUMN_TYPE_ID: u16[i] = cell.TypeID; break;
+      case COLUMN_ADJACENT_COUNT: u16[i] = cell.AdjacentCount; break;
+      case COLUMN_ADJACENT_ID:
+        memcpy(&u16[i * IcosCell::MAX_ADJACENT_CELLS], cell.AdjacentID, sizeof(cell.AdjacentID));
+        break;
+      case COLUMN_LATITUDE: f32[i] = cell.Coordinates.Latitude; break;
+      case COLUMN_LONGITUDE: f32[i] = cell.Coordinates.Longitude; break;
+      case COLUMN_ELEVATION: f32[i] = map.GetElevation(id); break;
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Encodes one block of valueCount values, returning the codec used. Blocks
+//! that do not shrink are stored raw.
+////////////////////////////////////////////////////////////////////////////////
+static
+U8
+Encode(
+    const ColumnSpec & spec,
+    const U8 raw[],
+    U32 valueCount,
+    std::vector<U8> & scratch,
+    std::vector<U8> & encoded
+    ) throw ()
+{
+  U32 rawBytes = valueCount * GetValueBytes(spec.ValueType);
+  U32 encodedBytes;
+  U8 codec;
+
+  if (IcosMapExport::TYPE_U16 == spec.ValueType)
+  {
+    encoded.resize(Compression::GetPackBound(valueCount));
+    encodedBytes = Compression::PackDeltas((const U16 *)raw, valueCount, spec.ValuesPerCell, &encoded[0]);
+    codec = IcosMapExport::CODEC_DELTA_PACK;
+  }
+  else
+  {
+    scratch.resize(rawBytes);
+    Compression::Shuffle(raw, valueCount, sizeof(F32), &scratch[0]);
+    encoded.resize(Compression::GetCompressBound(rawBytes));
+    encodedBytes = Compression::Compress(&scratch[0], rawBytes, &encoded[0]);
+    codec = IcosMapExport::CODEC_SHUFFLE_LZ;
+  }
+
+  if (rawBytes <= encodedBytes)
+  {
+    encoded.assign(raw, raw + rawBytes);
+    return IcosMapExport::CODEC_RAW;
+  }
+
+  encoded.resize(encodedBytes);
+  return codec;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! State shared by the worker threads and the writing thread of one call to
+//! Write(). Blocks are numbered column after column, in file order.
+////////////////////////////////////////////////////////////////////////////////
+struct IcosMapExport::Job
+{
+  const IcosMap * Map;
+  U32 BlockCount;           //!< Blocks per column.
+  U32 JobCount;             //!< Blocks in all columns.
+  //! Index of the next block to be claimed by a worker.
+  std::atomic<U32> NextBlock;
+  //! Guards Encoded, Codec and IsEncoded.
+  std::mutex Lock;
+  //! Signalled whenever a block has been encoded.
+  std::condition_variable BlockEncoded;
+  std::vector< std::vector<U8> > Encoded;
+  std::vector<U8> Codec;
+  std::vector<bool> IsEncoded;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//! Claims blocks until none are left and encodes each.
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapExport::Work(
+    Job * job
+    ) throw ()
+{
+  U32 cellCount = job->Map->GetCellCount();
+  std::vector<U8> raw(BLOCK_CELL_COUNT * IcosCell::MAX_ADJACENT_CELLS * sizeof(U16));
+  std::vector<U8> scratch;
+  std::vector<U8> encoded;
+
+  for (U32 i = job->NextBlock++; i < job->JobCount; i = job->NextBlock++)
+  {
+    U32 column = i / job->BlockCount;
+    U32 firstCell = (i % job->BlockCount) * BLOCK_CELL_COUNT;
+    U32 blockCellCount = cellCount - firstCell;
+    if (BLOCK_CELL_COUNT < blockCellCount) blockCellCount = BLOCK_CELL_COUNT;
+
+    const ColumnSpec & spec = COLUMN_SPEC[column];
+    Extract(*job->Map, column, firstCell, blockCellCount, &raw[0]);
+    U8 codec = Encode(spec, &raw[0], blockCellCount * spec.ValuesPerCell, scratch, encoded);
+
+    std::lock_guard<std::mutex> lock(job->Lock);
+    job->Encoded[i].swap(encoded);
+    job->Codec[i] = codec;
+    job->IsEncoded[i] = true;
+    job->BlockEncoded.notify_all();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapExport.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapExport::Write(
+    const IcosMap & map,
+    const char * path,
+    U32 threadCount,
+    Statistics * statistics
+    ) throw (Exception::Type)
+{
+  if (! ((nullptr != path) && (0u < map.GetCellCount())))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  if (0u == threadCount)
+  {
+    threadCount = std::thread::hardware_concurrency();
+    if (0u == threadCount) threadCount = 1u;
+  }
+
+  U32 cellCount = map.GetCellCount();
+
+  Job job;
+  job.Map = &map;
+  job.BlockCount = CountBlocks(cellCount, BLOCK_CELL_COUNT);
+  job.JobCount = job.BlockCount * COLUMN_COUNT;
+  job.NextBlock = 0u;
+  job.Encoded.resize(job.JobCount);
+  job.Codec.resize(job.JobCount);
+  job.IsEncoded.resize(job.JobCount, false);
+
+  if (job.JobCount < threadCount) threadCount = job.JobCount;
+
+  FILE * file = fopen(path, "wb");
+  if (file == nullptr)
+  {
+    throw (Exception::IO_ERROR);
+  }
+
+  Clock::time_point start = Clock::now();
+
+  std::vector<std::thread> worker;
+  for (U32 i = 0; i < threadCount; ++i)
+  {
+    worker.push_back(std::thread(Work, &job));
+  }
+
+  // Write the blocks in file order as they are encoded, releasing each once
+  // written, followed by the directory.
+  std::vector<Block> block(job.JobCount);
+  bool isWritten = (fwrite(MAGIC, 1, sizeof(MAGIC), file) == sizeof(MAGIC));
+  U64 offset = sizeof(MAGIC);
+  U64 rawBytes = 0u;
+
+  for (U32 i = 0; isWritten && (i < job.JobCount); ++i)
+  {
+    std::vector<U8> encoded;
+    {
+      std::unique_lock<std::mutex> lock(job.Lock);
+      while (! job.IsEncoded[i]) job.BlockEncoded.wait(lock);
+      encoded.swap(job.Encoded[i]);
+    }
+
+    memset(&block[i], 0, sizeof(Block));
+    block[i].Offset = offset;
+    block[i].Bytes = (U32)encoded.size();
+    block[i].Codec = job.Codec[i];
+
+    isWritten = encoded.empty() || (fwrite(&encoded[0], 1, encoded.size(), file) == encoded.size());
+    offset += encoded.size();
+  }
+
+  // Stop the workers early if writing failed.
+  job.NextBlock = job.JobCount;
+
+  for (U32 i = 0; i < worker.size(); ++i)
+  {
+    worker[i].join();
+  }
+
+  Column column[COLUMN_COUNT];
+  memset(column, 0, sizeof(column));
+
+  for (U32 c = 0; isWritten && (c < COLUMN_COUNT); ++c)
+  {
+    const ColumnSpec & spec = COLUMN_SPEC[c];
+
+    strncpy(column[c].Name, spec.Name, MAX_COLUMN_NAME_LENGTH);
+    column[c].ValueType = spec.ValueType;
+    column[c].ValuesPerCell = spec.ValuesPerCell;
+    column[c].BlockCount = job.BlockCount;
+    column[c].BlockOffset = offset;
+
+    U64 indexBytes = sizeof(Block) * job.BlockCount;
+    isWritten = (fwrite(&block[c * job.BlockCount], 1, indexBytes, file) == indexBytes);
+    offset += indexBytes;
+
+    rawBytes += (U64)cellCount * spec.ValuesPerCell * GetValueBytes(spec.ValueType);
+  }
+
+  Trailer trailer;
+  memset(&trailer, 0, sizeof(trailer));
+  trailer.ColumnOffset = offset;
+  trailer.Version = VERSION;
+  trailer.ByteOrderMark = BYTE_ORDER_MARK;
+  trailer.CellCount = cellCount;
+  trailer.BlockCellCount = BLOCK_CELL_COUNT;
+  trailer.Size = map.GetTopology().GetSize();
+  trailer.ColumnCount = COLUMN_COUNT;
+  memcpy(trailer.Magic, MAGIC, sizeof(MAGIC));
+
+  isWritten = isWritten
+      && (fwrite(column, 1, sizeof(column), file) == sizeof(column))
+      && (fwrite(&trailer, 1, sizeof(trailer), file) == sizeof(trailer));
+  offset += sizeof(column) + sizeof(trailer);
+
+  if ((fclose(file) != 0) || ! isWritten)
+  {
+    remove(path);
+    throw (Exception::IO_ERROR);
+  }
+
+  if (nullptr != statistics)
+  {
+    statistics->ThreadCount = threadCount;
+    statistics->BlockCount = job.JobCount;
+    statistics->RawBytes = rawBytes;
+    statistics->FileBytes = offset;
+    statistics->ElapsedSeconds = std::chrono::duration<F64>(Clock::now() - start).count();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapExport.h)
+////////////////////////////////////////////////////////////////////////////////
+IcosMapExport::Reader::Reader(
+    ) throw ()
+    : Descriptor(-1)
+    , FileBytes(0u)
+    , Blocks(nullptr)
+    , Encoded(nullptr)
+    , Shuffled(nullptr)
+{
+  memset(&Info, 0, sizeof(Info));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapExport.h)
+////////////////////////////////////////////////////////////////////////////////
+IcosMapExport::Reader::~Reader(
+    ) throw ()
+{
+  Close();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapExport.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapExport::Reader::Close(
+    ) throw ()
+{
+  if (0 <= Descriptor)
+  {
+    close(Descriptor);
+  }
+
+  delete [] Blocks;
+  delete [] Encoded;
+  delete [] Shuffled;
+
+  Descriptor = -1;
+  FileBytes = 0u;
+  Blocks = nullptr;
+  Encoded = nullptr;
+  Shuffled = nullptr;
+  memset(&Info, 0, sizeof(Info));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Reads byteCount bytes at offset, which must lie inside the file.
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapExport::Reader::ReadAt(
+    U64 offset,
+    U64 byteCount,
+    void * buffer
+    ) throw (Exception::Type)
+{
+  if ((FileBytes < offset) || (FileBytes - offset < byteCount))
+  {
+    throw (Exception::FORMAT_ERROR);
+  }
+
+  U8 * out = (U8 *)buffer;
+
+  while (0u < byteCount)
+  {
+    ssize_t count = pread(Descriptor, out, byteCount, (off_t)offset);
+    if (count <= 0)
+    {
+      throw (Exception::IO_ERROR);
+    }
+
+    out += count;
+    offset += count;
+    byteCount -= count;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapExport.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapExport::Reader::Open(
+    const char * path
+    ) throw (Exception::Type)
+{
+  Close();
+
+  Descriptor = open(path, O_RDONLY);
+  if (Descriptor < 0)
+  {
+    throw (Exception::IO_ERROR);
+  }
+
+  try
+  {
+    struct stat status;
+    if (fstat(Descriptor, &status) != 0)
+    {
+      throw (Exception::IO_ERROR);
+    }
+
+    FileBytes = (U64)status.st_size;
+    if (FileBytes < sizeof(MAGIC) + sizeof(Trailer))
+    {
+      throw (Exception::FORMAT_ERROR);
+    }
+
+    ReadAt(FileBytes - sizeof(Trailer), sizeof(Trailer), &Info);
+
+    U32 size = Info.Size;
+
+    if ((memcmp(Info.Magic, MAGIC, sizeof(MAGIC)) != 0)
+        || (Info.Version != VERSION)
+        || (Info.ByteOrderMark != BYTE_ORDER_MARK)
+        || (size < IcosMap::MIN_SIZE) || (IcosMap::MAX_SIZE < size)
+        || (Info.CellCount != 10u * size * size + 2u)
+        || (0u == Info.BlockCellCount) || (BLOCK_CELL_COUNT < Info.BlockCellCount)
+        || (MAX_COLUMN_COUNT < Info.ColumnCount))
+    {
+      throw (Exception::FORMAT_ERROR);
+    }
+
+    ReadAt(Info.ColumnOffset, sizeof(Column) * Info.ColumnCount, Columns);
+
+    U32 blockCount = CountBlocks(Info.CellCount, Info.BlockCellCount);
+    U32 maxRawBytes = 0u;
+
+    Blocks = new Block[Info.ColumnCount * blockCount];
+
+    for (U16 c = 0; c < Info.ColumnCount; ++c)
+    {
+      const Column & column = Columns[c];
+      U32 valueBytes = GetValueBytes(column.ValueType);
+
+      if ((0u == valueBytes)
+          || (0u == column.ValuesPerCell) || (IcosCell::MAX_ADJACENT_CELLS < column.ValuesPerCell)
+          || (column.BlockCount != blockCount))
+      {
+        throw (Exception::FORMAT_ERROR);
+      }
+
+      U32 rawBytes = Info.BlockCellCount * column.ValuesPerCell * valueBytes;
+      if (maxRawBytes < rawBytes) maxRawBytes = rawBytes;
+
+      ReadAt(column.BlockOffset, sizeof(Block) * blockCount, &Blocks[c * blockCount]);
+
+      for (U32 b = 0; b < blockCount; ++b)
+      {
+        const Block & block = Blocks[c * blockCount + b];
+
+        if ((Compression::GetCompressBound(rawBytes) < block.Bytes)
+            || (Info.ColumnOffset < block.Offset)
+            || (Info.ColumnOffset - block.Offset < block.Bytes))
+        {
+          throw (Exception::FORMAT_ERROR);
+        }
+      }
+    }
+
+    Encoded = new U8[Compression::GetCompressBound(maxRawBytes)];
+    Shuffled = new U8[maxRawBytes];
+  }
+  catch (Exception::Type error)
+  {
+    Close();
+    throw (error);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapExport.h)
+////////////////////////////////////////////////////////////////////////////////
+U8
+IcosMapExport::Reader::GetSize(
+    ) const throw ()
+{
+  return (U8)Info.Size;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapExport.h)
+////////////////////////////////////////////////////////////////////////////////
+U32
+IcosMapExport::Reader::GetCellCount(
+    ) const throw ()
+{
+  return Info.CellCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapExport.h)
+////////////////////////////////////////////////////////////////////////////////
+U32
+IcosMapExport::Reader::GetBlockCount(
+    ) const throw ()
+{
+  return (0u < Info.BlockCellCount) ? CountBlocks(Info.CellCount, Info.BlockCellCount) : 0u;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapExport.h)
+////////////////////////////////////////////////////////////////////////////////
+U16
+IcosMapExport::Reader::GetColumnCount(
+    ) const throw ()
+{
+  return Info.ColumnCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapExport.h)
+////////////////////////////////////////////////////////////////////////////////
+const IcosMapExport::Column &
+IcosMapExport::Reader::GetColumn(
+    U16 column
+    ) const throw ()
+{
+  return Columns[column];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapExport.h)
+////////////////////////////////////////////////////////////////////////////////
+U16
+IcosMapExport::Reader::FindColumn(
+    const char * name
+    ) const throw (Exception::Type)
+{
+  for (U16 c = 0; c < Info.ColumnCount; ++c)
+  {
+    if (strncmp(Columns[c].Name, name, sizeof(Columns[c].Name)) == 0) return c;
+  }
+
+  throw (Exception::PARAMETER_ERROR);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapExport.h)
+////////////////////////////////////////////////////////////////////////////////
+U32
+IcosMapExport::Reader::ReadBlock(
+    U16 column,
+    U32 block,
+    void * values
+    ) throw (Exception::Type)
+{
+  U32 blockCount = GetBlockCount();
+
+  if (! ((column < Info.ColumnCount) && (block < blockCount) && (nullptr != values)))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  const Column & spec = Columns[column];
+  const Block & entry = Blocks[column * blockCount + block];
+
+  U32 firstCell = block * Info.BlockCellCount;
+  U32 cellCount = Info.CellCount - firstCell;
+  if (Info.BlockCellCount < cellCount) cellCount = Info.BlockCellCount;
+
+  U32 valueCount = cellCount * spec.ValuesPerCell;
+  U32 valueBytes = GetValueBytes(spec.ValueType);
+  U32 rawBytes = valueCount * valueBytes;
+
+  ReadAt(entry.Offset, entry.Bytes, Encoded);
+
+  switch (entry.Codec)
+  {
+    case CODEC_RAW:
+      if (entry.Bytes != rawBytes) throw (Exception::FORMAT_ERROR);
+      memcpy(values, Encoded, rawBytes);
+      break;
+
+    case CODEC_DELTA_PACK:
+      if (TYPE_U16 != spec.ValueType) throw (Exception::FORMAT_ERROR);
+      Compression::UnpackDeltas(Encoded, entry.Bytes, (U16 *)values, valueCount, spec.ValuesPerCell);
+      break;
+
+    case CODEC_SHUFFLE_LZ:
+      Compression::Decompress(Encoded, entry.Bytes, Shuffled, rawBytes);
+      Compression::Unshuffle(Shuffled, valueCount, valueBytes, values);
+      break;
+
+    default:
+      throw (Exception::FORMAT_ERROR);
+  }
+
+  return cellCount;
+}
+
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
@@ -0,0 +1,241 @@
+#pragma once
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ *
+ * ****************************************************************************/
+
+
+#include "Exception.h"
+#include "IcosMap.h"
+#include "NativeTypes.h"
+
+////////////////////////////////////////////////////////////////////////////////
+//! Compressed, columnar export of a map for downstream consumers. Each field
+//! of the cells (coordinates, type, adjacency, elevation, ...) is a column of
+//! values in cell ID order, cut into blocks of BLOCK_CELL_COUNT cells that are
+//! compressed independently:
+//!
+//!   Magic        "ICOSCOL"
+//!   Blocks       the blocks of the first column, then of the next, ...
+//!   Block index  one Block per block of each column
+//!   Columns      one Column per column
+//!   Trailer      fixed size, last in the file
+//!
+//! The writer streams the file front to back, so it may be a pipe, and the
+//! reader only reads the trailer, the directory and the blocks it is asked
+//! for. U16 columns are delta coded against the same value of the previous
+//! cell and bit packed; F32 columns are byte shuffled and LZ compressed. A
+//! block that does not shrink is stored raw. Values are stored in the byte
+//! order of the writing machine, which the trailer records.
+////////////////////////////////////////////////////////////////////////////////
+class IcosMapExport
+{
+public:
+
+  static const U32 VERSION = 1u;
+  static const U32 BYTE_ORDER_MARK = 0x01020304u;
+  static const U32 BLOCK_CELL_COUNT = 4096u;
+  static const U8 MAX_COLUMN_COUNT = 16u;
+  static const U8 MAX_COLUMN_NAME_LENGTH = 15u;
+
+  static const U8 TYPE_U16 = 1u;
+  static const U8 TYPE_F32 = 2u;
+
+  static const U8 CODEC_RAW = 0u;
+  static const U8 CODEC_DELTA_PACK = 1u;
+  static const U8 CODEC_SHUFFLE_LZ = 2u;
+
+  struct Column
+  {
+    char Name[MAX_COLUMN_NAME_LENGTH + 1u];
+    U8 ValueType;
+    U8 ValuesPerCell;     //!< Values of one cell are stored together.
+    U16 Reserved;
+    U32 BlockCount;
+    U64 BlockOffset;      //!< File offset of this column's Block index.
+  };
+
+  struct Block
+  {
+    U64 Offset;
+    U32 Bytes;
+    U8 Codec;
+    U8 Reserved[3];
+  };
+
+  struct Trailer
+  {
+    U64 ColumnOffset;
+    U32 Version;
+    U32 ByteOrderMark;
+    U32 CellCount;
+    U32 BlockCellCount;
+    U16 Size;
+    U16 ColumnCount;
+    U32 Reserved;
+    char Magic[8];
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Size and timing of the last call to Write().
+  //////////////////////////////////////////////////////////////////////////////
+  struct Statistics
+  {
+    U32 ThreadCount;
+    U32 BlockCount;
+    U64 RawBytes;         //!< Bytes of column data before compression.
+    U64 FileBytes;
+    F64 ElapsedSeconds;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Exports an initialized map to path. Blocks are compressed by threadCount
+  //! worker threads, zero using one per core, while the calling thread writes
+  //! them out in order as they finish.
+  //////////////////////////////////////////////////////////////////////////////
+  static
+  void
+  Write(
+      const IcosMap & map,
+      const char * path,
+      U32 threadCount,
+      Statistics * statistics = nullptr
+      ) throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Random access to the blocks of an exported file. A reader may be used by
+  //! one thread at a time.
+  //////////////////////////////////////////////////////////////////////////////
+  class Reader
+  {
+  public:
+
+    Reader(
+        ) throw ();
+
+    ~Reader(
+        ) throw ();
+
+    //////////////////////////////////////////////////////////////////////////
+    //! Opens the file at path and reads its directory.
+    //////////////////////////////////////////////////////////////////////////
+    void
+    Open(
+        const char * path
+        ) throw (Exception::Type);
+
+    void
+    Close(
+        ) throw ();
+
+    U8
+    GetSize(
+        ) const throw ();
+
+    U32
+    GetCellCount(
+        ) const throw ();
+
+    //////////////////////////////////////////////////////////////////////////
+    //! Returns the number of blocks of every column.
+    //////////////////////////////////////////////////////////////////////////
+    U32
+    GetBlockCount(
+        ) const throw ();
+
+    U16
+    GetColumnCount(
+        ) const throw ();
+
+    const Column &
+    GetColumn(
+        U16 column
+        ) const throw ();
+
+    //////////////////////////////////////////////////////////////////////////
+    //! Returns the index of the column with the given name. Throws
+    //! PARAMETER_ERROR if there is none.
+    //////////////////////////////////////////////////////////////////////////
+    U16
+    FindColumn(
+        const char * name
+        ) const throw (Exception::Type);
+
+    //////////////////////////////////////////////////////////////////////////
+    //! Reads and decodes one block of a column into values[], which must hold
+    //! BLOCK_CELL_COUNT * ValuesPerCell values of the column's type, and
+    //! returns the number of cells in the block. Only that block is read.
+    //////////////////////////////////////////////////////////////////////////
+    U32
+    ReadBlock(
+        U16 column,
+        U32 block,
+        void * values
+        ) throw (Exception::Type);
+
+  private:
+
+    Reader(
+        const Reader &
+        ) throw ();
+
+    Reader &
+    operator=(
+        const Reader &
+        ) throw ();
+
+    void
+    ReadAt(
+        U64 offset,
+        U64 byteCount,
+        void * buffer
+        ) throw (Exception::Type);
+
+    int Descriptor;
+    U64 FileBytes;
+    Trailer Info;
+    Column Columns[MAX_COLUMN_COUNT];
+    //! Block index of every column, column after column.
+    Block * Blocks;
+    //! Encoded bytes of the block being read.
+    U8 * Encoded;
+    //! Decompressed, still shuffled, bytes of the block being read.
+    U8 * Shuffled;
+  };
+
+private:
+
+  struct Job;
+
+  static
+  void
+  Work(
+      Job * job
+      ) throw ();
+};
+
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
@@ -0,0 +1,405 @@
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ * Oct 19, 2026 |---| images hold an IcosTopology and its field columns
+ *
+ * ****************************************************************************/
+
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+#include "IcosMapFile.h"
+
+static const char MAGIC[8] = "ICOSMAP";
+static const char ELEVATION_COLUMN[] = "elevation";
+
+////////////////////////////////////////////////////////////////////////////////
+//! Rounds offset up to the next section boundary.
+////////////////////////////////////////////////////////////////////////////////
+static
+U64
+Align(
+    U64 offset
+    ) throw ()
+{
+  return (offset + IcosMapFile::ALIGNMENT - 1u) & ~(U64)(IcosMapFile::ALIGNMENT - 1u);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns true if a section of byteCount bytes at offset is aligned and lies
+//! inside the file.
+////////////////////////////////////////////////////////////////////////////////
+static
+bool
+IsSectionValid(
+    U64 offset,
+    U64 byteCount,
+    U64 fileBytes
+    ) throw ()
+{
+  return (offset % IcosMapFile::ALIGNMENT == 0u)
+      && (offset <= fileBytes)
+      && (byteCount <= fileBytes - offset);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the elevation column of a header, or nullptr.
+////////////////////////////////////////////////////////////////////////////////
+static
+const IcosMapFile::Column *
+FindElevationColumn(
+    const IcosMapFile::Header & header
+    ) throw ()
+{
+  for (U16 i = 0; i < header.ColumnCount; ++i)
+  {
+    const IcosMapFile::Column & column = header.Columns[i];
+
+    if (strncmp(column.Name, ELEVATION_COLUMN, sizeof(column.Name)) == 0) return &column;
+  }
+
+  return nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns true if the header describes a file of fileBytes bytes this build
+//! can use in place.
+////////////////////////////////////////////////////////////////////////////////
+bool
+IcosMapFile::IsHeaderValid(
+    const Header & header,
+    U64 fileBytes
+    ) throw ()
+{
+  if (memcmp(header.Magic, MAGIC, sizeof(MAGIC)) != 0) return false;
+
+  if ((header.Version != IcosMapFile::VERSION)
+      || (header.ByteOrderMark != IcosMapFile::BYTE_ORDER_MARK)
+      || (header.HeaderBytes != sizeof(IcosMapFile::Header))
+      || (header.CellBytes != sizeof(IcosCell))
+      || (header.FileBytes != fileBytes)
+      || (header.MaxSize != IcosTopology::MAX_SIZE))
+  {
+    return false;
+  }
+
+  U16 size = header.Size;
+
+  if ((size < IcosTopology::MIN_SIZE)
+      || (IcosTopology::MAX_SIZE < size)
+      || (header.CellCount != 10u * size * size + 2u)
+      || (header.RowCount != 3u * size + 1u)
+      || (header.ExpectedEdgeCellCount != size - 1u)
+      || (header.ExpectedFaceCellCount != ((size - 2u) * (size - 1u)) / 2)
+      || (header.ColumnCount > IcosMapFile::MAX_COLUMN_COUNT))
+  {
+    return false;
+  }
+
+  U32 rowCellTotal = 0u;
+  for (U16 y = 0; y < header.RowCount; ++y) rowCellTotal += header.RowCellCount[y];
+  if (rowCellTotal != header.CellCount) return false;
+
+  for (U16 i = 0; i < IcosTopology::VERTEX_COUNT; ++i)
+  {
+    if (! (header.VertexCell[i] < header.CellCount)) return false;
+  }
+
+  if (! (IsSectionValid(header.EdgeCellOffset, EDGE_CELL_BYTES, fileBytes)
+      && IsSectionValid(header.FaceCellOffset, FACE_CELL_BYTES, fileBytes)
+      && IsSectionValid(header.CellOffset, (U64)header.CellCount * sizeof(IcosCell), fileBytes)))
+  {
+    return false;
+  }
+
+  for (U16 i = 0; i < header.ColumnCount; ++i)
+  {
+    const IcosMapFile::Column & column = header.Columns[i];
+
+    if (! IsSectionValid(column.Offset, (U64)header.CellCount * column.ValueBytes, fileBytes)) return false;
+  }
+
+  const IcosMapFile::Column * elevation = FindElevationColumn(header);
+
+  return (elevation != nullptr) && (elevation->ValueBytes == sizeof(F32));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Fills in the header of the file image of a topology.
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapFile::BuildHeader(
+    const IcosTopology & topology,
+    Header & header
+    ) throw ()
+{
+  memset(&header, 0, sizeof(header));
+
+  memcpy(header.Magic, MAGIC, sizeof(MAGIC));
+  header.Version = VERSION;
+  header.ByteOrderMark = BYTE_ORDER_MARK;
+  header.HeaderBytes = sizeof(Header);
+  header.CellBytes = sizeof(IcosCell);
+  header.MaxSize = IcosTopology::MAX_SIZE;
+  header.Size = topology.Size;
+  header.CellCount = topology.CellCount;
+  header.RowCount = topology.RowCount;
+  header.ExpectedEdgeCellCount = topology.ExpectedEdgeCellCount;
+  header.ExpectedFaceCellCount = topology.ExpectedFaceCellCount;
+  memcpy(header.VertexCell, topology.VertexCell, sizeof(header.VertexCell));
+  memcpy(header.EdgeCellCount, topology.EdgeCellCount, sizeof(header.EdgeCellCount));
+  memcpy(header.FaceCellCount, topology.FaceCellCount, sizeof(header.FaceCellCount));
+  memcpy(header.RowCellCount, topology.RowCellCount, sizeof(header.RowCellCount));
+
+  header.EdgeCellOffset = Align(sizeof(Header));
+  header.FaceCellOffset = Align(header.EdgeCellOffset + EDGE_CELL_BYTES);
+  header.CellOffset = Align(header.FaceCellOffset + FACE_CELL_BYTES);
+
+  header.ColumnCount = 1u;
+  Column & elevation = header.Columns[0];
+  strncpy(elevation.Name, ELEVATION_COLUMN, MAX_COLUMN_NAME_LENGTH);
+  elevation.Offset = Align(header.CellOffset + (U64)topology.CellCount * sizeof(IcosCell));
+  elevation.ValueBytes = sizeof(F32);
+
+  header.FileBytes = Align(elevation.Offset + (U64)topology.CellCount * sizeof(F32));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the elevation column of a validated image.
+////////////////////////////////////////////////////////////////////////////////
+const IcosMapFile::Column &
+IcosMapFile::GetElevationColumn(
+    const void * image
+    ) throw ()
+{
+  return *FindElevationColumn(*(const Header *)image);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapFile.h)
+////////////////////////////////////////////////////////////////////////////////
+U64
+IcosMapFile::GetImageBytes(
+    const IcosTopology & topology
+    ) throw ()
+{
+  Header header;
+  BuildHeader(topology, header);
+
+  return header.FileBytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapFile.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapFile::WriteImage(
+    const IcosTopology & topology,
+    const F32 elevation[],
+    U8 image[]
+    ) throw ()
+{
+  Header header;
+  BuildHeader(topology, header);
+
+  memset(image, 0, header.FileBytes);
+  memcpy(image, &header, sizeof(header));
+  memcpy(image + header.EdgeCellOffset, topology.EdgeCell, EDGE_CELL_BYTES);
+  memcpy(image + header.FaceCellOffset, topology.FaceCell, FACE_CELL_BYTES);
+  memcpy(image + header.CellOffset, topology.Cell, (size_t)topology.CellCount * sizeof(IcosCell));
+
+  if (elevation != nullptr)
+  {
+    memcpy(image + header.Columns[0].Offset, elevation, (size_t)topology.CellCount * sizeof(F32));
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapFile.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapFile::Save(
+    const IcosMap & map,
+    const char * path
+    ) throw (Exception::Type)
+{
+  if (map.GetCellCount() == 0u)
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  std::vector<U8> image(GetImageBytes(map.GetTopology()));
+  WriteImage(map.GetTopology(), map.Elevation, &image[0]);
+
+  FILE * file = fopen(path, "wb");
+  if (file == nullptr)
+  {
+    throw (Exception::IO_ERROR);
+  }
+
+  bool isWritten = (fwrite(&image[0], 1, image.size(), file) == image.size());
+
+  if ((fclose(file) != 0) || ! isWritten)
+  {
+    remove(path);
+    throw (Exception::IO_ERROR);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapFile.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapFile::Load(
+    const char * path,
+    IcosMap & map
+    ) throw (Exception::Type)
+{
+  U64 length;
+  void * mapping = Map(path, true, length);
+  IcosTopology * topology;
+
+  try
+  {
+    topology = Attach(mapping, length, Unmap);
+  }
+  catch (Exception::Type error)
+  {
+    Unmap(mapping, length);
+    throw (error);
+  }
+
+  // The elevation column lives as long as the topology owning the mapping.
+  map.Attach(topology, (F32 *)((U8 *)mapping + GetElevationColumn(mapping).Offset));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapFile.h)
+////////////////////////////////////////////////////////////////////////////////
+IcosTopology *
+IcosMapFile::Attach(
+    void * image,
+    U64 length,
+    IcosTopology::ReleaseFunction release
+    ) throw (Exception::Type)
+{
+  U8 * base = (U8 *)image;
+  const Header & header = *(const Header *)base;
+
+  if ((length < sizeof(Header)) || ! IsHeaderValid(header, length))
+  {
+    throw (Exception::FORMAT_ERROR);
+  }
+
+  IcosTopology * topology = new IcosTopology();
+
+  topology->Size = header.Size;
+  topology->CellCount = header.CellCount;
+  topology->RowCount = header.RowCount;
+  topology->ExpectedEdgeCellCount = header.ExpectedEdgeCellCount;
+  topology->ExpectedFaceCellCount = header.ExpectedFaceCellCount;
+  memcpy(topology->VertexCell, header.VertexCell, sizeof(topology->VertexCell));
+  memcpy(topology->EdgeCellCount, header.EdgeCellCount, sizeof(topology->EdgeCellCount));
+  memcpy(topology->FaceCellCount, header.FaceCellCount, sizeof(topology->FaceCellCount));
+  memcpy(topology->RowCellCount, header.RowCellCount, sizeof(topology->RowCellCount));
+
+  topology->EdgeCell = (U16 (*)[IcosTopology::MAX_EDGE_CELL_COUNT])(base + header.EdgeCellOffset);
+  topology->FaceCell = (U16 (*)[IcosTopology::MAX_FACE_CELL_COUNT])(base + header.FaceCellOffset);
+  topology->Cell = (IcosCell *)(base + header.CellOffset);
+  topology->SetRowCells();
+
+  topology->Image = image;
+  topology->ImageLength = length;
+  topology->ReleaseImage = release;
+
+  return topology;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapFile.h)
+////////////////////////////////////////////////////////////////////////////////
+void *
+IcosMapFile::Map(
+    const char * path,
+    bool isWritable,
+    U64 & length
+    ) throw (Exception::Type)
+{
+  int descriptor = open(path, O_RDONLY);
+  if (descriptor < 0)
+  {
+    throw (Exception::IO_ERROR);
+  }
+
+  struct stat status;
+  if (fstat(descriptor, &status) != 0)
+  {
+    close(descriptor);
+    throw (Exception::IO_ERROR);
+  }
+
+  if (status.st_size < (off_t)sizeof(Header))
+  {
+    close(descriptor);
+    throw (Exception::FORMAT_ERROR);
+  }
+
+  length = (U64)status.st_size;
+
+  void * mapping = isWritable
+      ? mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, descriptor, 0)
+      : mmap(nullptr, length, PROT_READ, MAP_SHARED, descriptor, 0);
+  close(descriptor);
+
+  if (mapping == MAP_FAILED)
+  {
+    throw (Exception::IO_ERROR);
+  }
+
+  return mapping;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapFile.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapFile::Unmap(
+    void * mapping,
+    U64 length
+    ) throw ()
+{
+  if (mapping != nullptr)
+  {
+    munmap(mapping, length);
+  }
+}
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
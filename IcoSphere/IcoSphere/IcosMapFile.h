@@ -0,0 +1,158 @@
+#pragma once
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ * Oct 19, 2026 |---| images hold an IcosTopology and its field columns
+ *
+ * ****************************************************************************/
+
+
+#include "Exception.h"
+#include "IcosMap.h"
+#include "IcosTopology.h"
+#include "NativeTypes.h"
+
+////////////////////////////////////////////////////////////////////////////////
+//! Binary map file. The file is an image of an initialized IcosMap, its
+//! IcosTopology followed by its field columns, that can be mapped into memory
+//! and used in place:
+//!
+//!   Header       fixed size, includes the per-vertex, edge, face and row counts
+//!   EdgeCell     U16[30][IcosMap::MAX_SIZE - 1]
+//!   FaceCell     U16[20][(IcosMap::MAX_SIZE - 2) * (IcosMap::MAX_SIZE - 1) / 2]
+//!   Cell         IcosCell[CellCount]
+//!   Columns      one array of CellCount values per field
+//!
+//! Every section starts on an ALIGNMENT byte boundary. Values are stored in the
+//! byte order and record layout of the writing machine; the header records both
+//! and Load() rejects files that do not match.
+////////////////////////////////////////////////////////////////////////////////
+class IcosMapFile
+{
+public:
+
+  static const U32 VERSION = 1u;
+  static const U32 ALIGNMENT = 64u;
+  static const U32 BYTE_ORDER_MARK = 0x01020304u;
+  static const U8 MAX_COLUMN_COUNT = 8u;
+  static const U8 MAX_COLUMN_NAME_LENGTH = 15u;
+
+  struct Column
+  {
+    char Name[MAX_COLUMN_NAME_LENGTH + 1u];
+    U64 Offset;
+    U32 ValueBytes;
+    U32 Reserved;
+  };
+
+  struct Header
+  {
+    char Magic[8];
+    U32 Version;
+    U32 ByteOrderMark;
+    U32 HeaderBytes;
+    U32 CellBytes;
+    U64 FileBytes;
+    U16 MaxSize;
+    U16 Size;
+    U16 CellCount;
+    U16 RowCount;
+    U16 ExpectedEdgeCellCount;
+    U16 ExpectedFaceCellCount;
+    U16 ColumnCount;
+    U16 Reserved;
+    U64 EdgeCellOffset;
+    U64 FaceCellOffset;
+    U64 CellOffset;
+    U16 VertexCell[IcosTopology::VERTEX_COUNT];
+    U16 EdgeCellCount[IcosTopology::EDGE_COUNT];
+    U16 FaceCellCount[IcosTopology::FACE_COUNT];
+    U16 RowCellCount[IcosTopology::MAX_ROW_COUNT];
+    Column Columns[MAX_COLUMN_COUNT];
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Writes an initialized map, including its elevation column, to path.
+  //////////////////////////////////////////////////////////////////////////////
+  static void Save(const IcosMap & map, const char * path) throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Maps the file at path and points the arrays of map straight into the
+  //! mapping; apart from the small header tables nothing is parsed or copied.
+  //! The mapping is private, so pages are shared with every other process
+  //! mapping the file until the map modifies them, and the file itself is never
+  //! changed. The mapping is released by the next Initialize() or Load(), or
+  //! when the map is destroyed.
+  //////////////////////////////////////////////////////////////////////////////
+  static void Load(const char * path, IcosMap & map) throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the size in bytes of the file image of a topology.
+  //////////////////////////////////////////////////////////////////////////////
+  static U64 GetImageBytes(const IcosTopology & topology) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Writes the file image of a topology and its elevation[] into image[],
+  //! which must hold GetImageBytes() bytes. A null elevation writes zeros.
+  //////////////////////////////////////////////////////////////////////////////
+  static void WriteImage(const IcosTopology & topology, const F32 elevation[], U8 image[]) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Maps the file at path into memory, writable (private) or read-only
+  //! (shared), and returns the mapping and its length.
+  //////////////////////////////////////////////////////////////////////////////
+  static void * Map(const char * path, bool isWritable, U64 & length) throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Releases a mapping made by Map(). Does nothing for a null mapping.
+  //////////////////////////////////////////////////////////////////////////////
+  static void Unmap(void * mapping, U64 length) throw ();
+
+private:
+
+  friend class IcosTopologyCache;
+
+  static const U64 EDGE_CELL_BYTES = sizeof(U16) * IcosTopology::EDGE_COUNT * IcosTopology::MAX_EDGE_CELL_COUNT;
+  static const U64 FACE_CELL_BYTES = sizeof(U16) * IcosTopology::FACE_COUNT * IcosTopology::MAX_FACE_CELL_COUNT;
+
+  static bool IsHeaderValid(const Header & header, U64 fileBytes) throw ();
+
+  static void BuildHeader(const IcosTopology & topology, Header & header) throw ();
+
+  static const Column & GetElevationColumn(const void * image) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns a topology, holding one reference, whose tables point into image,
+  //! a file image of length bytes. The topology releases the image with
+  //! release() when it is destroyed; image may be read-only.
+  //////////////////////////////////////////////////////////////////////////////
+  static IcosTopology * Attach(
+      void * image,
+      U64 length,
+      IcosTopology::ReleaseFunction release
+      ) throw (Exception::Type);
+};
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
@@ -0,0 +1,838 @@
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ * Oct 19, 2026 |---| sample tiles at cell centers, down to every cell
+ *
+ * ****************************************************************************/
+
+#include <math.h>
+#include <string.h>
+
+#include "IcosMapLod.h"
+#include "IcosMapPatches.h"
+
+//! Radius of a cell center at elevation 0 and its growth per unit elevation,
+//! as in IcosMapMesh.
+static const F32 BASE_RADIUS = 0.8f;
+static const F32 ELEVATION_SCALE = 0.2f;
+
+//! Distance below which a camera counts as touching a tile's bounds.
+static const F64 MIN_DISTANCE = 1.0e-6;
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the icosahedron vertices at the start and end of an edge of a
+//! diamond, in the direction its parameter grows.
+////////////////////////////////////////////////////////////////////////////////
+static
+void
+GetEdgeCorners(
+    const IcosDiamond & diamond,
+    U8 edge,
+    U8 & start,
+    U8 & end
+    ) throw ()
+{
+  switch (edge)
+  {
+    case IcosMapLod::EDGE_U0: start = diamond.T; end = diamond.R; break;
+    case IcosMapLod::EDGE_V0: start = diamond.T; end = diamond.L; break;
+    case IcosMapLod::EDGE_U1: start = diamond.L; end = diamond.B; break;
+    default:                  start = diamond.R; end = diamond.B; break;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the sample index of position j along an edge of a tile.
+////////////////////////////////////////////////////////////////////////////////
+static
+U16
+GetEdgeSample(
+    U8 edge,
+    U16 j
+    ) throw ()
+{
+  const U16 row = IcosMapLod::TILE_RESOLUTION + 1u;
+  const U16 last = IcosMapLod::TILE_RESOLUTION;
+
+  switch (edge)
+  {
+    case IcosMapLod::EDGE_U0: return j * row;
+    case IcosMapLod::EDGE_V0: return j;
+    case IcosMapLod::EDGE_U1: return j * row + last;
+    default:                  return last * row + j;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+IcosMapLod::IcosMapLod()
+: Size(0u)
+, LevelCount(0u)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+IcosMapLod::~IcosMapLod()
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapLod.h)
+////////////////////////////////////////////////////////////////////////////////
+void IcosMapLod::Initialize(const IcosMap & map) throw (Exception::Type)
+{
+  if (0u == map.GetCellCount())
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  IcosMapPatches * patches = new IcosMapPatches();
+
+  try
+  {
+    patches->Initialize(map);
+
+    Size = patches->GetSize();
+
+    const U16 row = Size + 1u;
+
+    for (U8 p = 0; p < ICOS_DIAMOND_COUNT; ++p)
+    {
+      for (U16 i = 0; i <= Size; ++i)
+      {
+        for (U16 k = 0; k <= Size; ++k)
+        {
+          S32 cellID = patches->GetCellID(patches->GetSlot(p, i + 1u, k));
+
+          if (IcosMapPatches::NO_CELL == cellID) throw (Exception::INITIALIZATION_ERROR);
+
+          LatticeCell[p][i * row + k] = (U16)cellID;
+        }
+      }
+    }
+  }
+  catch (Exception::Type error)
+  {
+    delete patches;
+    throw (error);
+  }
+
+  delete patches;
+
+  for (U16 c = 0; c < map.GetCellCount(); ++c)
+  {
+    const IcosCell & cell = map.GetCell(c);
+    F32 radius = BASE_RADIUS + map.GetElevation(c) * ELEVATION_SCALE;
+
+    CellPosition[c][0] = cell.Normal.X * radius;
+    CellPosition[c][1] = cell.Normal.Y * radius;
+    CellPosition[c][2] = cell.Normal.Z * radius;
+  }
+
+  // Each boundary edge of a diamond is an icosahedron edge shared with
+  // exactly one other diamond.
+  for (U8 p = 0; p < ICOS_DIAMOND_COUNT; ++p)
+  {
+    for (U8 e = 0; e < EDGE_COUNT; ++e)
+    {
+      U8 start, end;
+      GetEdgeCorners(ICOS_DIAMOND[p], e, start, end);
+
+      bool isFound = false;
+
+      for (U8 q = 0; (q < ICOS_DIAMOND_COUNT) && ! isFound; ++q)
+      {
+        for (U8 f = 0; (f < EDGE_COUNT) && (q != p) && ! isFound; ++f)
+        {
+          U8 otherStart, otherEnd;
+          GetEdgeCorners(ICOS_DIAMOND[q], f, otherStart, otherEnd);
+
+          if (((start == otherStart) && (end == otherEnd)) || ((start == otherEnd) && (end == otherStart)))
+          {
+            DiamondNeighbor[p][e].Diamond = q;
+            DiamondNeighbor[p][e].Edge = f;
+            DiamondNeighbor[p][e].IsReversed = (start != otherStart);
+            isFound = true;
+          }
+        }
+      }
+
+      if (! isFound) throw (Exception::INITIALIZATION_ERROR);
+    }
+
+    // Orientation of the (u,v) frame from the diamond's T, L and R corners.
+    F64 t[3], l[3], r[3];
+    GetPosition(LatticeCell[p][0], t);
+    GetPosition(LatticeCell[p][Size * (Size + 1u)], l);
+    GetPosition(LatticeCell[p][Size], r);
+
+    F64 du[3] = { l[0] - t[0], l[1] - t[1], l[2] - t[2] };
+    F64 dv[3] = { r[0] - t[0], r[1] - t[1], r[2] - t[2] };
+    F64 normal[3] = {
+        du[1] * dv[2] - du[2] * dv[1],
+        du[2] * dv[0] - du[0] * dv[2],
+        du[0] * dv[1] - du[1] * dv[0] };
+
+    IsMirrored[p] = (normal[0] * (t[0] + l[0] + r[0]) + normal[1] * (t[1] + l[1] + r[1]) + normal[2] * (t[2] + l[2] + r[2])) < 0.0;
+  }
+
+  // Add levels until the finest holds every lattice point.
+  LevelCount = 1u;
+  while ((LevelCount < MAX_LEVEL_COUNT) && ((U32)TILE_RESOLUTION << (LevelCount - 1u)) < Size)
+  {
+    ++LevelCount;
+  }
+
+  for (U8 p = 0; p < ICOS_DIAMOND_COUNT; ++p)
+  {
+    for (U8 level = 0; level < LevelCount; ++level)
+    {
+      for (U16 y = 0; y < (1u << level); ++y)
+      {
+        for (U16 x = 0; x < (1u << level); ++x)
+        {
+          BuildNode(p, level, x, y);
+        }
+      }
+    }
+
+    // A parent is never more accurate than its children.
+    for (S32 level = LevelCount - 2; 0 <= level; --level)
+    {
+      for (U16 y = 0; y < (1u << level); ++y)
+      {
+        for (U16 x = 0; x < (1u << level); ++x)
+        {
+          U16 node = GetNodeIndex(p, level, x, y);
+
+          for (U8 c = 0; c < 4u; ++c)
+          {
+            F32 childError = NodeError[GetNodeIndex(p, level + 1, 2u * x + (c & 1u), 2u * y + (c >> 1u))];
+            if (NodeError[node] < childError) NodeError[node] = childError;
+          }
+        }
+      }
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapLod.h)
+////////////////////////////////////////////////////////////////////////////////
+U8 IcosMapLod::GetLevelCount() const throw ()
+{
+  return LevelCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapLod.h)
+////////////////////////////////////////////////////////////////////////////////
+F32 IcosMapLod::GetGeometricError(const Tile & tile) const throw (Exception::Type)
+{
+  if (! IsTileValid(tile))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  return NodeError[GetNodeIndex(tile.Diamond, tile.Level, tile.X, tile.Y)];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapLod.h)
+////////////////////////////////////////////////////////////////////////////////
+F32 IcosMapLod::GetScreenError(const Camera & camera, const Tile & tile) const throw (Exception::Type)
+{
+  if (! IsTileValid(tile))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  U16 node = GetNodeIndex(tile.Diamond, tile.Level, tile.X, tile.Y);
+
+  F64 dx = camera.Position[0] - NodeCenter[node][0];
+  F64 dy = camera.Position[1] - NodeCenter[node][1];
+  F64 dz = camera.Position[2] - NodeCenter[node][2];
+  F64 distance = sqrt(dx * dx + dy * dy + dz * dz) - NodeRadius[node];
+
+  if (distance < MIN_DISTANCE) distance = MIN_DISTANCE;
+
+  // Pixels per world unit at distance one.
+  F64 scale = camera.ViewportHeight / (2.0 * tan(0.5 * camera.FieldOfView));
+
+  return (F32)(NodeError[node] * scale / distance);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapLod.h)
+////////////////////////////////////////////////////////////////////////////////
+U16
+IcosMapLod::Select(
+    const Camera & camera,
+    F32 maxScreenError,
+    Tile tile[],
+    U16 maxTileCount
+    ) const throw (Exception::Type)
+{
+  if (! ((0u < LevelCount) && (nullptr != tile)))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  // split[node] is set for every node replaced by its children. A node is in
+  // the tree when it is a root or its parent is split.
+  U8 split[MAX_NODE_COUNT];
+  memset(split, 0, sizeof(split));
+
+  Tile node;
+  node.CoarserEdges = 0u;
+
+  // Split by screen error, coarsest level first.
+  for (U8 level = 0; level + 1u < LevelCount; ++level)
+  {
+    node.Level = level;
+
+    for (node.Diamond = 0; node.Diamond < ICOS_DIAMOND_COUNT; ++node.Diamond)
+    {
+      for (node.Y = 0; node.Y < (1u << level); ++node.Y)
+      {
+        for (node.X = 0; node.X < (1u << level); ++node.X)
+        {
+          if ((0u < level) && ! split[GetNodeIndex(node.Diamond, level - 1u, node.X / 2u, node.Y / 2u)]) continue;
+
+          if (maxScreenError < GetScreenError(camera, node))
+          {
+            split[GetNodeIndex(node.Diamond, level, node.X, node.Y)] = 1u;
+          }
+        }
+      }
+    }
+  }
+
+  // Split leaves next to tiles two or more levels finer until every pair of
+  // tiles sharing an edge differs by at most one level.
+  bool isChanged = true;
+  while (isChanged)
+  {
+    isChanged = false;
+
+    for (U8 level = 0; level + 2u < LevelCount; ++level)
+    {
+      node.Level = level;
+
+      for (node.Diamond = 0; node.Diamond < ICOS_DIAMOND_COUNT; ++node.Diamond)
+      {
+        for (node.Y = 0; node.Y < (1u << level); ++node.Y)
+        {
+          for (node.X = 0; node.X < (1u << level); ++node.X)
+          {
+            U16 index = GetNodeIndex(node.Diamond, level, node.X, node.Y);
+
+            if (split[index]) continue;
+            if ((0u < level) && ! split[GetNodeIndex(node.Diamond, level - 1u, node.X / 2u, node.Y / 2u)]) continue;
+
+            for (U8 e = 0; e < EDGE_COUNT; ++e)
+            {
+              if (IsNeighborSplit(split, node, e))
+              {
+                split[index] = 1u;
+                isChanged = true;
+                break;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // Collect the leaves and the edges they share with coarser leaves.
+  U16 tileCount = 0u;
+
+  for (U8 level = 0; level < LevelCount; ++level)
+  {
+    node.Level = level;
+
+    for (node.Diamond = 0; node.Diamond < ICOS_DIAMOND_COUNT; ++node.Diamond)
+    {
+      for (node.Y = 0; node.Y < (1u << level); ++node.Y)
+      {
+        for (node.X = 0; node.X < (1u << level); ++node.X)
+        {
+          if (split[GetNodeIndex(node.Diamond, level, node.X, node.Y)]) continue;
+          if ((0u < level) && ! split[GetNodeIndex(node.Diamond, level - 1u, node.X / 2u, node.Y / 2u)]) continue;
+
+          if (maxTileCount <= tileCount)
+          {
+            throw (Exception::PARAMETER_ERROR);
+          }
+
+          Tile & out = tile[tileCount++];
+          out = node;
+          out.CoarserEdges = 0u;
+          out.ScreenError = GetScreenError(camera, node);
+
+          for (U8 e = 0; (e < EDGE_COUNT) && (0u < level); ++e)
+          {
+            U8 neighborDiamond, neighborEdge;
+            U16 neighborX, neighborY;
+            GetNeighbor(node.Diamond, level, node.X, node.Y, e, neighborDiamond, neighborX, neighborY, neighborEdge);
+
+            if (! split[GetNodeIndex(neighborDiamond, level - 1u, neighborX / 2u, neighborY / 2u)])
+            {
+              out.CoarserEdges |= (U8)(1u << e);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  return tileCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapLod.h)
+////////////////////////////////////////////////////////////////////////////////
+void IcosMapLod::GetTileVertices(const Tile & tile, F32 position[][3]) const throw (Exception::Type)
+{
+  if (! (IsTileValid(tile) && (nullptr != position)))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  for (U16 b = 0; b <= TILE_RESOLUTION; ++b)
+  {
+    U16 k = GetLatticeCoordinate(tile.Level, tile.Y, b);
+
+    for (U16 a = 0; a <= TILE_RESOLUTION; ++a)
+    {
+      U16 i = GetLatticeCoordinate(tile.Level, tile.X, a);
+      const F32 * cell = CellPosition[LatticeCell[tile.Diamond][i * (Size + 1u) + k]];
+
+      F32 * out = position[b * (TILE_RESOLUTION + 1u) + a];
+      out[0] = cell[0];
+      out[1] = cell[1];
+      out[2] = cell[2];
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapLod.h)
+////////////////////////////////////////////////////////////////////////////////
+U16 IcosMapLod::GetTileTriangles(const Tile & tile, U16 index[]) const throw (Exception::Type)
+{
+  if (! (IsTileValid(tile) && (nullptr != index)))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  const U16 row = TILE_RESOLUTION + 1u;
+
+  // Samples on the same lattice point, which only the finest level has, are
+  // merged into the first of them, so the finest tiles draw exactly the
+  // triangles of the cell lattice.
+  U16 firstA[TILE_RESOLUTION + 1u];
+  U16 firstB[TILE_RESOLUTION + 1u];
+  for (U16 a = 0; a <= TILE_RESOLUTION; ++a)
+  {
+    bool isSameA = (0u < a) && (GetLatticeCoordinate(tile.Level, tile.X, a) == GetLatticeCoordinate(tile.Level, tile.X, a - 1u));
+    bool isSameB = (0u < a) && (GetLatticeCoordinate(tile.Level, tile.Y, a) == GetLatticeCoordinate(tile.Level, tile.Y, a - 1u));
+    firstA[a] = isSameA ? firstA[a - 1u] : a;
+    firstB[a] = isSameB ? firstB[a - 1u] : a;
+  }
+
+  U16 sample[TILE_VERTEX_COUNT];
+  for (U16 b = 0; b <= TILE_RESOLUTION; ++b)
+  {
+    for (U16 a = 0; a <= TILE_RESOLUTION; ++a)
+    {
+      sample[b * row + a] = firstB[b] * row + firstA[a];
+    }
+  }
+
+  // Stitching moves each odd sample of an edge onto an even neighbor; the
+  // triangles this collapses are dropped. Odd samples of the v = 1 edge move
+  // forward rather than back, or the quad at the u = 1, v = 1 corner would
+  // collapse onto its own diagonal.
+  for (U8 e = 0; e < EDGE_COUNT; ++e)
+  {
+    if (0u == (tile.CoarserEdges & (1u << e))) continue;
+
+    for (U16 j = 1; j < TILE_RESOLUTION; j += 2u)
+    {
+      sample[GetEdgeSample(e, j)] = sample[GetEdgeSample(e, (EDGE_V1 == e) ? j + 1u : j - 1u)];
+    }
+  }
+
+  const bool isMirrored = IsMirrored[tile.Diamond];
+  U16 triangleCount = 0u;
+
+  for (U16 b = 0; b < TILE_RESOLUTION; ++b)
+  {
+    for (U16 a = 0; a < TILE_RESOLUTION; ++a)
+    {
+      // Each quad is split along its (a+1,b)-(a,b+1) diagonal, the same way
+      // the cell lattice is.
+      U16 corner[2][3] = {
+          { sample[b * row + a],             sample[b * row + a + 1u],       sample[(b + 1u) * row + a] },
+          { sample[(b + 1u) * row + a + 1u], sample[(b + 1u) * row + a],     sample[b * row + a + 1u] } };
+
+      for (U8 t = 0; t < 2u; ++t)
+      {
+        const U16 * c = corner[t];
+
+        if ((c[0] == c[1]) || (c[1] == c[2]) || (c[2] == c[0])) continue;
+
+        U16 * out = &index[3u * triangleCount++];
+        out[0] = c[0];
+        out[1] = isMirrored ? c[2] : c[1];
+        out[2] = isMirrored ? c[1] : c[2];
+      }
+    }
+  }
+
+  return triangleCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns true for a tile of an initialized hierarchy.
+////////////////////////////////////////////////////////////////////////////////
+bool IcosMapLod::IsTileValid(const Tile & tile) const throw ()
+{
+  return ((tile.Diamond < ICOS_DIAMOND_COUNT) && (tile.Level < LevelCount) &&
+          (tile.X < (1u << tile.Level)) && (tile.Y < (1u << tile.Level)));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the lattice coordinate of sample a of tile x, along u, or tile y,
+//! along v, of a level: the lattice point nearest the sample's place among
+//! the TILE_RESOLUTION * 2^level equal steps across the diamond. Sample 2j of
+//! a level lands where sample j of the level above does.
+////////////////////////////////////////////////////////////////////////////////
+U16 IcosMapLod::GetLatticeCoordinate(U8 level, U16 tile, U16 a) const throw ()
+{
+  const U32 stepCount = (U32)TILE_RESOLUTION << level;
+
+  return (U16)(((tile * TILE_RESOLUTION + a) * 2u * Size + stepCount) / (2u * stepCount));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the node of tile (x,y) of a level of a diamond. Each diamond's
+//! nodes are stored level by level, rows of 2^level nodes.
+////////////////////////////////////////////////////////////////////////////////
+U16 IcosMapLod::GetNodeIndex(U8 diamond, U8 level, U16 x, U16 y) const throw ()
+{
+  return diamond * NODES_PER_DIAMOND + ((1u << (2u * level)) - 1u) / 3u + y * (1u << level) + x;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Finds the tile of the same level across an edge, in the same diamond or
+//! the adjacent one, and the edge of that tile they share.
+////////////////////////////////////////////////////////////////////////////////
+bool
+IcosMapLod::GetNeighbor(
+    U8 diamond,
+    U8 level,
+    U16 x,
+    U16 y,
+    U8 edge,
+    U8 & neighborDiamond,
+    U16 & neighborX,
+    U16 & neighborY,
+    U8 & neighborEdge
+    ) const throw ()
+{
+  const U16 last = (1u << level) - 1u;
+
+  neighborDiamond = diamond;
+  neighborX = x;
+  neighborY = y;
+  neighborEdge = (edge + 2u) % EDGE_COUNT;
+
+  switch (edge)
+  {
+    case EDGE_U0: if (0u < x)    { neighborX = x - 1u; return true; } break;
+    case EDGE_V0: if (0u < y)    { neighborY = y - 1u; return true; } break;
+    case EDGE_U1: if (x < last)  { neighborX = x + 1u; return true; } break;
+    default:      if (y < last)  { neighborY = y + 1u; return true; } break;
+  }
+
+  const Neighbor & across = DiamondNeighbor[diamond][edge];
+  U16 along = ((EDGE_U0 == edge) || (EDGE_U1 == edge)) ? y : x;
+
+  if (across.IsReversed) along = last - along;
+
+  neighborDiamond = across.Diamond;
+  neighborEdge = across.Edge;
+
+  switch (across.Edge)
+  {
+    case EDGE_U0: neighborX = 0u;   neighborY = along; break;
+    case EDGE_V0: neighborX = along; neighborY = 0u;   break;
+    case EDGE_U1: neighborX = last; neighborY = along; break;
+    default:      neighborX = along; neighborY = last; break;
+  }
+
+  return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns true when the tile across an edge holds tiles two or more levels
+//! finer than tile along that edge.
+////////////////////////////////////////////////////////////////////////////////
+bool IcosMapLod::IsNeighborSplit(const U8 split[], const Tile & tile, U8 edge) const throw ()
+{
+  U8 diamond, neighborEdge;
+  U16 x, y;
+  GetNeighbor(tile.Diamond, tile.Level, tile.X, tile.Y, edge, diamond, x, y, neighborEdge);
+
+  if (! split[GetNodeIndex(diamond, tile.Level, x, y)])
+  {
+    return false;
+  }
+
+  for (U16 j = 0; j < 2u; ++j)
+  {
+    U16 childX = 2u * x, childY = 2u * y;
+
+    switch (neighborEdge)
+    {
+      case EDGE_U0: childY += j; break;
+      case EDGE_V0: childX += j; break;
+      case EDGE_U1: childX += 1u; childY += j; break;
+      default:      childX += j; childY += 1u; break;
+    }
+
+    if (split[GetNodeIndex(diamond, tile.Level + 1u, childX, childY)])
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the displaced center of a cell.
+////////////////////////////////////////////////////////////////////////////////
+void IcosMapLod::GetPosition(U16 cellID, F64 position[3]) const throw ()
+{
+  position[0] = CellPosition[cellID][0];
+  position[1] = CellPosition[cellID][1];
+  position[2] = CellPosition[cellID][2];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the point at fraction t from cell A towards cell B. The point is
+//! always interpolated from the lower cell ID, so the two diamonds sharing a
+//! segment, which walk it in either direction, compute identical points.
+////////////////////////////////////////////////////////////////////////////////
+void IcosMapLod::EvaluateSegment(U16 cellA, U16 cellB, F64 t, F64 position[3]) const throw ()
+{
+  if (0.0 == t)
+  {
+    GetPosition(cellA, position);
+    return;
+  }
+
+  if (cellB < cellA)
+  {
+    U16 swap = cellA;
+    cellA = cellB;
+    cellB = swap;
+    t = 1.0 - t;
+  }
+
+  F64 a[3], b[3];
+  GetPosition(cellA, a);
+  GetPosition(cellB, b);
+
+  for (U8 j = 0; j < 3u; ++j)
+  {
+    position[j] = a[j] + t * (b[j] - a[j]);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the point of the primal surface at (u,v) of a diamond.
+////////////////////////////////////////////////////////////////////////////////
+void IcosMapLod::Evaluate(U8 diamond, F64 u, F64 v, F64 position[3]) const throw ()
+{
+  const U16 * cell = LatticeCell[diamond];
+  const U16 row = Size + 1u;
+  const F64 x = u * Size;
+  const F64 y = v * Size;
+
+  // Boundary points are interpolated along the boundary alone.
+  if ((0.0 == u) || (1.0 == u))
+  {
+    U16 i = (0.0 == u) ? 0u : Size;
+    U16 k = (U16)floor(y);
+
+    if (Size == k) GetPosition(cell[i * row + k], position);
+    else EvaluateSegment(cell[i * row + k], cell[i * row + k + 1u], y - k, position);
+    return;
+  }
+
+  if ((0.0 == v) || (1.0 == v))
+  {
+    U16 k = (0.0 == v) ? 0u : Size;
+    U16 i = (U16)floor(x);
+
+    if (Size == i) GetPosition(cell[i * row + k], position);
+    else EvaluateSegment(cell[i * row + k], cell[(i + 1u) * row + k], x - i, position);
+    return;
+  }
+
+  U16 i = (U16)floor(x);
+  U16 k = (U16)floor(y);
+  F64 fx = x - i;
+  F64 fy = y - k;
+
+  F64 origin[3], alongX[3], alongY[3];
+
+  if (fx + fy <= 1.0)
+  {
+    GetPosition(cell[i * row + k], origin);
+    GetPosition(cell[(i + 1u) * row + k], alongX);
+    GetPosition(cell[i * row + k + 1u], alongY);
+  }
+  else
+  {
+    GetPosition(cell[(i + 1u) * row + k + 1u], origin);
+    GetPosition(cell[i * row + k + 1u], alongX);
+    GetPosition(cell[(i + 1u) * row + k], alongY);
+    fx = 1.0 - fx;
+    fy = 1.0 - fy;
+  }
+
+  for (U8 j = 0; j < 3u; ++j)
+  {
+    position[j] = origin[j] + fx * (alongX[j] - origin[j]) + fy * (alongY[j] - origin[j]);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Computes the bounding sphere and own geometric error of a node: the
+//! distance from each cell center inside it to the surface of its samples.
+////////////////////////////////////////////////////////////////////////////////
+void IcosMapLod::BuildNode(U8 diamond, U8 level, U16 x, U16 y) throw ()
+{
+  const U16 row = TILE_RESOLUTION + 1u;
+  const F64 extent = 1.0 / (1u << level);
+  const F64 u0 = x * extent;
+  const F64 v0 = y * extent;
+
+  // Lattice coordinates of the samples along u and v.
+  U16 sampleI[TILE_RESOLUTION + 1u];
+  U16 sampleK[TILE_RESOLUTION + 1u];
+  for (U16 a = 0; a <= TILE_RESOLUTION; ++a)
+  {
+    sampleI[a] = GetLatticeCoordinate(level, x, a);
+    sampleK[a] = GetLatticeCoordinate(level, y, a);
+  }
+
+  F64 sample[TILE_VERTEX_COUNT][3];
+  for (U16 b = 0; b <= TILE_RESOLUTION; ++b)
+  {
+    for (U16 a = 0; a <= TILE_RESOLUTION; ++a)
+    {
+      GetPosition(LatticeCell[diamond][sampleI[a] * (Size + 1u) + sampleK[b]], sample[b * row + a]);
+    }
+  }
+
+  F64 center[3];
+  Evaluate(diamond, u0 + 0.5 * extent, v0 + 0.5 * extent, center);
+
+  F64 radius = 0.0;
+  for (U16 s = 0; s < TILE_VERTEX_COUNT; ++s)
+  {
+    F64 dx = sample[s][0] - center[0], dy = sample[s][1] - center[1], dz = sample[s][2] - center[2];
+    F64 distance = sqrt(dx * dx + dy * dy + dz * dz);
+    if (radius < distance) radius = distance;
+  }
+
+  F64 error = 0.0;
+
+  // Every cell center of the node, between its first and last samples.
+  U16 a = 0u;
+  for (U16 i = sampleI[0]; i <= sampleI[TILE_RESOLUTION]; ++i)
+  {
+    while ((a + 1u < TILE_RESOLUTION) && (sampleI[a + 1u] <= i)) ++a;
+
+    U16 b = 0u;
+    for (U16 k = sampleK[0]; k <= sampleK[TILE_RESOLUTION]; ++k)
+    {
+      while ((b + 1u < TILE_RESOLUTION) && (sampleK[b + 1u] <= k)) ++b;
+
+      F64 point[3];
+      GetPosition(LatticeCell[diamond][i * (Size + 1u) + k], point);
+
+      // The sample triangle over the cell, split like GetTileTriangles(). A
+      // cell on a sample has a weight of exactly one on it, so its error is
+      // exactly zero.
+      U16 widthA = sampleI[a + 1u] - sampleI[a];
+      U16 widthB = sampleK[b + 1u] - sampleK[b];
+      F64 fa = (0u < widthA) ? (F64)(i - sampleI[a]) / widthA : 0.0;
+      F64 fb = (0u < widthB) ? (F64)(k - sampleK[b]) / widthB : 0.0;
+
+      const F64 * origin = sample[b * row + a];
+      const F64 * alongA = sample[b * row + a + 1u];
+      const F64 * alongB = sample[(b + 1u) * row + a];
+
+      if (1.0 < fa + fb)
+      {
+        origin = sample[(b + 1u) * row + a + 1u];
+        alongA = sample[(b + 1u) * row + a];
+        alongB = sample[b * row + a + 1u];
+        fa = 1.0 - fa;
+        fb = 1.0 - fb;
+      }
+
+      F64 d[3];
+      for (U8 j = 0; j < 3u; ++j)
+      {
+        d[j] = (1.0 - fa - fb) * origin[j] + fa * alongA[j] + fb * alongB[j] - point[j];
+      }
+
+      F64 distance = sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+      if (error < distance) error = distance;
+
+      F64 dx = point[0] - center[0], dy = point[1] - center[1], dz = point[2] - center[2];
+      distance = sqrt(dx * dx + dy * dy + dz * dz);
+      if (radius < distance) radius = distance;
+    }
+  }
+
+  U16 node = GetNodeIndex(diamond, level, x, y);
+  NodeError[node] = (F32)error;
+  NodeCenter[node][0] = (F32)center[0];
+  NodeCenter[node][1] = (F32)center[1];
+  NodeCenter[node][2] = (F32)center[2];
+  // Rounded up so the sphere still bounds the node's samples.
+  NodeRadius[node] = (F32)radius * 1.0001f + 1.0e-6f;
+}
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
@@ -0,0 +1,218 @@
+#pragma once
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ * Oct 19, 2026 |---| sample tiles at cell centers, down to every cell
+ *
+ * ****************************************************************************/
+
+#include "Exception.h"
+#include "IcosDiamond.h"
+#include "IcosMap.h"
+#include "NativeTypes.h"
+
+////////////////////////////////////////////////////////////////////////////////
+//! Level of detail hierarchy of a map's surface, and the selector choosing the
+//! tiles to draw for a camera.
+//!
+//! Each of the 10 diamonds is a quadtree of tiles. A level L tile (x,y) covers
+//! the square [x,x+1] x [y,y+1] / 2^L of the diamond's (u,v) parameters, where
+//! u = i/n runs towards L and v = k/n towards R, and is drawn as a grid of
+//! TILE_RESOLUTION x TILE_RESOLUTION quads. Every sample is the displaced
+//! center of a cell, the lattice point nearest the sample's place in equal
+//! steps across the diamond, so a tile's four children share every other
+//! sample of its edges. Levels are added until the finest has at least as
+//! many steps as there are cells along a diamond edge; its samples then reach
+//! every lattice point, those on the same point are merged, and its tiles
+//! draw exactly the primal surface, the triangles between the centers of
+//! adjacent cells: 20 * size^2 triangles and no error.
+//!
+//! A tile's geometric error is the largest distance from a cell center inside
+//! it to its surface, and never less than its children's. The selector splits
+//! tiles whose error projected onto the screen exceeds a pixel threshold, then
+//! splits further until tiles sharing an edge, in the same diamond or across
+//! diamonds, differ by at most one level. A tile next to a coarser one drops
+//! the odd samples of that edge, so the two meet without cracks.
+////////////////////////////////////////////////////////////////////////////////
+class IcosMapLod
+{
+public:
+
+  IcosMapLod();
+
+  ~IcosMapLod();
+
+  //! Quads along each side of a tile; even, so edges can be stitched.
+  static const U8 TILE_RESOLUTION = 8u;
+  static const U16 TILE_VERTEX_COUNT = (TILE_RESOLUTION + 1u) * (TILE_RESOLUTION + 1u);
+  static const U16 MAX_TILE_TRIANGLE_COUNT = 2u * TILE_RESOLUTION * TILE_RESOLUTION;
+
+  //! Enough levels for IcosMap::MAX_SIZE cells along a diamond edge.
+  static const U8 MAX_LEVEL_COUNT = 4u;
+  static const U16 MAX_TILE_COUNT = ICOS_DIAMOND_COUNT * (1u << (2u * (MAX_LEVEL_COUNT - 1u)));
+
+  //! Edges of a tile: u = 0 (towards T-R), v = 0 (T-L), u = 1 (L-B), v = 1
+  //! (R-B) within its square.
+  static const U8 EDGE_U0 = 0u;
+  static const U8 EDGE_V0 = 1u;
+  static const U8 EDGE_U1 = 2u;
+  static const U8 EDGE_V1 = 3u;
+  static const U8 EDGE_COUNT = 4u;
+
+  struct Camera
+  {
+    F32 Position[3];
+    //! Vertical field of view in radians.
+    F32 FieldOfView;
+    //! Height of the viewport in pixels.
+    F32 ViewportHeight;
+  };
+
+  struct Tile
+  {
+    U8 Diamond;
+    U8 Level;
+    U16 X;
+    U16 Y;
+    //! Bit (1 << edge) set for each edge next to a coarser tile.
+    U8 CoarserEdges;
+    //! Projected geometric error in pixels.
+    F32 ScreenError;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Builds the hierarchy from the map's current elevations. Call again after
+  //! the elevations change.
+  //////////////////////////////////////////////////////////////////////////////
+  void Initialize(const IcosMap & map) throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the number of levels, 0 before Initialize().
+  //////////////////////////////////////////////////////////////////////////////
+  U8 GetLevelCount() const throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the geometric error of a tile in world units.
+  //////////////////////////////////////////////////////////////////////////////
+  F32 GetGeometricError(const Tile & tile) const throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the geometric error of a tile projected onto the screen, in
+  //! pixels, from the nearest point of its bounding sphere.
+  //////////////////////////////////////////////////////////////////////////////
+  F32 GetScreenError(const Camera & camera, const Tile & tile) const throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Selects the tiles to draw so that no tile's screen error exceeds
+  //! maxScreenError unless it is at the finest level. Writes at most
+  //! maxTileCount tiles to tile[] and returns how many; MAX_TILE_COUNT always
+  //! suffices.
+  //////////////////////////////////////////////////////////////////////////////
+  U16 Select(
+      const Camera & camera,
+      F32 maxScreenError,
+      Tile tile[],
+      U16 maxTileCount
+      ) const throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Writes the TILE_VERTEX_COUNT sample positions of a tile, sample (a,b) at
+  //! position[b * (TILE_RESOLUTION + 1) + a] with a along u and b along v.
+  //! Samples shared by two tiles are bit identical.
+  //////////////////////////////////////////////////////////////////////////////
+  void GetTileVertices(const Tile & tile, F32 position[][3]) const throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Writes the triangles of a tile as indices into its samples, wound
+  //! counterclockwise seen from outside the sphere and stitched along its
+  //! CoarserEdges. Returns the number of triangles, at most
+  //! MAX_TILE_TRIANGLE_COUNT.
+  //////////////////////////////////////////////////////////////////////////////
+  U16 GetTileTriangles(const Tile & tile, U16 index[]) const throw (Exception::Type);
+
+private:
+
+  IcosMapLod(const IcosMapLod &);
+  IcosMapLod & operator=(const IcosMapLod &);
+
+  static const U16 MAX_LATTICE_POINT_COUNT = (IcosMap::MAX_SIZE + 1u) * (IcosMap::MAX_SIZE + 1u);
+  static const U16 NODES_PER_DIAMOND = ((1u << (2u * MAX_LEVEL_COUNT)) - 1u) / 3u;
+  static const U16 MAX_NODE_COUNT = ICOS_DIAMOND_COUNT * NODES_PER_DIAMOND;
+
+  //! The diamond edge across a boundary edge of each diamond.
+  struct Neighbor
+  {
+    U8 Diamond;
+    U8 Edge;
+    //! True when the two edges run in opposite directions.
+    bool IsReversed;
+  };
+
+  bool IsTileValid(const Tile & tile) const throw ();
+
+  U16 GetNodeIndex(U8 diamond, U8 level, U16 x, U16 y) const throw ();
+
+  bool GetNeighbor(
+      U8 diamond,
+      U8 level,
+      U16 x,
+      U16 y,
+      U8 edge,
+      U8 & neighborDiamond,
+      U16 & neighborX,
+      U16 & neighborY,
+      U8 & neighborEdge
+      ) const throw ();
+
+  bool IsNeighborSplit(const U8 split[], const Tile & tile, U8 edge) const throw ();
+
+  U16 GetLatticeCoordinate(U8 level, U16 tile, U16 a) const throw ();
+
+  void GetPosition(U16 cellID, F64 position[3]) const throw ();
+
+  void EvaluateSegment(U16 cellA, U16 cellB, F64 t, F64 position[3]) const throw ();
+
+  void Evaluate(U8 diamond, F64 u, F64 v, F64 position[3]) const throw ();
+
+  void BuildNode(U8 diamond, U8 level, U16 x, U16 y) throw ();
+
+  //! Cells along a diamond edge.
+  U16 Size;
+  //! Number of levels.
+  U8 LevelCount;
+  //! Displaced center of each cell.
+  F32 CellPosition[IcosMap::MAX_CELL_COUNT][3];
+  //! Cell at lattice point (i,k), i * (Size + 1) + k, of each diamond.
+  U16 LatticeCell[ICOS_DIAMOND_COUNT][MAX_LATTICE_POINT_COUNT];
+  Neighbor DiamondNeighbor[ICOS_DIAMOND_COUNT][EDGE_COUNT];
+  //! True for diamonds whose (u,v) frame is clockwise seen from outside.
+  bool IsMirrored[ICOS_DIAMOND_COUNT];
+  //! Geometric error and bounding sphere of each node.
+  F32 NodeError[MAX_NODE_COUNT];
+  F32 NodeCenter[MAX_NODE_COUNT][3];
+  F32 NodeRadius[MAX_NODE_COUNT];
+};
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
@@ -0,0 +1,338 @@
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ *
+ * ****************************************************************************/
+
+
+#include <string.h>
+
+#include "IcosMapMesh.h"
+
+//! Radius of a cell of elevation zero, as drawn by IcosCellView.
+static const F32 BASE_RADIUS = 0.8f;
+//! Radius added per unit of elevation, as drawn by IcosCellView.
+static const F32 ELEVATION_SCALE = 0.2f;
+
+////////////////////////////////////////////////////////////////////////////////
+//! Stores the X, Y, Z of a vector into three floats.
+////////////////////////////////////////////////////////////////////////////////
+static inline void Store(const Vector & v, F32 out[3]) throw ()
+{
+  out[0] = v.X;
+  out[1] = v.Y;
+  out[2] = v.Z;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapMesh.h)
+////////////////////////////////////////////////////////////////////////////////
+IcosMapMesh::IcosMapMesh(
+    )
+    : Topology(nullptr)
+    , CellCount(0u)
+    , CornerCount(0u)
+{
+  TriangleOffset[0] = 0u;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapMesh.h)
+////////////////////////////////////////////////////////////////////////////////
+IcosMapMesh::~IcosMapMesh(
+    )
+{
+  if (Topology != nullptr)
+  {
+    Topology->Release();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapMesh.h)
+//
+// Each corner is numbered by the lowest of its three cells, in that cell's
+// adjacency order; the other two cells then find it in the owner's ring.
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapMesh::Initialize(
+    const IcosTopology & topology
+    ) throw (Exception::Type)
+{
+  topology.AddReference();
+  if (Topology != nullptr)
+  {
+    Topology->Release();
+  }
+  Topology = &topology;
+
+  CellCount = topology.GetCellCount();
+  CornerCount = 0u;
+
+  for (U32 c = 0; c < CellCount; ++c)
+  {
+    const IcosCell & cell = topology.GetCell(c);
+    U8 count = cell.AdjacentCount;
+
+    TriangleOffset[c + 1u] = TriangleOffset[c] + count;
+
+    for (U8 i = 0; i < count; ++i)
+    {
+      U16 a = cell.AdjacentID[i];
+      U16 b = cell.AdjacentID[(i + 1u) % count];
+
+      if ((c < a) && (c < b))
+      {
+        CornerCell[CornerCount][0] = (U16)c;
+        CornerCell[CornerCount][1] = a;
+        CornerCell[CornerCount][2] = b;
+        CellCorner[c][i] = CellCount + CornerCount++;
+      }
+    }
+
+    // Winding of the ring, from its first two corners.
+    const Vector & center = cell.Normal;
+    Vector edge0 = topology.GetCell(cell.AdjacentID[0]).Normal - center;
+    Vector edge1 = topology.GetCell(cell.AdjacentID[1]).Normal - center;
+    IsClockwise[c] = (Vector::CrossProduct(edge0, edge1) * center < 0.0f);
+  }
+
+  if (CornerCount != 2u * CellCount - 4u)
+  {
+    throw (Exception::INITIALIZATION_ERROR);
+  }
+
+  for (U32 c = 0; c < CellCount; ++c)
+  {
+    const IcosCell & cell = topology.GetCell(c);
+    U8 count = cell.AdjacentCount;
+
+    for (U8 i = 0; i < count; ++i)
+    {
+      U16 a = cell.AdjacentID[i];
+      U16 b = cell.AdjacentID[(i + 1u) % count];
+
+      if ((c < a) && (c < b)) continue;
+
+      U16 owner = (a < b) ? a : b;
+      U16 other = (a < b) ? b : a;
+      const IcosCell & ownerCell = topology.GetCell(owner);
+      U8 ownerCount = ownerCell.AdjacentCount;
+      U8 j = 0;
+
+      for (; j < ownerCount; ++j)
+      {
+        U16 p = ownerCell.AdjacentID[j];
+        U16 q = ownerCell.AdjacentID[(j + 1u) % ownerCount];
+
+        if (((p == c) && (q == other)) || ((p == other) && (q == c))) break;
+      }
+
+      if (j == ownerCount)
+      {
+        throw (Exception::INITIALIZATION_ERROR);
+      }
+
+      CellCorner[c][i] = CellCorner[owner][j];
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapMesh.h)
+////////////////////////////////////////////////////////////////////////////////
+U32
+IcosMapMesh::GetCellCount(
+    ) const throw ()
+{
+  return CellCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapMesh.h)
+////////////////////////////////////////////////////////////////////////////////
+U32
+IcosMapMesh::GetCornerCount(
+    ) const throw ()
+{
+  return CornerCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapMesh.h)
+////////////////////////////////////////////////////////////////////////////////
+U32
+IcosMapMesh::GetVertexCount(
+    ) const throw ()
+{
+  return CellCount + CornerCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapMesh.h)
+////////////////////////////////////////////////////////////////////////////////
+U32
+IcosMapMesh::GetTriangleCount(
+    ) const throw ()
+{
+  return TriangleOffset[CellCount];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapMesh.h)
+////////////////////////////////////////////////////////////////////////////////
+U32
+IcosMapMesh::GetTriangleOffset(
+    U32 cellID
+    ) const throw ()
+{
+  return TriangleOffset[cellID];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapMesh.h)
+////////////////////////////////////////////////////////////////////////////////
+U32
+IcosMapMesh::GetCornerVertex(
+    U16 cellID,
+    U8 i
+    ) const throw ()
+{
+  return CellCorner[cellID][i];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the displaced position of a corner.
+////////////////////////////////////////////////////////////////////////////////
+Vector
+IcosMapMesh::GetCornerPosition(
+    const F32 elevation[],
+    U32 corner
+    ) const throw ()
+{
+  const U16 * cell = CornerCell[corner];
+
+  Vector direction = Topology->GetCell(cell[0]).Normal
+      + Topology->GetCell(cell[1]).Normal
+      + Topology->GetCell(cell[2]).Normal;
+  direction.Normalize();
+
+  F32 sum = elevation[cell[0]] + elevation[cell[1]] + elevation[cell[2]];
+
+  return direction * (BASE_RADIUS + sum * (ELEVATION_SCALE / 3.0f));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapMesh.h)
+//
+// A center's normal is the area weighted normal of its fan; a corner's is the
+// normal of the triangle through its three displaced cell centers.
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapMesh::GetVertices(
+    const F32 elevation[],
+    U32 first,
+    U32 count,
+    SurfaceVertex vertex[]
+    ) const throw ()
+{
+  for (U32 v = first; v < first + count; ++v)
+  {
+    SurfaceVertex & out = vertex[v - first];
+    Vector position;
+    Vector normal;
+
+    if (v < CellCount)
+    {
+      const IcosCell & cell = Topology->GetCell(v);
+      U8 ringCount = cell.AdjacentCount;
+
+      position = cell.Normal * (BASE_RADIUS + elevation[v] * ELEVATION_SCALE);
+
+      Vector previous = GetCornerPosition(elevation, CellCorner[v][ringCount - 1u] - CellCount) - position;
+
+      for (U8 i = 0; i < ringCount; ++i)
+      {
+        Vector next = GetCornerPosition(elevation, CellCorner[v][i] - CellCount) - position;
+        normal = normal + Vector::CrossProduct(previous, next);
+        previous = next;
+      }
+
+      out.Shade = elevation[v];
+    }
+    else
+    {
+      U32 corner = v - CellCount;
+      const U16 * cell = CornerCell[corner];
+
+      position = GetCornerPosition(elevation, corner);
+
+      Vector a = Topology->GetCell(cell[0]).Normal * (BASE_RADIUS + elevation[cell[0]] * ELEVATION_SCALE);
+      Vector b = Topology->GetCell(cell[1]).Normal * (BASE_RADIUS + elevation[cell[1]] * ELEVATION_SCALE);
+      Vector c = Topology->GetCell(cell[2]).Normal * (BASE_RADIUS + elevation[cell[2]] * ELEVATION_SCALE);
+      normal = Vector::CrossProduct(b - a, c - a);
+
+      out.Shade = (elevation[cell[0]] + elevation[cell[1]] + elevation[cell[2]]) / 3.0f;
+    }
+
+    // Point the normal outward whatever the winding it was built from.
+    if (normal * position < 0.0f) normal = normal * -1.0f;
+    normal.Normalize();
+
+    Store(position, out.Position);
+    Store(normal, out.Normal);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapMesh.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapMesh::GetTriangles(
+    U32 firstCell,
+    U32 cellCount,
+    U32 index[]
+    ) const throw ()
+{
+  U32 * out = index;
+
+  for (U32 c = firstCell; c < firstCell + cellCount; ++c)
+  {
+    U8 ringCount = (U8)(TriangleOffset[c + 1u] - TriangleOffset[c]);
+    U8 second = IsClockwise[c] ? 2u : 1u;
+
+    for (U8 i = 0; i < ringCount; ++i)
+    {
+      U32 corner[3] = { c, CellCorner[c][i], CellCorner[c][(i + 1u) % ringCount] };
+
+      *out++ = corner[0];
+      *out++ = corner[second];
+      *out++ = corner[3u - second];
+    }
+  }
+}
+
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
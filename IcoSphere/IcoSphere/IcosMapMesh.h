@@ -0,0 +1,153 @@
+#pragma once
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ * Oct 19, 2026 |---| added access to the topology
+ *
+ * ****************************************************************************/
+
+
+#include "Exception.h"
+#include "IcosCell.h"
+#include "IcosMap.h"
+#include "IcosTopology.h"
+#include "NativeTypes.h"
+
+////////////////////////////////////////////////////////////////////////////////
+//! Indexed, watertight surface mesh of a map: the same hexagon and pentagon
+//! fans IcosCellView draws, but with each polygon corner stored once and
+//! shared by the three cells that meet there.
+//!
+//! A corner is one triangle of the grid, three mutually adjacent cells. The
+//! vertices of the mesh are the cell centers, vertex c for cell c, followed by
+//! the corners. Cell c is drawn as a fan of GetAdjacentCount() triangles, from
+//! its center to each pair of consecutive corners, wound counterclockwise seen
+//! from outside the sphere. The fan triangles of cell c start at triangle
+//! GetTriangleOffset(c), so any range of cells can be triangulated
+//! independently.
+//!
+//! A center is displaced by its cell's elevation and a corner by the mean
+//! elevation of its three cells. A corner lies in the direction of the sum of
+//! its cells' unit positions, so all three cells agree on it.
+////////////////////////////////////////////////////////////////////////////////
+class IcosMapMesh
+{
+public:
+
+  IcosMapMesh();
+
+  ~IcosMapMesh();
+
+  static const U32 MAX_CORNER_COUNT = 2u * IcosMap::MAX_CELL_COUNT - 4u;
+  static const U32 MAX_VERTEX_COUNT = IcosMap::MAX_CELL_COUNT + MAX_CORNER_COUNT;
+
+  struct SurfaceVertex
+  {
+    F32 Position[3];
+    F32 Normal[3];
+    //! Grey level of the vertex, its (mean) elevation in [0,1].
+    F32 Shade;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Builds the corner table of a topology.
+  //////////////////////////////////////////////////////////////////////////////
+  void Initialize(const IcosTopology & topology) throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the topology the mesh was built for, or null.
+  //////////////////////////////////////////////////////////////////////////////
+  inline const IcosTopology * GetTopology() const throw () { return Topology; }
+
+  U32 GetCellCount() const throw ();
+
+  U32 GetCornerCount() const throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the number of vertices, centers and corners.
+  //////////////////////////////////////////////////////////////////////////////
+  U32 GetVertexCount() const throw ();
+
+  U32 GetTriangleCount() const throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the first fan triangle of a cell; GetTriangleOffset(cellCount) is
+  //! the triangle count.
+  //////////////////////////////////////////////////////////////////////////////
+  U32 GetTriangleOffset(U32 cellID) const throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the vertex of corner i of a cell, the corner between adjacent
+  //! cells i and i+1.
+  //////////////////////////////////////////////////////////////////////////////
+  U32 GetCornerVertex(U16 cellID, U8 i) const throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Computes vertices [first, first + count) for the given cell elevations.
+  //! Vertices depend on nothing but the elevations, so threads may compute
+  //! disjoint ranges at the same time.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  GetVertices(
+      const F32 elevation[],
+      U32 first,
+      U32 count,
+      SurfaceVertex vertex[]
+      ) const throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Writes three vertex indices for each fan triangle of cells [firstCell,
+  //! firstCell + cellCount) into index[], starting with triangle
+  //! GetTriangleOffset(firstCell).
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  GetTriangles(
+      U32 firstCell,
+      U32 cellCount,
+      U32 index[]
+      ) const throw ();
+
+private:
+
+  IcosMapMesh(const IcosMapMesh &);
+  IcosMapMesh & operator=(const IcosMapMesh &);
+
+  Vector GetCornerPosition(const F32 elevation[], U32 corner) const throw ();
+
+  const IcosTopology * Topology;
+  U32 CellCount;
+  U32 CornerCount;
+  //! Corner vertex of each corner of each cell, in adjacency order.
+  U32 CellCorner[IcosMap::MAX_CELL_COUNT][IcosCell::MAX_ADJACENT_CELLS];
+  //! True for cells whose adjacency runs clockwise seen from outside.
+  bool IsClockwise[IcosMap::MAX_CELL_COUNT];
+  //! First fan triangle of each cell, and the triangle count.
+  U32 TriangleOffset[IcosMap::MAX_CELL_COUNT + 1u];
+  //! The three cells meeting at each corner.
+  U16 CornerCell[MAX_CORNER_COUNT][3];
+};
+
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
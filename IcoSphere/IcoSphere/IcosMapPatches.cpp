@@ -0,0 +1,471 @@
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ * Oct 19, 2026 |---| patches may be built from a shared topology
+ *
+ * ****************************************************************************/
+
+
+#include "IcosMapPatches.h"
+
+static const U32 NO_SLOT = 0xFFFFFFFFu;
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the index of adjacentID in the adjacent cell list of cellID.
+////////////////////////////////////////////////////////////////////////////////
+static
+U16
+FindAdjacentIndex(
+    const IcosTopology & topology,
+    U16 cellID,
+    U16 adjacentID
+    ) throw (Exception::Type)
+{
+  const IcosCell & cell = topology.GetCell(cellID);
+
+  for (U16 i = 0; i < cell.AdjacentCount; ++i)
+  {
+    if (cell.AdjacentID[i] == adjacentID) return i;
+  }
+
+  throw (Exception::INITIALIZATION_ERROR);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Continues the straight line of cells previousID, cellID by one cell. The
+//! adjacent cells of a hexagonal cell are stored in rotational order, so the
+//! cell opposite previousID is three places further along.
+////////////////////////////////////////////////////////////////////////////////
+static
+U16
+Continue(
+    const IcosTopology & topology,
+    U16 previousID,
+    U16 cellID
+    ) throw (Exception::Type)
+{
+  const IcosCell & cell = topology.GetCell(cellID);
+
+  if (cell.AdjacentCount != IcosTopology::MAX_ADJACENT_CELLS)
+  {
+    throw (Exception::INITIALIZATION_ERROR);
+  }
+
+  U16 i = FindAdjacentIndex(topology, cellID, previousID);
+
+  return cell.AdjacentID[(i + 3u) % IcosTopology::MAX_ADJACENT_CELLS];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the cell other than excludedID adjacent to both cellID1 and cellID2.
+////////////////////////////////////////////////////////////////////////////////
+static
+U16
+FindCommonAdjacent(
+    const IcosTopology & topology,
+    U16 cellID1,
+    U16 cellID2,
+    U16 excludedID
+    ) throw (Exception::Type)
+{
+  const IcosCell & cell = topology.GetCell(cellID1);
+
+  for (U16 i = 0; i < cell.AdjacentCount; ++i)
+  {
+    U16 adjacentID = cell.AdjacentID[i];
+
+    if (adjacentID == excludedID) continue;
+
+    const IcosCell & other = topology.GetCell(cellID2);
+
+    for (U16 j = 0; j < other.AdjacentCount; ++j)
+    {
+      if (other.AdjacentID[j] == adjacentID) return adjacentID;
+    }
+  }
+
+  throw (Exception::INITIALIZATION_ERROR);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapPatches.h)
+////////////////////////////////////////////////////////////////////////////////
+IcosMapPatches::IcosMapPatches(
+    )
+    : Size(0u)
+    , Stride(0u)
+    , CellCount(0u)
+{
+  for (U8 p = 0; p < PATCH_COUNT; ++p) HaloCount[p] = 0u;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapPatches.h)
+////////////////////////////////////////////////////////////////////////////////
+IcosMapPatches::~IcosMapPatches(
+    )
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapPatches.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapPatches::Initialize(
+    const IcosMap & map
+    ) throw (Exception::Type)
+{
+  if (map.GetCellCount() == 0u)
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  Initialize(map.GetTopology());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapPatches.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapPatches::Initialize(
+    const IcosTopology & topology
+    ) throw (Exception::Type)
+{
+  Size = topology.GetSize();
+  Stride = Size + 2u;
+  CellCount = topology.GetCellCount();
+
+  for (U32 i = 0; i < GetSlotCount(); ++i) SlotCellID[i] = NO_CELL;
+  for (U16 i = 0; i < CellCount; ++i) OwnerSlot[i] = NO_SLOT;
+
+  U16 northID = topology.GetVertexCellID(0u);
+  U16 southID = topology.GetVertexCellID(11u);
+
+  SlotCellID[GetPoleSlot(0u)] = northID;
+  SlotCellID[GetPoleSlot(1u)] = southID;
+  OwnerSlot[northID] = GetPoleSlot(0u);
+  OwnerSlot[southID] = GetPoleSlot(1u);
+
+  for (U8 p = 0; p < PATCH_COUNT; ++p) BuildPatch(topology, p);
+
+  for (U16 i = 0; i < CellCount; ++i)
+  {
+    if (OwnerSlot[i] == NO_SLOT) throw (Exception::INITIALIZATION_ERROR);
+  }
+
+  BuildHaloList();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Fills the interior and halo of patch p by walking the map's adjacency from
+//! the diamond's vertex and edge cells, then records the interior as owned.
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapPatches::BuildPatch(
+    const IcosTopology & topology,
+    U8 p
+    ) throw (Exception::Type)
+{
+  const IcosDiamond & corner = ICOS_DIAMOND[p];
+  const U16 n = Size;
+
+  U16 edgeTL[IcosTopology::MAX_SIZE];
+  U16 edgeTR[IcosTopology::MAX_SIZE];
+  U16 edgeLB[IcosTopology::MAX_SIZE];
+  U16 edgeRB[IcosTopology::MAX_SIZE];
+
+  topology.GetEdgeCellIDs(corner.T, corner.L, edgeTL);
+  topology.GetEdgeCellIDs(corner.T, corner.R, edgeTR);
+  topology.GetEdgeCellIDs(corner.L, corner.B, edgeLB);
+  topology.GetEdgeCellIDs(corner.R, corner.B, edgeRB);
+
+  // Lattice point (i,k), -1 <= i <= n, is stored at row i+1, column k.
+  S32 * point = SlotCellID + GetSlot(p, 1u, 0u);
+
+  // Boundary of the diamond, straight from the vertex and edge cells.
+  point[0] = topology.GetVertexCellID(corner.T);
+  point[n] = topology.GetVertexCellID(corner.R);
+  point[n * Stride] = topology.GetVertexCellID(corner.L);
+  point[n * Stride + n] = topology.GetVertexCellID(corner.B);
+
+  for (U16 j = 1; j < n; ++j)
+  {
+    point[j] = edgeTR[j - 1u];
+    point[j * Stride] = edgeTL[j - 1u];
+    point[n * Stride + j] = edgeLB[j - 1u];
+    point[j * Stride + n] = edgeRB[j - 1u];
+  }
+
+  // Rows between the T-R and L-B edges, walked from the T-L edge. The step
+  // from (i,0) to (i,1) is along the cell shared with row i-1.
+  for (U16 i = 1; i < n; ++i)
+  {
+    S32 * row = point + i * Stride;
+
+    row[1] = FindCommonAdjacent(topology, row[0], row[1 - (S32)Stride], row[-(S32)Stride]);
+
+    for (U16 k = 1; k < n; ++k)
+    {
+      U16 nextID = Continue(topology, row[k - 1u], row[k]);
+
+      if (k + 1u < n)
+      {
+        row[k + 1u] = nextID;
+      }
+      else if (row[n] != nextID)
+      {
+        throw (Exception::INITIALIZATION_ERROR);
+      }
+    }
+  }
+
+  // Halo beyond the T-R edge (row 0) and beyond the R-B edge (column n+1).
+  for (U16 j = 1; j < n; ++j)
+  {
+    point[j - Stride] = Continue(topology, point[j + Stride], point[j]);
+    point[j * Stride + n + 1u] = Continue(topology, point[j * Stride + n - 1u], point[j * Stride + n]);
+  }
+
+  // The two halo points around the pentagonal corner R. The halo corners
+  // (-1,0), (-1,n+1) and (n,n+1) neighbor no interior point and stay NO_CELL.
+  point[n - Stride] = FindCommonAdjacent(topology, point[n - 1u], point[n], point[Stride + n - 1u]);
+  point[n + 1u] = FindCommonAdjacent(topology, point[n], point[Stride + n], point[Stride + n - 1u]);
+
+  for (U16 row = 1; row <= n; ++row)
+  {
+    for (U16 column = 1; column <= n; ++column)
+    {
+      U32 slot = GetSlot(p, row, column);
+      S32 cellID = SlotCellID[slot];
+
+      if (OwnerSlot[cellID] != NO_SLOT) throw (Exception::INITIALIZATION_ERROR);
+
+      OwnerSlot[cellID] = slot;
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Records, for every halo slot of every patch, the slot owning its cell.
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapPatches::BuildHaloList(
+    ) throw (Exception::Type)
+{
+  for (U8 p = 0; p < PATCH_COUNT; ++p)
+  {
+    HaloCount[p] = 0u;
+
+    for (U16 row = 0; row < Stride; ++row)
+    {
+      for (U16 column = 0; column < Stride; ++column)
+      {
+        bool isHalo = (row == 0u) || (row == Stride - 1u) || (column == 0u) || (column == Stride - 1u);
+
+        if (! isHalo) continue;
+
+        U32 slot = GetSlot(p, row, column);
+        S32 cellID = SlotCellID[slot];
+
+        if (cellID == NO_CELL) continue;
+
+        HaloSlot[p][HaloCount[p]] = slot;
+        HaloSource[p][HaloCount[p]] = OwnerSlot[cellID];
+        ++HaloCount[p];
+      }
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapPatches.h)
+////////////////////////////////////////////////////////////////////////////////
+U16
+IcosMapPatches::GetSize(
+    ) const throw ()
+{
+  return Size;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapPatches.h)
+////////////////////////////////////////////////////////////////////////////////
+U16
+IcosMapPatches::GetStride(
+    ) const throw ()
+{
+  return Stride;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapPatches.h)
+////////////////////////////////////////////////////////////////////////////////
+U32
+IcosMapPatches::GetSlotCount(
+    ) const throw ()
+{
+  return (0u < Size) ? (PATCH_COUNT * (U32)Stride * Stride + 2u) : 0u;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapPatches.h)
+////////////////////////////////////////////////////////////////////////////////
+U32
+IcosMapPatches::GetSlot(
+    U8 p,
+    U16 row,
+    U16 column
+    ) const throw (Exception::Type)
+{
+  if (! ((p < PATCH_COUNT) && (row < Stride) && (column < Stride)))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  return ((U32)p * Stride + row) * Stride + column;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapPatches.h)
+////////////////////////////////////////////////////////////////////////////////
+U32
+IcosMapPatches::GetPoleSlot(
+    U8 pole
+    ) const throw (Exception::Type)
+{
+  if (! (pole < 2u))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  return PATCH_COUNT * (U32)Stride * Stride + pole;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapPatches.h)
+////////////////////////////////////////////////////////////////////////////////
+S32
+IcosMapPatches::GetCellID(
+    U32 slot
+    ) const throw (Exception::Type)
+{
+  if (! (slot < GetSlotCount()))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  return SlotCellID[slot];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapPatches.h)
+////////////////////////////////////////////////////////////////////////////////
+U32
+IcosMapPatches::GetOwnerSlot(
+    U16 cellID
+    ) const throw (Exception::Type)
+{
+  if (! (cellID < CellCount))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  return OwnerSlot[cellID];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapPatches.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapPatches::Scatter(
+    const F32 cellValue[],
+    F32 slotValue[]
+    ) const throw ()
+{
+  U32 slotCount = GetSlotCount();
+
+  for (U32 i = 0; i < slotCount; ++i)
+  {
+    S32 cellID = SlotCellID[i];
+
+    slotValue[i] = (cellID == NO_CELL) ? 0.0f : cellValue[cellID];
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapPatches.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapPatches::Gather(
+    const F32 slotValue[],
+    F32 cellValue[]
+    ) const throw ()
+{
+  for (U16 i = 0; i < CellCount; ++i)
+  {
+    cellValue[i] = slotValue[OwnerSlot[i]];
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapPatches.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapPatches::ExchangeHalos(
+    F32 slotValue[]
+    ) const throw ()
+{
+  if (Size == 0u) return;
+
+  for (U8 p = 0; p < PATCH_COUNT; ++p)
+  {
+    ExchangeHalos(p, slotValue);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapPatches.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapPatches::ExchangeHalos(
+    U8 p,
+    F32 slotValue[]
+    ) const throw (Exception::Type)
+{
+  if (! (p < PATCH_COUNT))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  const U32 * haloSlot = HaloSlot[p];
+  const U32 * haloSource = HaloSource[p];
+
+  for (U16 i = 0; i < HaloCount[p]; ++i)
+  {
+    slotValue[haloSlot[i]] = slotValue[haloSource[i]];
+  }
+}
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
@@ -0,0 +1,170 @@
+#pragma once
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ * Oct 19, 2026 |---| patches may be built from a shared topology
+ *
+ * ****************************************************************************/
+
+
+#include "Exception.h"
+#include "IcosDiamond.h"
+#include "IcosMap.h"
+#include "IcosTopology.h"
+#include "NativeTypes.h"
+
+////////////////////////////////////////////////////////////////////////////////
+//! Decomposes an IcosMap into the 10 icosahedral diamonds (patches), each
+//! stored as a dense (size+2) x (size+2) block of values: a size x size
+//! interior surrounded by a one cell halo ring. The two pole cells belong to no
+//! patch and are stored after the last patch.
+//!
+//! Patch p holds lattice point (i,k) of diamond p (see IcosDiamond.h) at row
+//! i+1, column k, so the interior is rows and columns 1 to size. Inside a patch
+//! the six neighbors of (row,column) are
+//!
+//!   (row-1,column) (row-1,column+1) (row,column-1)
+//!   (row,column+1) (row+1,column-1) (row+1,column)
+//!
+//! whichever diamond the neighbor actually belongs to. The halo corners (0,0),
+//! (0,size+1) and (size+1,size+1) have no cell; they hold NO_CELL and are
+//! never written by the halo exchange. Only the pentagonal interior corner
+//! (1,size) lists one of them among its six neighbors.
+//!
+//! Values live in caller owned storage of GetSlotCount() values. Each patch is
+//! one contiguous block, so threads working on different patches never share
+//! storage, and a patch interior is walked with plain 2D loops:
+//!
+//!   F32 * value = slotValue + patches.GetSlot(p, 0u, 0u);
+//!   for (U16 row = 1; row <= size; ++row)
+//!     for (U16 column = 1; column <= size; ++column)
+//!       value[row * stride + column] ...
+////////////////////////////////////////////////////////////////////////////////
+class IcosMapPatches
+{
+public:
+
+  IcosMapPatches();
+
+  ~IcosMapPatches();
+
+  static const U8 PATCH_COUNT = ICOS_DIAMOND_COUNT;
+  static const U16 MAX_STRIDE = IcosMap::MAX_SIZE + 2u;
+  static const S32 NO_CELL = -1;
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Builds the patch layout of an initialized map. The map may be discarded
+  //! afterwards.
+  //////////////////////////////////////////////////////////////////////////////
+  void Initialize(const IcosMap & map) throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Builds the patch layout of a topology.
+  //////////////////////////////////////////////////////////////////////////////
+  void Initialize(const IcosTopology & topology) throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the number of interior rows and columns of a patch.
+  //////////////////////////////////////////////////////////////////////////////
+  U16 GetSize() const throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the distance in values between two rows of a patch.
+  //////////////////////////////////////////////////////////////////////////////
+  U16 GetStride() const throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the number of values needed to store one field.
+  //////////////////////////////////////////////////////////////////////////////
+  U32 GetSlotCount() const throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the slot of (row,column) of patch p.
+  //////////////////////////////////////////////////////////////////////////////
+  U32 GetSlot(U8 p, U16 row, U16 column) const throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the slot of the north (0) or south (1) pole cell.
+  //////////////////////////////////////////////////////////////////////////////
+  U32 GetPoleSlot(U8 pole) const throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the map cell stored in a slot, or NO_CELL.
+  //////////////////////////////////////////////////////////////////////////////
+  S32 GetCellID(U32 slot) const throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the interior or pole slot that owns a map cell.
+  //////////////////////////////////////////////////////////////////////////////
+  U32 GetOwnerSlot(U16 cellID) const throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Copies cellValue[], indexed by map cell ID, into the interiors, poles and
+  //! halos of slotValue[]. Slots without a cell are set to zero.
+  //////////////////////////////////////////////////////////////////////////////
+  void Scatter(const F32 cellValue[], F32 slotValue[]) const throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Copies the interiors and poles of slotValue[] back into cellValue[].
+  //////////////////////////////////////////////////////////////////////////////
+  void Gather(const F32 slotValue[], F32 cellValue[]) const throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Refreshes every halo from the interiors and poles it mirrors.
+  //////////////////////////////////////////////////////////////////////////////
+  void ExchangeHalos(F32 slotValue[]) const throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Refreshes the halo of patch p only. This writes nothing but the halo of p,
+  //! so one thread per patch may run it once all interiors are up to date.
+  //////////////////////////////////////////////////////////////////////////////
+  void ExchangeHalos(U8 p, F32 slotValue[]) const throw (Exception::Type);
+
+private:
+
+  void BuildPatch(const IcosTopology & topology, U8 p) throw (Exception::Type);
+  void BuildHaloList() throw (Exception::Type);
+
+  static const U32 MAX_PATCH_SLOT_COUNT = (U32)MAX_STRIDE * MAX_STRIDE;
+  static const U32 MAX_HALO_SLOT_COUNT = 4u * MAX_STRIDE;
+
+  //! Number of interior rows and columns of a patch.
+  U16 Size;
+  //! Distance between two rows of a patch.
+  U16 Stride;
+  //! Number of map cells.
+  U16 CellCount;
+  //! Map cell stored in each slot, or NO_CELL.
+  S32 SlotCellID[PATCH_COUNT * MAX_PATCH_SLOT_COUNT + 2u];
+  //! Interior or pole slot that owns each map cell.
+  U32 OwnerSlot[IcosMap::MAX_CELL_COUNT];
+  //! Number of halo slots of each patch that mirror a cell.
+  U16 HaloCount[PATCH_COUNT];
+  //! Halo slot and the slot it mirrors, for each patch.
+  U32 HaloSlot[PATCH_COUNT][MAX_HALO_SLOT_COUNT];
+  U32 HaloSource[PATCH_COUNT][MAX_HALO_SLOT_COUNT];
+};
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
@@ -0,0 +1,519 @@
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ *
+ * ****************************************************************************/
+
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+#include "IcosMapSnapshot.h"
+
+static const char MAGIC[8] = "ICOSSNP";
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the 32-bit FNV-1a hash of bytes[].
+////////////////////////////////////////////////////////////////////////////////
+static
+U32
+Checksum(
+    const U8 bytes[],
+    U64 count
+    ) throw ()
+{
+  U32 hash = 2166136261u;
+
+  for (U64 i = 0; i < count; ++i)
+  {
+    hash = (hash ^ bytes[i]) * 16777619u;
+  }
+
+  return hash;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the bytes of a record's block list, padded to four bytes.
+////////////////////////////////////////////////////////////////////////////////
+static inline U32 GetBlockListBytes(U32 blockCount) throw ()
+{
+  return (blockCount * sizeof(U16) + 3u) & ~3u;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the number of cells in a block.
+////////////////////////////////////////////////////////////////////////////////
+static inline U32 GetBlockCellCount(U32 cellCount, U32 block) throw ()
+{
+  U32 first = block * IcosMap::DIRTY_BLOCK_CELL_COUNT;
+  U32 count = cellCount - first;
+  return (IcosMap::DIRTY_BLOCK_CELL_COUNT < count) ? IcosMap::DIRTY_BLOCK_CELL_COUNT : count;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Writes all of bytes[] at offset, retrying short and interrupted writes.
+////////////////////////////////////////////////////////////////////////////////
+static
+bool
+WriteAll(
+    int descriptor,
+    const U8 bytes[],
+    U64 count,
+    U64 offset
+    ) throw ()
+{
+  while (0u < count)
+  {
+    ssize_t written = pwrite(descriptor, bytes, count, (off_t)offset);
+
+    if (written < 0)
+    {
+      if (EINTR == errno) continue;
+      return false;
+    }
+
+    bytes += written;
+    count -= written;
+    offset += written;
+  }
+
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Reads count bytes at offset, returning false at the end of the file.
+////////////////////////////////////////////////////////////////////////////////
+static
+bool
+ReadAll(
+    int descriptor,
+    U8 bytes[],
+    U64 count,
+    U64 offset
+    ) throw (Exception::Type)
+{
+  while (0u < count)
+  {
+    ssize_t read = pread(descriptor, bytes, count, (off_t)offset);
+
+    if (read < 0)
+    {
+      if (EINTR == errno) continue;
+      throw (Exception::IO_ERROR);
+    }
+
+    if (0 == read)
+    {
+      return false;
+    }
+
+    bytes += read;
+    count -= read;
+    offset += read;
+  }
+
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapSnapshot.h)
+////////////////////////////////////////////////////////////////////////////////
+IcosMapSnapshot::Writer::Writer(
+    ) throw ()
+    : Descriptor(-1)
+    , CellCount(0u)
+    , RecordCount(0u)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapSnapshot.h)
+////////////////////////////////////////////////////////////////////////////////
+IcosMapSnapshot::Writer::~Writer(
+    ) throw ()
+{
+  Close();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapSnapshot.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapSnapshot::Writer::Create(
+    const char * path,
+    const IcosMap & map
+    ) throw (Exception::Type)
+{
+  if (! ((nullptr != path) && (0u < map.GetCellCount())))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  Close();
+
+  Header header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.Magic, MAGIC, sizeof(header.Magic));
+  header.Version = VERSION;
+  header.ByteOrderMark = BYTE_ORDER_MARK;
+  header.Size = map.GetTopology().GetSize();
+  header.BlockCellCount = IcosMap::DIRTY_BLOCK_CELL_COUNT;
+  header.CellCount = map.GetCellCount();
+
+  int descriptor = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (descriptor < 0)
+  {
+    throw (Exception::IO_ERROR);
+  }
+
+  if (! (WriteAll(descriptor, (const U8 *)&header, sizeof(header), 0u) && (0 == fsync(descriptor))))
+  {
+    close(descriptor);
+    throw (Exception::IO_ERROR);
+  }
+
+  Descriptor = descriptor;
+  CellCount = header.CellCount;
+  RecordCount = 0u;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapSnapshot.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapSnapshot::Writer::Open(
+    const char * path,
+    const IcosMap & map
+    ) throw (Exception::Type)
+{
+  if (nullptr == path)
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  Close();
+
+  int descriptor = open(path, O_RDWR);
+  if (descriptor < 0)
+  {
+    throw (Exception::IO_ERROR);
+  }
+
+  Header header;
+  U32 recordCount;
+  U64 validBytes;
+
+  try
+  {
+    Scan(descriptor, nullptr, header, recordCount, validBytes);
+
+    if (header.CellCount != map.GetCellCount())
+    {
+      throw (Exception::PARAMETER_ERROR);
+    }
+
+    if (0 != ftruncate(descriptor, (off_t)validBytes))
+    {
+      throw (Exception::IO_ERROR);
+    }
+  }
+  catch (Exception::Type error)
+  {
+    close(descriptor);
+    throw (error);
+  }
+
+  Descriptor = descriptor;
+  CellCount = header.CellCount;
+  RecordCount = recordCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapSnapshot.h)
+////////////////////////////////////////////////////////////////////////////////
+U64
+IcosMapSnapshot::Writer::Checkpoint(
+    IcosMap & map
+    ) throw (Exception::Type)
+{
+  if (! ((0 <= Descriptor) && (map.GetCellCount() == CellCount)))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  // The base holds every block, whatever the map's dirty blocks.
+  bool isBase = (0u == RecordCount);
+  U16 blockCount = map.GetBlockCount();
+  U16 block[IcosMap::MAX_DIRTY_BLOCK_COUNT];
+  U32 listCount = 0u;
+  U32 valueCount = 0u;
+
+  for (U16 i = 0; i < blockCount; ++i)
+  {
+    if (isBase || map.IsBlockDirty(i))
+    {
+      block[listCount++] = i;
+      valueCount += GetBlockCellCount(CellCount, i);
+    }
+  }
+
+  if (0u == listCount)
+  {
+    return 0u;
+  }
+
+  U32 listBytes = GetBlockListBytes(listCount);
+  U32 dataBytes = listBytes + valueCount * sizeof(F32);
+  std::vector<U8> buffer(sizeof(Record) + dataBytes, 0u);
+
+  U8 * data = &buffer[sizeof(Record)];
+  memcpy(data, block, listCount * sizeof(U16));
+
+  F32 * value = (F32 *)(data + listBytes);
+  const F32 * elevation = map.GetElevations();
+
+  for (U32 i = 0; i < listCount; ++i)
+  {
+    U32 count = GetBlockCellCount(CellCount, block[i]);
+    memcpy(value, &elevation[block[i] * IcosMap::DIRTY_BLOCK_CELL_COUNT], count * sizeof(F32));
+    value += count;
+  }
+
+  Record record;
+  record.Sequence = RecordCount;
+  record.BlockCount = (U16)listCount;
+  record.Flags = isBase ? FLAG_BASE : 0u;
+  record.DataBytes = dataBytes;
+  record.Checksum = Checksum(data, dataBytes);
+  memcpy(&buffer[0], &record, sizeof(record));
+
+  off_t end = lseek(Descriptor, 0, SEEK_END);
+
+  if (! ((0 <= end) && WriteAll(Descriptor, &buffer[0], buffer.size(), (U64)end) && (0 == fsync(Descriptor))))
+  {
+    // Leave the journal ending with the last complete record.
+    if (0 <= end) (void)ftruncate(Descriptor, end);
+    throw (Exception::IO_ERROR);
+  }
+
+  ++RecordCount;
+  map.ClearDirtyBlocks();
+
+  return buffer.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapSnapshot.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapSnapshot::Writer::Close(
+    ) throw ()
+{
+  if (0 <= Descriptor)
+  {
+    close(Descriptor);
+  }
+
+  Descriptor = -1;
+  CellCount = 0u;
+  RecordCount = 0u;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapSnapshot.h)
+////////////////////////////////////////////////////////////////////////////////
+U32
+IcosMapSnapshot::Writer::GetRecordCount(
+    ) const throw ()
+{
+  return RecordCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapSnapshot.h)
+////////////////////////////////////////////////////////////////////////////////
+U32
+IcosMapSnapshot::Replay(
+    const char * path,
+    IcosMap & map
+    ) throw (Exception::Type)
+{
+  if (nullptr == path)
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  int descriptor = open(path, O_RDONLY);
+  if (descriptor < 0)
+  {
+    throw (Exception::IO_ERROR);
+  }
+
+  Header header;
+  U32 recordCount;
+  U64 validBytes;
+
+  try
+  {
+    Scan(descriptor, &map, header, recordCount, validBytes);
+  }
+  catch (Exception::Type error)
+  {
+    close(descriptor);
+    throw (error);
+  }
+
+  close(descriptor);
+
+  // Without a base there is nothing to restore the map from.
+  if (0u == recordCount)
+  {
+    throw (Exception::FORMAT_ERROR);
+  }
+
+  return recordCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Reads and checks the header and records of a journal, applying them to map
+//! unless it is null. Returns the number of complete records and the bytes up
+//! to the end of the last of them.
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapSnapshot::Scan(
+    int descriptor,
+    IcosMap * map,
+    Header & header,
+    U32 & recordCount,
+    U64 & validBytes
+    ) throw (Exception::Type)
+{
+  if (! ReadAll(descriptor, (U8 *)&header, sizeof(header), 0u))
+  {
+    throw (Exception::FORMAT_ERROR);
+  }
+
+  if (! ((0 == memcmp(header.Magic, MAGIC, sizeof(header.Magic)))
+      && (VERSION == header.Version)
+      && (BYTE_ORDER_MARK == header.ByteOrderMark)
+      && (IcosMap::DIRTY_BLOCK_CELL_COUNT == header.BlockCellCount)
+      && (IcosMap::MIN_SIZE <= header.Size) && (header.Size <= IcosMap::MAX_SIZE)
+      && (10u * header.Size * header.Size + 2u == header.CellCount)))
+  {
+    throw (Exception::FORMAT_ERROR);
+  }
+
+  U32 blockCount = (header.CellCount + IcosMap::DIRTY_BLOCK_CELL_COUNT - 1u) / IcosMap::DIRTY_BLOCK_CELL_COUNT;
+  std::vector<U8> data;
+
+  recordCount = 0u;
+  validBytes = sizeof(header);
+
+  for (;;)
+  {
+    Record record;
+    if (! ReadAll(descriptor, (U8 *)&record, sizeof(record), validBytes))
+    {
+      break;
+    }
+
+    // A record that does not check out is the torn end of the journal.
+    if (! ((recordCount == record.Sequence)
+        && (0u < record.BlockCount) && (record.BlockCount <= blockCount)
+        && (GetBlockListBytes(record.BlockCount) <= record.DataBytes)))
+    {
+      break;
+    }
+
+    data.resize(record.DataBytes);
+    if (! ReadAll(descriptor, &data[0], record.DataBytes, validBytes + sizeof(record)))
+    {
+      break;
+    }
+
+    if (record.Checksum != Checksum(&data[0], record.DataBytes))
+    {
+      break;
+    }
+
+    if ((0u == recordCount) != (0u != (record.Flags & FLAG_BASE)))
+    {
+      throw (Exception::FORMAT_ERROR);
+    }
+
+    U16 block[IcosMap::MAX_DIRTY_BLOCK_COUNT];
+    memcpy(block, &data[0], record.BlockCount * sizeof(U16));
+
+    U32 valueCount = 0u;
+    for (U32 i = 0; i < record.BlockCount; ++i)
+    {
+      if ((blockCount <= block[i]) || ((0u < i) && (block[i] <= block[i - 1u])))
+      {
+        throw (Exception::FORMAT_ERROR);
+      }
+
+      valueCount += GetBlockCellCount(header.CellCount, block[i]);
+    }
+
+    U32 listBytes = GetBlockListBytes(record.BlockCount);
+    if (listBytes + valueCount * sizeof(F32) != record.DataBytes)
+    {
+      throw (Exception::FORMAT_ERROR);
+    }
+
+    if (nullptr != map)
+    {
+      // The map is resized only once a base is known to be there.
+      if ((0u == recordCount) && (map->GetCellCount() != header.CellCount))
+      {
+        map->Initialize((U8)header.Size);
+      }
+
+      const U8 * value = &data[listBytes];
+      F32 * elevation = map->GetElevations();
+
+      for (U32 i = 0; i < record.BlockCount; ++i)
+      {
+        U32 count = GetBlockCellCount(header.CellCount, block[i]);
+        memcpy(&elevation[block[i] * IcosMap::DIRTY_BLOCK_CELL_COUNT], value, count * sizeof(F32));
+        value += count * sizeof(F32);
+      }
+    }
+
+    ++recordCount;
+    validBytes += sizeof(record) + record.DataBytes;
+  }
+
+  if ((nullptr != map) && (0u < recordCount))
+  {
+    map->ClearDirtyBlocks();
+  }
+}
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
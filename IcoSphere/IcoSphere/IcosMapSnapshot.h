@@ -0,0 +1,178 @@
+#pragma once
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ *
+ * ****************************************************************************/
+
+
+#include "Exception.h"
+#include "IcosMap.h"
+#include "NativeTypes.h"
+
+////////////////////////////////////////////////////////////////////////////////
+//! Incremental snapshots of the fields of a map. A journal file holds a base
+//! snapshot of every block followed by deltas holding only the blocks dirtied
+//! since the previous checkpoint, so the cost of a checkpoint follows the
+//! number of cells changed rather than the size of the map:
+//!
+//!   Header       fixed size
+//!   Record       one per checkpoint, the first a base:
+//!     Record       fixed size
+//!     Block        U16[BlockCount], padded to four bytes
+//!     Values       the elevations of each listed block
+//!
+//! Each record carries a checksum, so a record torn by a crash is detected and
+//! Replay() stops at the last complete one. Values are stored in the byte
+//! order of the writing machine, which the header records.
+////////////////////////////////////////////////////////////////////////////////
+class IcosMapSnapshot
+{
+public:
+
+  static const U32 VERSION = 1u;
+  static const U32 BYTE_ORDER_MARK = 0x01020304u;
+
+  static const U16 FLAG_BASE = 1u;
+
+  struct Header
+  {
+    char Magic[8];
+    U32 Version;
+    U32 ByteOrderMark;
+    U16 Size;
+    U16 BlockCellCount;
+    U32 CellCount;
+  };
+
+  struct Record
+  {
+    U32 Sequence;
+    U16 BlockCount;
+    U16 Flags;
+    U32 DataBytes;        //!< Bytes of the block list and values that follow.
+    U32 Checksum;         //!< FNV-1a of those bytes.
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Appends checkpoints of one map to a journal. A writer may be used by one
+  //! thread at a time.
+  //////////////////////////////////////////////////////////////////////////////
+  class Writer
+  {
+  public:
+
+    Writer(
+        ) throw ();
+
+    ~Writer(
+        ) throw ();
+
+    //////////////////////////////////////////////////////////////////////////
+    //! Starts a new journal for map at path, replacing any file there. The
+    //! first checkpoint is a base holding every block.
+    //////////////////////////////////////////////////////////////////////////
+    void
+    Create(
+        const char * path,
+        const IcosMap & map
+        ) throw (Exception::Type);
+
+    //////////////////////////////////////////////////////////////////////////
+    //! Reopens the journal at path to append further checkpoints, dropping any
+    //! torn record at its end. The map must hold what Replay() of the journal
+    //! left in it, plus any changes since marked dirty.
+    //////////////////////////////////////////////////////////////////////////
+    void
+    Open(
+        const char * path,
+        const IcosMap & map
+        ) throw (Exception::Type);
+
+    //////////////////////////////////////////////////////////////////////////
+    //! Appends a record of every block of map dirtied since the last
+    //! checkpoint, flushes it to disk, clears the map's dirty blocks and
+    //! returns the bytes written. Nothing is written if no block is dirty.
+    //////////////////////////////////////////////////////////////////////////
+    U64
+    Checkpoint(
+        IcosMap & map
+        ) throw (Exception::Type);
+
+    void
+    Close(
+        ) throw ();
+
+    //////////////////////////////////////////////////////////////////////////
+    //! Returns the number of records in the journal.
+    //////////////////////////////////////////////////////////////////////////
+    U32
+    GetRecordCount(
+        ) const throw ();
+
+  private:
+
+    Writer(
+        const Writer &
+        ) throw ();
+
+    Writer &
+    operator=(
+        const Writer &
+        ) throw ();
+
+    //! Descriptor of the open journal, or -1.
+    int Descriptor;
+    U32 CellCount;
+    U32 RecordCount;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Initializes map with the size of the journal at path and applies its
+  //! base and deltas in order, returning the number of records applied. The
+  //! map's blocks are left clean. Throws FORMAT_ERROR, leaving the map as it
+  //! was, if the journal holds no complete base.
+  //////////////////////////////////////////////////////////////////////////////
+  static
+  U32
+  Replay(
+      const char * path,
+      IcosMap & map
+      ) throw (Exception::Type);
+
+private:
+
+  static
+  void
+  Scan(
+      int descriptor,
+      IcosMap * map,
+      Header & header,
+      U32 & recordCount,
+      U64 & validBytes
+      ) throw (Exception::Type);
+};
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
@@ -18,17 +18,65 @@
  * Chagne Date        Description
  * -----------------------------------------------------------------------------
  * Aug 19, 2019 |---| added license notice
+ * Oct 19, 2026 |---| draw all cells as one indexed triangle list
+ * Oct 19, 2026 |---| share polygon corners through IcosMapMesh
+ * Oct 19, 2026 |---| build the surface with worker threads
+ * Oct 19, 2026 |---| added incremental updates of changed cells
+ * Oct 19, 2026 |---| added patch culling against the view
+ * Oct 19, 2026 |---| order triangles and vertices for the vertex cache
  *
  * ****************************************************************************/
 
+#include <atomic>
+#include <math.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+#include "IcosMapPatches.h"
 #include "IcosMapView.h"
 #include "RenderContext.h"
+#include "VertexCacheOptimizer.h"
+
+////////////////////////////////////////////////////////////////////////////////
+//! State shared by the worker threads of one pass of SetMap(). Triangulating
+//! takes two passes before the vertices can be written to their slots: one
+//! writing the fans of chunks of cells, taken in patch order, and one
+//! reordering the triangles of each patch.
+////////////////////////////////////////////////////////////////////////////////
+struct IcosMapView::Job
+{
+  static const U8 PASS_TRIANGLES = 0u;
+  static const U8 PASS_ORDER = 1u;
+  static const U8 PASS_VERTICES = 2u;
+
+  U8 Pass;
+  const IcosMapMesh * Mesh;
+  const F32 * Elevation;
+  VertexElevation * Vertices;
+  U32 * Indices;
+  //! Place in Vertices of each vertex of Mesh.
+  const U32 * VertexSlot;
+  //! Cells in patch order, and the first index of each chunk of them.
+  const U16 * CellOrder;
+  const U32 * ChunkFirstIndex;
+  const Patch * Patches;
+  U32 ChunkCount;
+  //! Index of the next chunk to be claimed by a worker.
+  std::atomic<U32> NextChunk;
+};
 
 IcosMapView::IcosMapView(
     ) throw ()
     : Map(nullptr)
-    , CellViewCount(0u)
+    , Mesh()
+    , Surface(VertexArray::TYPE_TRIANGLES)
+    , PatchCount(0u)
+    , VisiblePatchCount(0u)
+    , IsCulled(false)
 {
+  ClearDirtyRanges();
+  memset(StalePatch, 0, sizeof(StalePatch));
 }
 
 IcosMapView::~IcosMapView(
@@ -38,17 +86,786 @@ IcosMapView::~IcosMapView(
 
 void
 IcosMapView::SetMap(
-    const IcosMap & map
+    const IcosMap & map,
+    U32 threadCount
     ) throw ()
 {
+  Map = nullptr;
+
+  // Triangles depend on nothing but the topology.
+  bool isTriangulating = (Mesh.GetTopology() != &map.GetTopology());
+
+  std::vector<U16> cellOrder;
+  std::vector<U32> chunkFirstIndex;
+
+  if (isTriangulating)
+  {
+    cellOrder.resize(map.GetCellCount());
+
+    try
+    {
+      Mesh.Initialize(map.GetTopology());
+      BuildPatches(map.GetTopology(), &cellOrder[0]);
+    }
+    catch (Exception::Type)
+    {
+      PatchCount = 0u;
+      return;
+    }
+
+    // Each chunk of cells writes its fans from where the previous one ends.
+    U32 index = 0u;
+    for (U32 c = 0; c < cellOrder.size(); ++c)
+    {
+      if (0u == c % CHUNK_CELL_COUNT)
+      {
+        chunkFirstIndex.push_back(index);
+      }
+
+      U16 cellID = cellOrder[c];
+      index += 3u * (Mesh.GetTriangleOffset(cellID + 1u) - Mesh.GetTriangleOffset(cellID));
+    }
+  }
+
+  U32 vertexCount = Mesh.GetVertexCount();
+  U32 indexCount = 3u * Mesh.GetTriangleCount();
+
+  if (isTriangulating)
+  {
+    Surface.Allocate(vertexCount, indexCount);
+  }
+
+  Surface.Reset();
+
+  if (0u == threadCount)
+  {
+    threadCount = std::thread::hardware_concurrency();
+    if (0u == threadCount) threadCount = 1u;
+  }
+
+  Job job;
+  job.Mesh = &Mesh;
+  job.Elevation = map.GetElevations();
+  job.Vertices = Surface.AddVertices(vertexCount);
+  job.Indices = Surface.AddIndices(indexCount);
+  job.VertexSlot = VertexSlot;
+  job.CellOrder = isTriangulating ? &cellOrder[0] : nullptr;
+  job.ChunkFirstIndex = isTriangulating ? &chunkFirstIndex[0] : nullptr;
+  job.Patches = Patches;
+
+  if (isTriangulating)
+  {
+    job.Pass = Job::PASS_TRIANGLES;
+    job.ChunkCount = chunkFirstIndex.size();
+    Run(job, threadCount);
+
+    job.Pass = Job::PASS_ORDER;
+    job.ChunkCount = PatchCount;
+    Run(job, threadCount);
+
+    VertexCacheOptimizer::OptimizeVertices(job.Indices, indexCount, vertexCount, VertexSlot);
+  }
+
+  job.Pass = Job::PASS_VERTICES;
+  job.ChunkCount = (vertexCount + CHUNK_VERTEX_COUNT - 1u) / CHUNK_VERTEX_COUNT;
+  Run(job, threadCount);
+
   Map = & map;
 
-  CellViewCount = Map->GetCellCount();
+  // Every vertex changed.
+  memset(DirtyVertex, 0xFF, sizeof(U64) * ((vertexCount + 63u) / 64u));
+  if (0u != vertexCount % 64u) DirtyVertex[vertexCount / 64u] = (1ull << (vertexCount % 64u)) - 1u;
+
+  for (U16 p = 0; p < PatchCount; ++p)
+  {
+    BoundPatch(p);
+  }
+
+  memset(StalePatch, 0, sizeof(StalePatch));
+
+  IsCulled = false;
+  VisiblePatchCount = 0u;
+
+  for (U16 p = 0; p < PatchCount; ++p)
+  {
+    if (0u < Patches[p].IndexCount) VisiblePatch[VisiblePatchCount++] = p;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Assigns each cell to the patch of its diamond block and orders the cells
+//! by patch, which is the order their fans are laid out in. The poles join
+//! the first block of diamond 0 and the last block of diamond 5.
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapView::BuildPatches(
+    const IcosTopology & topology,
+    U16 cellOrder[]
+    ) throw (Exception::Type)
+{
+  const U16 blockCount = PATCH_BLOCK_COUNT * PATCH_BLOCK_COUNT;
+
+  IcosMapPatches * patches = new IcosMapPatches();
+
+  try
+  {
+    patches->Initialize(topology);
+  }
+  catch (Exception::Type error)
+  {
+    delete patches;
+    throw (error);
+  }
+
+  const U16 n = patches->GetSize();
+  const U32 stride = patches->GetStride();
+  const U16 cellCount = topology.GetCellCount();
+
+  for (U16 c = 0; c < cellCount; ++c)
+  {
+    U32 slot = patches->GetOwnerSlot(c);
+
+    if (slot == patches->GetPoleSlot(0u))
+    {
+      CellPatch[c] = 0u;
+    }
+    else if (slot == patches->GetPoleSlot(1u))
+    {
+      CellPatch[c] = 5u * blockCount + blockCount - 1u;
+    }
+    else
+    {
+      // Interior slot (i + 1, k) of its diamond, 0 <= i < n and 1 <= k <= n.
+      U32 p = slot / (stride * stride);
+      U32 i = (slot % (stride * stride)) / stride - 1u;
+      U32 k = slot % stride;
+
+      CellPatch[c] = (U8)(p * blockCount + (i * PATCH_BLOCK_COUNT / n) * PATCH_BLOCK_COUNT + (k - 1u) * PATCH_BLOCK_COUNT / n);
+    }
+  }
+
+  delete patches;
+
+  PatchCount = MAX_PATCH_COUNT;
+
+  U32 patchCellCount[MAX_PATCH_COUNT + 1u];
+  memset(patchCellCount, 0, sizeof(patchCellCount));
+
+  for (U16 p = 0; p < PatchCount; ++p)
+  {
+    Patches[p].IndexCount = 0u;
+  }
+
+  for (U16 c = 0; c < cellCount; ++c)
+  {
+    patchCellCount[CellPatch[c] + 1u]++;
+    Patches[CellPatch[c]].IndexCount += 3u * (Mesh.GetTriangleOffset(c + 1u) - Mesh.GetTriangleOffset(c));
+  }
+
+  U32 firstIndex = 0u;
+  for (U16 p = 0; p < PatchCount; ++p)
+  {
+    patchCellCount[p + 1u] += patchCellCount[p];
+    Patches[p].FirstIndex = firstIndex;
+    firstIndex += Patches[p].IndexCount;
+  }
+
+  // patchCellCount[p] is now the position of patch p's next cell.
+  for (U16 c = 0; c < cellCount; ++c)
+  {
+    cellOrder[patchCellCount[CellPatch[c]]++] = c;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Computes the bounding sphere, normal cone and lowest point of a patch from
+//! the current vertices.
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapView::BoundPatch(
+    U16 patch
+    ) throw ()
+{
+  Patch & out = Patches[patch];
+
+  if (0u == out.IndexCount)
+  {
+    return;
+  }
+
+  const VertexElevation * vertex = Surface.GetVertices();
+  const U32 * index = Surface.GetIndices() + out.FirstIndex;
+
+  F64 low[3] = { HUGE_VAL, HUGE_VAL, HUGE_VAL };
+  F64 high[3] = { -HUGE_VAL, -HUGE_VAL, -HUGE_VAL };
+  F64 axis[3] = { 0.0, 0.0, 0.0 };
+  F64 minRadius = HUGE_VAL;
+
+  for (U32 i = 0; i < out.IndexCount; i += 3u)
+  {
+    const Vector a = vertex[index[i]].GetPosition();
+    const Vector b = vertex[index[i + 1u]].GetPosition();
+    const Vector c = vertex[index[i + 2u]].GetPosition();
+
+    const Vector * corner[3] = { &a, &b, &c };
+    for (U8 j = 0; j < 3u; ++j)
+    {
+      F64 p[3] = { corner[j]->X, corner[j]->Y, corner[j]->Z };
+
+      for (U8 d = 0; d < 3u; ++d)
+      {
+        if (p[d] < low[d]) low[d] = p[d];
+        if (high[d] < p[d]) high[d] = p[d];
+      }
+
+      F64 radius = sqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+      if (radius < minRadius) minRadius = radius;
+    }
+
+    // Area weighted normal.
+    F64 u[3] = { b.X - a.X, b.Y - a.Y, b.Z - a.Z };
+    F64 v[3] = { c.X - a.X, c.Y - a.Y, c.Z - a.Z };
+    axis[0] += u[1] * v[2] - u[2] * v[1];
+    axis[1] += u[2] * v[0] - u[0] * v[2];
+    axis[2] += u[0] * v[1] - u[1] * v[0];
+  }
+
+  F64 center[3] = { 0.5 * (low[0] + high[0]), 0.5 * (low[1] + high[1]), 0.5 * (low[2] + high[2]) };
+  F64 length = sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+  F64 radius = 0.0;
+  F64 coneCos = 1.0;
 
-  for (U16 i = 0; i < CellViewCount; ++i)
+  if (0.0 < length)
   {
-    CellView[i].SetMapCell(*Map, Map->GetCell(i));
+    axis[0] /= length;
+    axis[1] /= length;
+    axis[2] /= length;
   }
+  else
+  {
+    coneCos = -1.0;
+  }
+
+  for (U32 i = 0; i < out.IndexCount; i += 3u)
+  {
+    const Vector a = vertex[index[i]].GetPosition();
+    const Vector b = vertex[index[i + 1u]].GetPosition();
+    const Vector c = vertex[index[i + 2u]].GetPosition();
+
+    const Vector * corner[3] = { &a, &b, &c };
+    for (U8 j = 0; j < 3u; ++j)
+    {
+      F64 dx = corner[j]->X - center[0], dy = corner[j]->Y - center[1], dz = corner[j]->Z - center[2];
+      F64 distance = sqrt(dx * dx + dy * dy + dz * dz);
+      if (radius < distance) radius = distance;
+    }
+
+    F64 u[3] = { b.X - a.X, b.Y - a.Y, b.Z - a.Z };
+    F64 v[3] = { c.X - a.X, c.Y - a.Y, c.Z - a.Z };
+    F64 normal[3] = { u[1] * v[2] - u[2] * v[1], u[2] * v[0] - u[0] * v[2], u[0] * v[1] - u[1] * v[0] };
+    F64 normalLength = sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+
+    if (0.0 < normalLength)
+    {
+      F64 cosine = (normal[0] * axis[0] + normal[1] * axis[1] + normal[2] * axis[2]) / normalLength;
+      if (cosine < coneCos) coneCos = cosine;
+    }
+  }
+
+  // Rounded outwards to stay conservative in single precision.
+  out.Center[0] = (F32)center[0];
+  out.Center[1] = (F32)center[1];
+  out.Center[2] = (F32)center[2];
+  out.Radius = (F32)radius * 1.0001f + 1.0e-6f;
+  out.ConeAxis[0] = (F32)axis[0];
+  out.ConeAxis[1] = (F32)axis[1];
+  out.ConeAxis[2] = (F32)axis[2];
+  out.ConeCos = (F32)coneCos - 1.0e-5f;
+  out.ConeSin = (F32)sqrt(1.0 - ((coneCos < 1.0) ? coneCos * coneCos : 1.0)) + 1.0e-5f;
+  out.MinRadius = (F32)minRadius * 0.9999f;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Runs one pass of a job with up to threadCount threads.
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapView::Run(
+    Job & job,
+    U32 threadCount
+    ) throw ()
+{
+  job.NextChunk = 0u;
+
+  if (job.ChunkCount < threadCount) threadCount = job.ChunkCount;
+
+  // The calling thread is the last worker.
+  std::vector<std::thread> worker;
+  for (U32 i = 1; i < threadCount; ++i)
+  {
+    worker.push_back(std::thread(Work, &job));
+  }
+
+  Work(&job);
+
+  for (U32 i = 0; i < worker.size(); ++i)
+  {
+    worker[i].join();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Claims chunks of the job's pass until none are left, computing the
+//! vertices or triangles of each straight into the surface arrays, or
+//! reordering the triangles of a patch in place.
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapView::Work(
+    Job * job
+    ) throw ()
+{
+  const IcosMapMesh & mesh = *job->Mesh;
+  IcosMapMesh::SurfaceVertex vertex[CHUNK_VERTEX_COUNT];
+  VertexCacheOptimizer optimizer;
+
+  for (U32 c = job->NextChunk++; c < job->ChunkCount; c = job->NextChunk++)
+  {
+    if (Job::PASS_VERTICES == job->Pass)
+    {
+      U32 first = c * CHUNK_VERTEX_COUNT;
+      U32 count = mesh.GetVertexCount() - first;
+      if (CHUNK_VERTEX_COUNT < count) count = CHUNK_VERTEX_COUNT;
+
+      mesh.GetVertices(job->Elevation, first, count, vertex);
+
+      const U32 * slot = &job->VertexSlot[first];
+
+      for (U32 i = 0; i < count; ++i)
+      {
+        F32 shade = vertex[i].Shade;
+        Vector position(vertex[i].Position[0], vertex[i].Position[1], vertex[i].Position[2]);
+        job->Vertices[slot[i]].Set(position, position, ColorRGBA(shade, shade, shade));
+      }
+    }
+    else if (Job::PASS_ORDER == job->Pass)
+    {
+      const Patch & patch = job->Patches[c];
+
+      optimizer.OptimizeTriangles(&job->Indices[patch.FirstIndex], patch.IndexCount, mesh.GetVertexCount(), VERTEX_CACHE_SIZE);
+    }
+    else
+    {
+      U32 first = c * CHUNK_CELL_COUNT;
+      U32 count = mesh.GetCellCount() - first;
+      if (CHUNK_CELL_COUNT < count) count = CHUNK_CELL_COUNT;
+
+      U32 * index = &job->Indices[job->ChunkFirstIndex[c]];
+
+      for (U32 i = first; i < first + count; ++i)
+      {
+        U16 cellID = job->CellOrder[i];
+        mesh.GetTriangles(cellID, 1u, index);
+        index += 3u * (mesh.GetTriangleOffset(cellID + 1u) - mesh.GetTriangleOffset(cellID));
+      }
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapView.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapView::UpdateCells(
+    const U16 cellID[],
+    U32 cellCount
+    ) throw ()
+{
+  if (nullptr == Map)
+  {
+    return;
+  }
+
+  for (U32 i = 0; i < cellCount; ++i)
+  {
+    if (cellID[i] < Mesh.GetCellCount())
+    {
+      UpdateCell(cellID[i]);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapView.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapView::UpdateDirtyBlocks(
+    ) throw ()
+{
+  if (nullptr == Map)
+  {
+    return;
+  }
+
+  U16 cellCount = Map->GetCellCount();
+  U16 blockCount = Map->GetBlockCount();
+
+  for (U16 block = 0; block < blockCount; ++block)
+  {
+    if (Map->IsBlockDirty(block))
+    {
+      U32 last = (block + 1u) * IcosMap::DIRTY_BLOCK_CELL_COUNT;
+      if (cellCount < last) last = cellCount;
+
+      for (U32 c = block * IcosMap::DIRTY_BLOCK_CELL_COUNT; c < last; ++c)
+      {
+        UpdateCell((U16)c);
+      }
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Recomputes the center and corners of a cell. Neighboring centers do not
+//! depend on the cell's elevation, but the bounds of the patches of the
+//! neighbors sharing its corners do.
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapView::UpdateCell(
+    U16 cellID
+    ) throw ()
+{
+  UpdateVertex(cellID);
+
+  const IcosCell & cell = Map->GetCell(cellID);
+  U8 cornerCount = cell.GetAdjacentCount();
+
+  U8 patch = CellPatch[cellID];
+  StalePatch[patch / 64u] |= (1ull << (patch % 64u));
+
+  for (U8 i = 0; i < cornerCount; ++i)
+  {
+    UpdateVertex(Mesh.GetCornerVertex(cellID, i));
+
+    patch = CellPatch[cell.AdjacentID[i]];
+    StalePatch[patch / 64u] |= (1ull << (patch % 64u));
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Recomputes one vertex of the surface and marks it dirty.
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapView::UpdateVertex(
+    U32 vertex
+    ) throw ()
+{
+  IcosMapMesh::SurfaceVertex surfaceVertex;
+  Mesh.GetVertices(Map->GetElevations(), vertex, 1u, &surfaceVertex);
+
+  U32 slot = VertexSlot[vertex];
+
+  F32 shade = surfaceVertex.Shade;
+  Vector position(surfaceVertex.Position[0], surfaceVertex.Position[1], surfaceVertex.Position[2]);
+  Surface.GetVertices()[slot].Set(position, position, ColorRGBA(shade, shade, shade));
+
+  DirtyVertex[slot / 64u] |= (1ull << (slot % 64u));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapView.h)
+////////////////////////////////////////////////////////////////////////////////
+U32
+IcosMapView::GetDirtyRanges(
+    U32 first[],
+    U32 count[],
+    U32 maxRangeCount
+    ) const throw ()
+{
+  U32 vertexCount = (nullptr != Map) ? Mesh.GetVertexCount() : 0u;
+  U32 rangeCount = 0u;
+
+  if (0u == maxRangeCount)
+  {
+    return 0u;
+  }
+
+  for (U32 word = 0; word < (vertexCount + 63u) / 64u; ++word)
+  {
+    U64 bits = DirtyVertex[word];
+
+    while (0u != bits)
+    {
+      U32 v = word * 64u + (U32)__builtin_ctzll(bits);
+      bits &= bits - 1u;
+
+      U32 end = (0u < rangeCount) ? first[rangeCount - 1u] + count[rangeCount - 1u] : 0u;
+
+      if ((0u < rangeCount) && ((v < end + DIRTY_RANGE_GAP) || (rangeCount == maxRangeCount)))
+      {
+        count[rangeCount - 1u] = v + 1u - first[rangeCount - 1u];
+      }
+      else
+      {
+        first[rangeCount] = v;
+        count[rangeCount] = 1u;
+        ++rangeCount;
+      }
+    }
+  }
+
+  return rangeCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapView.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapView::ClearDirtyRanges(
+    ) throw ()
+{
+  memset(DirtyVertex, 0, sizeof(DirtyVertex));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the determinant of the 3 x 3 matrix of rows a, b and c without
+//! column skip.
+////////////////////////////////////////////////////////////////////////////////
+static
+F64
+Minor(
+    const F64 a[4],
+    const F64 b[4],
+    const F64 c[4],
+    U8 skip
+    ) throw ()
+{
+  U8 j[3];
+  for (U8 i = 0, n = 0; i < 4u; ++i)
+  {
+    if (i != skip) j[n++] = i;
+  }
+
+  return a[j[0]] * (b[j[1]] * c[j[2]] - b[j[2]] * c[j[1]])
+       - a[j[1]] * (b[j[0]] * c[j[2]] - b[j[2]] * c[j[0]])
+       + a[j[2]] * (b[j[0]] * c[j[1]] - b[j[1]] * c[j[0]]);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapView.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMapView::SetView(
+    const F32 viewProjection[16]
+    ) throw ()
+{
+  if ((nullptr == Map) || (nullptr == viewProjection))
+  {
+    return;
+  }
+
+  for (U16 p = 0; p < PatchCount; ++p)
+  {
+    if (0u != (StalePatch[p / 64u] & (1ull << (p % 64u)))) BoundPatch(p);
+  }
+
+  memset(StalePatch, 0, sizeof(StalePatch));
+
+  // Nothing lies inside the sphere through the lowest vertex, which hides
+  // whatever is behind it.
+  F64 occluder = HUGE_VAL;
+  for (U16 p = 0; p < PatchCount; ++p)
+  {
+    if ((0u < Patches[p].IndexCount) && (Patches[p].MinRadius < occluder)) occluder = Patches[p].MinRadius;
+  }
+
+  F64 row[4][4];
+  for (U8 r = 0; r < 4u; ++r)
+  {
+    for (U8 c = 0; c < 4u; ++c)
+    {
+      row[r][c] = viewProjection[c * 4u + r];
+    }
+  }
+
+  // Frustum planes, normalized: -w <= x, y, z <= w in clip space.
+  F64 plane[6][4];
+  for (U8 i = 0; i < 6u; ++i)
+  {
+    F64 sign = (0u == (i & 1u)) ? 1.0 : -1.0;
+    F64 length = 0.0;
+
+    for (U8 c = 0; c < 4u; ++c)
+    {
+      plane[i][c] = row[3][c] + sign * row[i / 2u][c];
+      if (c < 3u) length += plane[i][c] * plane[i][c];
+    }
+
+    length = sqrt(length);
+    for (U8 c = 0; (c < 4u) && (0.0 < length); ++c)
+    {
+      plane[i][c] /= length;
+    }
+  }
+
+  // The eye is the one point, perhaps at infinity, with clip x, y and w of
+  // zero. At infinity it is the direction towards the viewer, on the side
+  // of the near plane.
+  F64 eye[4];
+  for (U8 c = 0; c < 4u; ++c)
+  {
+    eye[c] = ((0u == (c & 1u)) ? 1.0 : -1.0) * Minor(row[0], row[1], row[3], c);
+  }
+
+  F64 eyeLength = sqrt(eye[0] * eye[0] + eye[1] * eye[1] + eye[2] * eye[2]);
+  bool isEyePoint = (1.0e-9 * eyeLength < fabs(eye[3]));
+
+  if (isEyePoint)
+  {
+    eye[0] /= eye[3];
+    eye[1] /= eye[3];
+    eye[2] /= eye[3];
+  }
+  else if (0.0 < eyeLength)
+  {
+    F64 sign = (0.0 < row[2][0] * eye[0] + row[2][1] * eye[1] + row[2][2] * eye[2]) ? -1.0 : 1.0;
+    eye[0] *= sign / eyeLength;
+    eye[1] *= sign / eyeLength;
+    eye[2] *= sign / eyeLength;
+  }
+
+  F64 eyeDistance = sqrt(eye[0] * eye[0] + eye[1] * eye[1] + eye[2] * eye[2]);
+
+  VisiblePatchCount = 0u;
+
+  for (U16 p = 0; p < PatchCount; ++p)
+  {
+    const Patch & patch = Patches[p];
+
+    if (0u == patch.IndexCount)
+    {
+      continue;
+    }
+
+    const F64 c[3] = { patch.Center[0], patch.Center[1], patch.Center[2] };
+    const F64 r = patch.Radius;
+    const F64 axis[3] = { patch.ConeAxis[0], patch.ConeAxis[1], patch.ConeAxis[2] };
+
+    bool isCulled = false;
+
+    // Outside a frustum plane.
+    for (U8 i = 0; (i < 6u) && ! isCulled; ++i)
+    {
+      isCulled = (plane[i][0] * c[0] + plane[i][1] * c[1] + plane[i][2] * c[2] + plane[i][3] < -r);
+    }
+
+    if (isEyePoint && ! isCulled)
+    {
+      F64 d[3] = { eye[0] - c[0], eye[1] - c[1], eye[2] - c[2] };
+      F64 distance = sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+
+      // Facing away: every normal of the cone points away from every
+      // direction to the eye from the sphere.
+      if (r < distance)
+      {
+        F64 sinSphere = r / distance;
+        F64 cosSphere = sqrt(1.0 - sinSphere * sinSphere);
+        F64 cosSum = patch.ConeCos * cosSphere - patch.ConeSin * sinSphere;
+        F64 sinSum = patch.ConeSin * cosSphere + patch.ConeCos * sinSphere;
+        F64 facing = (axis[0] * d[0] + axis[1] * d[1] + axis[2] * d[2]) / distance;
+
+        isCulled = ((0.0 < cosSum) && (facing < -sinSum));
+      }
+
+      // Below the horizon: behind the plane of the horizon circle and inside
+      // the cone from the eye tangent to the occluder.
+      if ((! isCulled) && (occluder < eyeDistance) && (r < distance))
+      {
+        F64 toEye[3] = { eye[0] / eyeDistance, eye[1] / eyeDistance, eye[2] / eyeDistance };
+        F64 height = c[0] * toEye[0] + c[1] * toEye[1] + c[2] * toEye[2];
+
+        if (height + r <= occluder * occluder / eyeDistance)
+        {
+          F64 cosAngle = (d[0] * toEye[0] + d[1] * toEye[1] + d[2] * toEye[2]) / distance;
+          if (1.0 < cosAngle) cosAngle = 1.0;
+
+          isCulled = (acos(cosAngle) + asin(r / distance) <= asin(occluder / eyeDistance));
+        }
+      }
+    }
+    else if (! isCulled)
+    {
+      F64 facing = axis[0] * eye[0] + axis[1] * eye[1] + axis[2] * eye[2];
+
+      isCulled = ((0.0 < patch.ConeCos) && (facing < -patch.ConeSin));
+
+      if (! isCulled)
+      {
+        F64 height = c[0] * eye[0] + c[1] * eye[1] + c[2] * eye[2];
+        F64 side[3] = { c[0] - height * eye[0], c[1] - height * eye[1], c[2] - height * eye[2] };
+
+        isCulled = ((height + r <= 0.0) && (sqrt(side[0] * side[0] + side[1] * side[1] + side[2] * side[2]) + r <= occluder));
+      }
+    }
+
+    if (! isCulled)
+    {
+      VisiblePatch[VisiblePatchCount++] = p;
+    }
+  }
+
+  IsCulled = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapView.h)
+////////////////////////////////////////////////////////////////////////////////
+U16
+IcosMapView::GetPatchCount(
+    ) const throw ()
+{
+  return (nullptr != Map) ? PatchCount : 0u;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapView.h)
+////////////////////////////////////////////////////////////////////////////////
+U16
+IcosMapView::GetVisiblePatchCount(
+    ) const throw ()
+{
+  return (nullptr != Map) ? VisiblePatchCount : 0u;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapView.h)
+////////////////////////////////////////////////////////////////////////////////
+U16
+IcosMapView::GetVisiblePatch(
+    U16 i
+    ) const throw (Exception::Type)
+{
+  if (GetVisiblePatchCount() <= i)
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  return VisiblePatch[i];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMapView.h)
+////////////////////////////////////////////////////////////////////////////////
+U32
+IcosMapView::GetVisibleTriangleCount(
+    ) const throw ()
+{
+  U32 indexCount = 0u;
+
+  for (U16 i = 0; i < GetVisiblePatchCount(); ++i)
+  {
+    indexCount += Patches[VisiblePatch[i]].IndexCount;
+  }
+
+  return indexCount / 3u;
 }
 
 void
@@ -56,12 +873,30 @@ IcosMapView::Render(
     RenderContext & context
     ) const throw ()
 {
-  if (nullptr != Map)
+  if (nullptr == Map)
   {
-    for (U16 i = 0; i < CellViewCount; ++i)
+    return;
+  }
+
+  if (! IsCulled)
+  {
+    context.Draw(Surface);
+    return;
+  }
+
+  // Patches are laid out in order, so each run of visible patches is one
+  // range of indices.
+  for (U16 i = 0; i < VisiblePatchCount; )
+  {
+    U32 first = Patches[VisiblePatch[i]].FirstIndex;
+    U32 count = 0u;
+
+    for (U16 next = VisiblePatch[i]; (i < VisiblePatchCount) && (VisiblePatch[i] == next); ++i, ++next)
     {
-      CellView[i].Render(context);
+      count += Patches[next].IndexCount;
     }
+
+    context.Draw(Surface, first, count);
   }
 }
 
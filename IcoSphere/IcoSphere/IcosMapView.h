@@ -19,13 +19,56 @@
  * Chagne Date        Description
  * -----------------------------------------------------------------------------
  * Aug 19, 2019 |---| added license notice
+ * Oct 19, 2026 |---| draw all cells as one indexed triangle list
+ * Oct 19, 2026 |---| share polygon corners through IcosMapMesh
+ * Oct 19, 2026 |---| build the surface with worker threads
+ * Oct 19, 2026 |---| added incremental updates of changed cells
+ * Oct 19, 2026 |---| added patch culling against the view
+ * Oct 19, 2026 |---| order triangles and vertices for the vertex cache
  *
  * ****************************************************************************/
 
-#include "IcosCellView.h"
+#include "Exception.h"
+#include "IcosDiamond.h"
 #include "IcosMap.h"
+#include "IcosMapMesh.h"
+#include "IndexedVertexArray.h"
 #include "NativeTypes.h"
+#include "VertexLayouts.h"
 
+class RenderContext;
+
+////////////////////////////////////////////////////////////////////////////////
+//! Draws the surface of a map. The map's IcosMapMesh is copied into one vertex
+//! and index array when the map is set, so a frame is a single draw call
+//! however many cells the map has. Each polygon corner is computed once and
+//! shared by the three cells meeting there.
+//!
+//! Setting a map on the topology of the previous one, such as the same map
+//! after a simulation step, recomputes nothing but the vertices. Vertices and
+//! triangles are computed by worker threads in chunks written straight to
+//! their place in the arrays, so the result does not depend on the number of
+//! threads. After a few cells change, UpdateCells() recomputes just the
+//! vertices they move and records them for GetDirtyRanges().
+//!
+//! The triangles are laid out patch by patch, a patch being the cells of one
+//! of PATCH_BLOCK_COUNT x PATCH_BLOCK_COUNT blocks of an IcosMapPatches
+//! diamond. Each patch keeps a bounding sphere and a cone holding its
+//! triangle normals. SetView() culls the patches outside the view frustum,
+//! those facing away from the eye and those hidden below the horizon of the
+//! lowest point of the surface, and Render() then draws only the rest.
+//!
+//! Within each patch the triangles are reordered for the post-transform
+//! vertex cache, and the vertices are then stored in the order the triangles
+//! first use them (see VertexCacheOptimizer), so the GPU transforms about
+//! one vertex per triangle instead of three and fetches vertices mostly in
+//! order. The reordering is part of triangulating and is redone only when
+//! the topology changes.
+//!
+//! Vertices are stored as VertexElevation, 8 bytes each against 32 for
+//! Vertex: a direction, a radius and a grey level the vertex shader turns
+//! back into a position and a color (see RenderContext::SetProgram()).
+////////////////////////////////////////////////////////////////////////////////
 class IcosMapView
 {
 public:
@@ -36,11 +79,99 @@ public:
   ~IcosMapView(
       ) throw ();
 
+  //////////////////////////////////////////////////////////////////////////////
+  //! Builds the surface of map with threadCount threads, zero using one per
+  //! core. The map must outlive its use by the view.
+  //////////////////////////////////////////////////////////////////////////////
   void
   SetMap(
-      const IcosMap & map
+      const IcosMap & map,
+      U32 threadCount = 0u
+      ) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Recomputes the vertices that depend on the elevation of the given cells
+  //! of the current map: each cell's center and the corners it shares with
+  //! its neighbors. The cost follows the number of cells, not the map size.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  UpdateCells(
+      const U16 cellID[],
+      U32 cellCount
+      ) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Recomputes the vertices of every cell in the current map's dirty blocks
+  //! (see IcosMap::IsBlockDirty()). The map's dirty blocks are left as they
+  //! are for their owner to clear.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  UpdateDirtyBlocks(
+      ) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Vertices changed since the last ClearDirtyRanges(), as ranges for a
+  //! renderer keeping the surface in a GPU buffer to upload. Ranges less than
+  //! DIRTY_RANGE_GAP vertices apart are merged. At most maxRangeCount ranges
+  //! are returned, the last one extended over any that do not fit, and the
+  //! number returned.
+  //////////////////////////////////////////////////////////////////////////////
+  static const U32 DIRTY_RANGE_GAP = 64u;
+
+  U32
+  GetDirtyRanges(
+      U32 first[],
+      U32 count[],
+      U32 maxRangeCount
+      ) const throw ();
+
+  void
+  ClearDirtyRanges(
       ) throw ();
 
+  //////////////////////////////////////////////////////////////////////////////
+  //! Culls the patches of the current map for a view. viewProjection is the
+  //! column-major matrix taking map coordinates to clip space; the eye, a
+  //! point for a perspective projection or a direction for an orthographic
+  //! one, is recovered from it. Every patch is visible after SetMap() until
+  //! the first call.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  SetView(
+      const F32 viewProjection[16]
+      ) throw ();
+
+  static const U8 PATCH_BLOCK_COUNT = 4u;
+  static const U16 MAX_PATCH_COUNT = ICOS_DIAMOND_COUNT * PATCH_BLOCK_COUNT * PATCH_BLOCK_COUNT;
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the number of patches, some of which may hold no cells on small
+  //! maps.
+  //////////////////////////////////////////////////////////////////////////////
+  U16
+  GetPatchCount(
+      ) const throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the number of patches left by the last SetView(), and visible
+  //! patch i of them in increasing order.
+  //////////////////////////////////////////////////////////////////////////////
+  U16
+  GetVisiblePatchCount(
+      ) const throw ();
+
+  U16
+  GetVisiblePatch(
+      U16 i
+      ) const throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the number of triangles Render() submits.
+  //////////////////////////////////////////////////////////////////////////////
+  U32
+  GetVisibleTriangleCount(
+      ) const throw ();
+
   void
   Render(
       RenderContext & context
@@ -48,11 +179,96 @@ public:
 
 private:
 
+  IcosMapView(const IcosMapView &);
+  IcosMapView & operator=(const IcosMapView &);
+
+  static const U32 CHUNK_VERTEX_COUNT = 1024u;
+  static const U32 CHUNK_CELL_COUNT = 1024u;
+
+  //! Vertex cache size the triangles of each patch are ordered for.
+  static const U32 VERTEX_CACHE_SIZE = 16u;
+
+  struct Job;
+
+  struct Patch
+  {
+    //! Range of the patch's triangles in the indices of Surface.
+    U32 FirstIndex;
+    U32 IndexCount;
+    //! Bounding sphere of the patch's vertices.
+    F32 Center[3];
+    F32 Radius;
+    //! Axis of the cone holding every triangle normal, and the cosine and
+    //! sine of its half angle.
+    F32 ConeAxis[3];
+    F32 ConeCos;
+    F32 ConeSin;
+    //! Distance from the center of the sphere to the lowest vertex.
+    F32 MinRadius;
+  };
+
+  static
+  void
+  Run(
+      Job & job,
+      U32 threadCount
+      ) throw ();
+
+  static
+  void
+  Work(
+      Job * job
+      ) throw ();
+
+  void
+  UpdateCell(
+      U16 cellID
+      ) throw ();
+
+  void
+  UpdateVertex(
+      U32 vertex
+      ) throw ();
+
+  void
+  BuildPatches(
+      const IcosTopology & topology,
+      U16 cellOrder[]
+      ) throw (Exception::Type);
+
+  void
+  BoundPatch(
+      U16 patch
+      ) throw ();
+
   const IcosMap * Map;
 
-  U16 CellViewCount;
+  //! Shared corners and fan triangles of the map's cells.
+  IcosMapMesh Mesh;
+
+  //! Vertices of Mesh, shaded by elevation, and its triangles.
+  IndexedVertexArray<VertexElevation> Surface;
+
+  //! Place in Surface of each vertex of Mesh.
+  U32 VertexSlot[IcosMapMesh::MAX_VERTEX_COUNT];
+
+  //! One bit per vertex of Surface changed since the last ClearDirtyRanges().
+  U64 DirtyVertex[(IcosMapMesh::MAX_VERTEX_COUNT + 63u) / 64u];
+
+  U16 PatchCount;
+  Patch Patches[MAX_PATCH_COUNT];
+
+  //! Patch holding each cell.
+  U8 CellPatch[IcosMap::MAX_CELL_COUNT];
+
+  //! One bit per patch whose bounds are out of date.
+  U64 StalePatch[(MAX_PATCH_COUNT + 63u) / 64u];
 
-  IcosCellView CellView[IcosMap::MAX_CELL_COUNT];
+  //! Patches drawn by Render(), in increasing order, and whether they are a
+  //! culled subset of all patches.
+  U16 VisiblePatchCount;
+  U16 VisiblePatch[MAX_PATCH_COUNT];
+  bool IsCulled;
 
 };
 
@@ -0,0 +1,519 @@
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ *
+ * ****************************************************************************/
+
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "IcosMapMesh.h"
+#include "IcosMeshExport.h"
+
+typedef std::chrono::steady_clock Clock;
+
+//! Parts of a file that are encoded chunk by chunk, in file order per format.
+enum Section
+{
+  SECTION_PLY_VERTEX,
+  SECTION_PLY_FACE,
+  SECTION_OBJ_VERTEX,
+  SECTION_OBJ_FACE,
+  SECTION_GLB_POSITION,
+  SECTION_GLB_NORMAL,
+  SECTION_GLB_COLOR,
+  SECTION_GLB_INDEX
+};
+
+static const U32 GLB_MAGIC = 0x46546C67u;
+static const U32 GLB_VERSION = 2u;
+static const U32 GLB_CHUNK_JSON = 0x4E4F534Au;
+static const U32 GLB_CHUNK_BIN = 0x004E4942u;
+
+//! Bytes of one binary PLY vertex: position, normal and RGB color.
+static const U32 PLY_VERTEX_BYTES = 6u * sizeof(F32) + 3u;
+//! Bytes of one binary PLY face: the index count and three indices.
+static const U32 PLY_FACE_BYTES = 1u + 3u * sizeof(S32);
+
+struct Chunk
+{
+  Section Part;
+  //! First vertex or cell of the chunk.
+  U32 First;
+  //! Number of vertices or cells of the chunk.
+  U32 Count;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns a grey level in [0,1] as a byte.
+////////////////////////////////////////////////////////////////////////////////
+static inline U8 ToByte(F32 shade) throw ()
+{
+  if (! (0.0f < shade)) return 0u;
+  if (1.0f < shade) return 255u;
+  return (U8)(shade * 255.0f + 0.5f);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Appends byteCount bytes to a buffer.
+////////////////////////////////////////////////////////////////////////////////
+static inline void Append(std::vector<U8> & buffer, const void * bytes, U32 byteCount) throw ()
+{
+  const U8 * in = (const U8 *)bytes;
+  buffer.insert(buffer.end(), in, in + byteCount);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Appends printf style text to a buffer.
+////////////////////////////////////////////////////////////////////////////////
+static void AppendText(std::vector<U8> & buffer, const char * format, ...) throw ()
+  __attribute__((format(printf, 2, 3)));
+
+static void AppendText(std::vector<U8> & buffer, const char * format, ...) throw ()
+{
+  char text[256];
+  va_list arguments;
+  va_start(arguments, format);
+  int length = vsnprintf(text, sizeof(text), format, arguments);
+  va_end(arguments);
+
+  if (0 < length) Append(buffer, text, ((U32)length < sizeof(text)) ? (U32)length : (U32)sizeof(text) - 1u);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! State shared by the worker threads and the writing thread of one call to
+//! Write(). Chunks are numbered in file order.
+////////////////////////////////////////////////////////////////////////////////
+struct IcosMeshExport::Job
+{
+  const IcosMapMesh * Mesh;
+  const F32 * Elevation;
+  std::vector<Chunk> Chunks;
+  //! Index of the next chunk to be claimed by a worker.
+  std::atomic<U32> NextChunk;
+  //! Guards Encoded and IsEncoded.
+  std::mutex Lock;
+  //! Signalled whenever a chunk has been encoded.
+  std::condition_variable ChunkEncoded;
+  std::vector< std::vector<U8> > Encoded;
+  std::vector<bool> IsEncoded;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//! Encodes one chunk into bytes.
+////////////////////////////////////////////////////////////////////////////////
+static
+void
+Encode(
+    const IcosMapMesh & mesh,
+    const F32 elevation[],
+    const Chunk & chunk,
+    std::vector<IcosMapMesh::SurfaceVertex> & vertex,
+    std::vector<U32> & index,
+    std::vector<U8> & out
+    ) throw ()
+{
+  out.clear();
+
+  switch (chunk.Part)
+  {
+    case SECTION_PLY_VERTEX:
+    case SECTION_OBJ_VERTEX:
+    case SECTION_GLB_POSITION:
+    case SECTION_GLB_NORMAL:
+    case SECTION_GLB_COLOR:
+      vertex.resize(chunk.Count);
+      mesh.GetVertices(elevation, chunk.First, chunk.Count, &vertex[0]);
+      break;
+
+    default:
+      index.resize(3u * (mesh.GetTriangleOffset(chunk.First + chunk.Count) - mesh.GetTriangleOffset(chunk.First)));
+      mesh.GetTriangles(chunk.First, chunk.Count, &index[0]);
+      break;
+  }
+
+  switch (chunk.Part)
+  {
+    case SECTION_PLY_VERTEX:
+      out.reserve(chunk.Count * PLY_VERTEX_BYTES);
+      for (U32 i = 0; i < chunk.Count; ++i)
+      {
+        U8 shade = ToByte(vertex[i].Shade);
+        U8 color[3] = { shade, shade, shade };
+        Append(out, vertex[i].Position, sizeof(vertex[i].Position));
+        Append(out, vertex[i].Normal, sizeof(vertex[i].Normal));
+        Append(out, color, sizeof(color));
+      }
+      break;
+
+    case SECTION_PLY_FACE:
+      out.reserve(index.size() / 3u * PLY_FACE_BYTES);
+      for (U32 i = 0; i < index.size(); i += 3u)
+      {
+        U8 count = 3u;
+        S32 face[3] = { (S32)index[i], (S32)index[i + 1u], (S32)index[i + 2u] };
+        Append(out, &count, sizeof(count));
+        Append(out, face, sizeof(face));
+      }
+      break;
+
+    case SECTION_OBJ_VERTEX:
+      for (U32 i = 0; i < chunk.Count; ++i)
+      {
+        const IcosMapMesh::SurfaceVertex & v = vertex[i];
+        F32 shade = ToByte(v.Shade) / 255.0f;
+        AppendText(out, "v %.6f %.6f %.6f %.4f %.4f %.4f\nvn %.5f %.5f %.5f\n",
+            v.Position[0], v.Position[1], v.Position[2], shade, shade, shade,
+            v.Normal[0], v.Normal[1], v.Normal[2]);
+      }
+      break;
+
+    case SECTION_OBJ_FACE:
+      // OBJ indices start at one.
+      for (U32 i = 0; i < index.size(); i += 3u)
+      {
+        U32 a = index[i] + 1u;
+        U32 b = index[i + 1u] + 1u;
+        U32 c = index[i + 2u] + 1u;
+        AppendText(out, "f %u//%u %u//%u %u//%u\n", a, a, b, b, c, c);
+      }
+      break;
+
+    case SECTION_GLB_POSITION:
+      for (U32 i = 0; i < chunk.Count; ++i) Append(out, vertex[i].Position, sizeof(vertex[i].Position));
+      break;
+
+    case SECTION_GLB_NORMAL:
+      for (U32 i = 0; i < chunk.Count; ++i) Append(out, vertex[i].Normal, sizeof(vertex[i].Normal));
+      break;
+
+    case SECTION_GLB_COLOR:
+      for (U32 i = 0; i < chunk.Count; ++i)
+      {
+        U8 shade = ToByte(vertex[i].Shade);
+        U8 color[4] = { shade, shade, shade, 255u };
+        Append(out, color, sizeof(color));
+      }
+      break;
+
+    case SECTION_GLB_INDEX:
+      Append(out, &index[0], (U32)(index.size() * sizeof(U32)));
+      break;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Claims chunks until none are left and encodes each.
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMeshExport::Work(
+    Job * job
+    ) throw ()
+{
+  std::vector<IcosMapMesh::SurfaceVertex> vertex;
+  std::vector<U32> index;
+  std::vector<U8> encoded;
+  U32 chunkCount = (U32)job->Chunks.size();
+
+  for (U32 i = job->NextChunk++; i < chunkCount; i = job->NextChunk++)
+  {
+    Encode(*job->Mesh, job->Elevation, job->Chunks[i], vertex, index, encoded);
+
+    std::lock_guard<std::mutex> lock(job->Lock);
+    job->Encoded[i].swap(encoded);
+    job->IsEncoded[i] = true;
+    job->ChunkEncoded.notify_all();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Appends the chunks of a section covering count vertices or cells.
+////////////////////////////////////////////////////////////////////////////////
+static
+void
+AddSection(
+    std::vector<Chunk> & chunks,
+    Section part,
+    U32 count,
+    U32 chunkSize
+    ) throw ()
+{
+  for (U32 first = 0; first < count; first += chunkSize)
+  {
+    Chunk chunk = { part, first, (count - first < chunkSize) ? count - first : chunkSize };
+    chunks.push_back(chunk);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Builds the header of a binary glTF file up to the start of its binary
+//! chunk's data: the file header, the JSON chunk and the binary chunk header.
+////////////////////////////////////////////////////////////////////////////////
+static
+void
+BuildGlbHeader(
+    const IcosMapMesh & mesh,
+    const F32 elevation[],
+    std::vector<U8> & out
+    ) throw ()
+{
+  U32 vertexCount = mesh.GetVertexCount();
+  U32 indexCount = 3u * mesh.GetTriangleCount();
+
+  // The position accessor must carry the exact bounds of the positions.
+  F32 minimum[3] = {  1e30f,  1e30f,  1e30f };
+  F32 maximum[3] = { -1e30f, -1e30f, -1e30f };
+  std::vector<IcosMapMesh::SurfaceVertex> vertex;
+
+  for (U32 first = 0; first < vertexCount; first += IcosMeshExport::CHUNK_VERTEX_COUNT)
+  {
+    U32 count = vertexCount - first;
+    if (IcosMeshExport::CHUNK_VERTEX_COUNT < count) count = IcosMeshExport::CHUNK_VERTEX_COUNT;
+
+    vertex.resize(count);
+    mesh.GetVertices(elevation, first, count, &vertex[0]);
+
+    for (U32 i = 0; i < count; ++i)
+    {
+      for (U8 k = 0; k < 3u; ++k)
+      {
+        if (vertex[i].Position[k] < minimum[k]) minimum[k] = vertex[i].Position[k];
+        if (maximum[k] < vertex[i].Position[k]) maximum[k] = vertex[i].Position[k];
+      }
+    }
+  }
+
+  U32 positionBytes = vertexCount * 3u * sizeof(F32);
+  U32 colorBytes = vertexCount * 4u;
+  U32 indexBytes = indexCount * sizeof(U32);
+  U32 binaryBytes = 2u * positionBytes + colorBytes + indexBytes;
+
+  char text[2048];
+  snprintf(text, sizeof(text),
+      "{\"asset\":{\"version\":\"2.0\",\"generator\":\"IcoSphere\"},"
+      "\"scene\":0,\"scenes\":[{\"nodes\":[0]}],\"nodes\":[{\"mesh\":0}],"
+      "\"meshes\":[{\"primitives\":[{\"attributes\":{\"POSITION\":0,\"NORMAL\":1,\"COLOR_0\":2},\"indices\":3,\"mode\":4}]}],"
+      "\"buffers\":[{\"byteLength\":%u}],"
+      "\"bufferViews\":["
+      "{\"buffer\":0,\"byteOffset\":0,\"byteLength\":%u,\"target\":34962},"
+      "{\"buffer\":0,\"byteOffset\":%u,\"byteLength\":%u,\"target\":34962},"
+      "{\"buffer\":0,\"byteOffset\":%u,\"byteLength\":%u,\"target\":34962},"
+      "{\"buffer\":0,\"byteOffset\":%u,\"byteLength\":%u,\"target\":34963}],"
+      "\"accessors\":["
+      "{\"bufferView\":0,\"componentType\":5126,\"count\":%u,\"type\":\"VEC3\","
+      "\"min\":[%.9g,%.9g,%.9g],\"max\":[%.9g,%.9g,%.9g]},"
+      "{\"bufferView\":1,\"componentType\":5126,\"count\":%u,\"type\":\"VEC3\"},"
+      "{\"bufferView\":2,\"componentType\":5121,\"normalized\":true,\"count\":%u,\"type\":\"VEC4\"},"
+      "{\"bufferView\":3,\"componentType\":5125,\"count\":%u,\"type\":\"SCALAR\"}]}",
+      binaryBytes,
+      positionBytes,
+      positionBytes, positionBytes,
+      2u * positionBytes, colorBytes,
+      2u * positionBytes + colorBytes, indexBytes,
+      vertexCount,
+      minimum[0], minimum[1], minimum[2], maximum[0], maximum[1], maximum[2],
+      vertexCount,
+      vertexCount,
+      indexCount);
+
+  // Chunks are padded to four bytes, JSON with spaces.
+  std::string json(text);
+  while (json.size() % 4u != 0u) json += ' ';
+
+  U32 header[5] =
+  {
+    GLB_MAGIC,
+    GLB_VERSION,
+    (U32)(12u + 8u + json.size() + 8u + binaryBytes),
+    (U32)json.size(),
+    GLB_CHUNK_JSON
+  };
+  U32 binaryHeader[2] = { binaryBytes, GLB_CHUNK_BIN };
+
+  Append(out, header, sizeof(header));
+  Append(out, json.data(), (U32)json.size());
+  Append(out, binaryHeader, sizeof(binaryHeader));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosMeshExport.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosMeshExport::Write(
+    const IcosMap & map,
+    const char * path,
+    U8 format,
+    U32 threadCount,
+    Statistics * statistics
+    ) throw (Exception::Type)
+{
+  if (! ((nullptr != path) && (0u < map.GetCellCount()) && (format <= FORMAT_GLB)))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  if (0u == threadCount)
+  {
+    threadCount = std::thread::hardware_concurrency();
+    if (0u == threadCount) threadCount = 1u;
+  }
+
+  Clock::time_point start = Clock::now();
+
+  IcosMapMesh * mesh = new IcosMapMesh();
+  std::vector<U8> prologue;
+
+  try
+  {
+    mesh->Initialize(map.GetTopology());
+  }
+  catch (Exception::Type error)
+  {
+    delete mesh;
+    throw (error);
+  }
+
+  U32 vertexCount = mesh->GetVertexCount();
+  U32 triangleCount = mesh->GetTriangleCount();
+  U32 cellCount = mesh->GetCellCount();
+
+  Job job;
+  job.Mesh = mesh;
+  job.Elevation = map.GetElevations();
+  job.NextChunk = 0u;
+
+  switch (format)
+  {
+    case FORMAT_PLY:
+    {
+      const U32 byteOrderMark = 1u;
+      bool isLittleEndian = (*(const U8 *)&byteOrderMark == 1u);
+
+      AppendText(prologue, "ply\nformat %s 1.0\ncomment IcoSphere map size %u\n",
+          isLittleEndian ? "binary_little_endian" : "binary_big_endian", map.GetTopology().GetSize());
+      AppendText(prologue, "element vertex %u\n"
+          "property float x\nproperty float y\nproperty float z\n"
+          "property float nx\nproperty float ny\nproperty float nz\n"
+          "property uchar red\nproperty uchar green\nproperty uchar blue\n", vertexCount);
+      AppendText(prologue, "element face %u\nproperty list uchar int vertex_indices\nend_header\n", triangleCount);
+
+      AddSection(job.Chunks, SECTION_PLY_VERTEX, vertexCount, CHUNK_VERTEX_COUNT);
+      AddSection(job.Chunks, SECTION_PLY_FACE, cellCount, CHUNK_CELL_COUNT);
+      break;
+    }
+
+    case FORMAT_OBJ:
+      AppendText(prologue, "# IcoSphere map size %u\n# %u vertices, %u triangles\n",
+          map.GetTopology().GetSize(), vertexCount, triangleCount);
+
+      AddSection(job.Chunks, SECTION_OBJ_VERTEX, vertexCount, CHUNK_VERTEX_COUNT);
+      AddSection(job.Chunks, SECTION_OBJ_FACE, cellCount, CHUNK_CELL_COUNT);
+      break;
+
+    case FORMAT_GLB:
+      BuildGlbHeader(*mesh, map.GetElevations(), prologue);
+
+      AddSection(job.Chunks, SECTION_GLB_POSITION, vertexCount, CHUNK_VERTEX_COUNT);
+      AddSection(job.Chunks, SECTION_GLB_NORMAL, vertexCount, CHUNK_VERTEX_COUNT);
+      AddSection(job.Chunks, SECTION_GLB_COLOR, vertexCount, CHUNK_VERTEX_COUNT);
+      AddSection(job.Chunks, SECTION_GLB_INDEX, cellCount, CHUNK_CELL_COUNT);
+      break;
+  }
+
+  U32 chunkCount = (U32)job.Chunks.size();
+  job.Encoded.resize(chunkCount);
+  job.IsEncoded.resize(chunkCount, false);
+
+  if (chunkCount < threadCount) threadCount = chunkCount;
+
+  FILE * file = fopen(path, "wb");
+  if (file == nullptr)
+  {
+    delete mesh;
+    throw (Exception::IO_ERROR);
+  }
+
+  std::vector<std::thread> worker;
+  for (U32 i = 0; i < threadCount; ++i)
+  {
+    worker.push_back(std::thread(Work, &job));
+  }
+
+  // Write the chunks in file order as they are encoded, releasing each once
+  // written.
+  bool isWritten = (fwrite(&prologue[0], 1, prologue.size(), file) == prologue.size());
+  U64 fileBytes = prologue.size();
+
+  for (U32 i = 0; isWritten && (i < chunkCount); ++i)
+  {
+    std::vector<U8> encoded;
+    {
+      std::unique_lock<std::mutex> lock(job.Lock);
+      while (! job.IsEncoded[i]) job.ChunkEncoded.wait(lock);
+      encoded.swap(job.Encoded[i]);
+    }
+
+    isWritten = encoded.empty() || (fwrite(&encoded[0], 1, encoded.size(), file) == encoded.size());
+    fileBytes += encoded.size();
+  }
+
+  // Stop the workers early if writing failed.
+  job.NextChunk = chunkCount;
+
+  for (U32 i = 0; i < worker.size(); ++i)
+  {
+    worker[i].join();
+  }
+
+  delete mesh;
+
+  if ((fclose(file) != 0) || ! isWritten)
+  {
+    remove(path);
+    throw (Exception::IO_ERROR);
+  }
+
+  if (nullptr != statistics)
+  {
+    statistics->ThreadCount = threadCount;
+    statistics->VertexCount = vertexCount;
+    statistics->TriangleCount = triangleCount;
+    statistics->ChunkCount = chunkCount;
+    statistics->FileBytes = fileBytes;
+    statistics->ElapsedSeconds = std::chrono::duration<F64>(Clock::now() - start).count();
+  }
+}
+
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
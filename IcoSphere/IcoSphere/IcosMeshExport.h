@@ -0,0 +1,93 @@
+#pragma once
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ *
+ * ****************************************************************************/
+
+
+#include "Exception.h"
+#include "IcosMap.h"
+#include "NativeTypes.h"
+
+////////////////////////////////////////////////////////////////////////////////
+//! Writes the IcosMapMesh of a map, with per vertex normals and grey level
+//! colors, as binary PLY, Wavefront OBJ or binary glTF (.glb).
+//!
+//! The file is cut into chunks of vertices and of cells that worker threads
+//! encode in parallel while the calling thread writes them in order, so the
+//! whole mesh is never held in memory and the file is written front to back.
+////////////////////////////////////////////////////////////////////////////////
+class IcosMeshExport
+{
+public:
+
+  static const U8 FORMAT_PLY = 0u;
+  static const U8 FORMAT_OBJ = 1u;
+  static const U8 FORMAT_GLB = 2u;
+
+  static const U32 CHUNK_VERTEX_COUNT = 4096u;
+  static const U32 CHUNK_CELL_COUNT = 1024u;
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Size and timing of the last call to Write().
+  //////////////////////////////////////////////////////////////////////////////
+  struct Statistics
+  {
+    U32 ThreadCount;
+    U32 VertexCount;
+    U32 TriangleCount;
+    U32 ChunkCount;
+    U64 FileBytes;
+    F64 ElapsedSeconds;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Writes the mesh of an initialized map to path in the given format. Chunks
+  //! are encoded by threadCount worker threads, zero using one per core.
+  //////////////////////////////////////////////////////////////////////////////
+  static
+  void
+  Write(
+      const IcosMap & map,
+      const char * path,
+      U8 format,
+      U32 threadCount,
+      Statistics * statistics = nullptr
+      ) throw (Exception::Type);
+
+private:
+
+  struct Job;
+
+  static
+  void
+  Work(
+      Job * job
+      ) throw ();
+};
+
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
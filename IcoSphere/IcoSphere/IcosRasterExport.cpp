@@ -0,0 +1,1408 @@
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ *
+ * ****************************************************************************/
+
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <math.h>
+#include <mutex>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+#include "IcosRasterExport.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static const U8 PNG_SIGNATURE[8] = { 0x89u, 'P', 'N', 'G', '\r', '\n', 0x1Au, '\n' };
+//! Modulus of the Adler-32 checksum.
+static const U32 ADLER_BASE = 65521u;
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the dot product of two 3D vectors.
+////////////////////////////////////////////////////////////////////////////////
+static inline F32 Dot(const F32 a[3], const F32 b[3]) throw ()
+{
+  return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Stores the cross product of two 3D vectors.
+////////////////////////////////////////////////////////////////////////////////
+static inline void Cross(const F32 a[3], const F32 b[3], F32 out[3]) throw ()
+{
+  out[0] = a[1] * b[2] - a[2] * b[1];
+  out[1] = a[2] * b[0] - a[0] * b[2];
+  out[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Appends a U16 or U32 in big endian (network and PNG) byte order.
+////////////////////////////////////////////////////////////////////////////////
+static inline void AppendBig16(std::vector<U8> & out, U32 value) throw ()
+{
+  out.push_back((U8)(value >> 8));
+  out.push_back((U8)value);
+}
+
+static inline void AppendBig32(std::vector<U8> & out, U32 value) throw ()
+{
+  AppendBig16(out, value >> 16);
+  AppendBig16(out, value & 0xFFFFu);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the CRC-32 of bytes, continuing from crc, as used by PNG chunks.
+////////////////////////////////////////////////////////////////////////////////
+static
+U32
+UpdateCrc(
+    U32 crc,
+    const U8 bytes[],
+    U64 byteCount
+    ) throw ()
+{
+  struct Table
+  {
+    U32 Entry[256];
+
+    Table()
+    {
+      for (U32 n = 0; n < 256u; ++n)
+      {
+        U32 c = n;
+        for (U8 k = 0; k < 8u; ++k) c = (c & 1u) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+        Entry[n] = c;
+      }
+    }
+  };
+  static const Table table;
+
+  crc = ~crc;
+  for (U64 i = 0; i < byteCount; ++i) crc = table.Entry[(crc ^ bytes[i]) & 0xFFu] ^ (crc >> 8);
+  return ~crc;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the Adler-32 checksum of bytes, as ends a zlib stream.
+////////////////////////////////////////////////////////////////////////////////
+static
+U32
+GetAdler(
+    const U8 bytes[],
+    U64 byteCount
+    ) throw ()
+{
+  U32 a = 1u;
+  U32 b = 0u;
+
+  while (0u < byteCount)
+  {
+    // 5552 bytes is the most that cannot overflow b before reducing.
+    U32 count = (byteCount < 5552u) ? (U32)byteCount : 5552u;
+    for (U32 i = 0; i < count; ++i)
+    {
+      a += bytes[i];
+      b += a;
+    }
+    a %= ADLER_BASE;
+    b %= ADLER_BASE;
+    bytes += count;
+    byteCount -= count;
+  }
+
+  return (b << 16) | a;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the Adler-32 of two byte runs joined, given the checksum of each
+//! and the length of the second.
+////////////////////////////////////////////////////////////////////////////////
+static
+U32
+CombineAdler(
+    U32 first,
+    U32 second,
+    U64 secondBytes
+    ) throw ()
+{
+  U32 remainder = (U32)(secondBytes % ADLER_BASE);
+  U32 a = (first & 0xFFFFu) + (second & 0xFFFFu) + ADLER_BASE - 1u;
+  U32 b = (U32)(((U64)remainder * (first & 0xFFFFu)) % ADLER_BASE);
+  b += (first >> 16) + (second >> 16) + ADLER_BASE - remainder;
+
+  a %= ADLER_BASE;
+  b %= ADLER_BASE;
+
+  return (b << 16) | a;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Appends a PNG chunk.
+////////////////////////////////////////////////////////////////////////////////
+static
+void
+AppendPngChunk(
+    std::vector<U8> & out,
+    const char type[4],
+    const U8 data[],
+    U32 dataBytes
+    ) throw ()
+{
+  AppendBig32(out, dataBytes);
+  size_t start = out.size();
+  out.insert(out.end(), (const U8 *)type, (const U8 *)type + 4);
+  out.insert(out.end(), data, data + dataBytes);
+  AppendBig32(out, UpdateCrc(0u, &out[start], 4u + dataBytes));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Deflate (RFC 1951) compressor for the PNG scanlines of one band at a time.
+//! Each string is matched against the last few earlier strings with the same
+//! first four bytes, taking the longest, and every block gets its own Huffman
+//! codes. Filtered elevation rows are mostly small residues, which the codes
+//! pack into a few bits each.
+////////////////////////////////////////////////////////////////////////////////
+class Deflater
+{
+public:
+
+  Deflater(
+      ) throw ()
+      : Head(HASH_SIZE)
+      , Bits(0u)
+      , BitCount(0u)
+      , Out(nullptr)
+  {
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Appends data[] to out as deflate blocks ending on a byte boundary, with
+  //! the final block if isFinal and otherwise with an empty stored block, so
+  //! the output of consecutive calls joins into one stream.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  Compress(
+      const U8 data[],
+      U32 byteCount,
+      bool isFinal,
+      std::vector<U8> & out
+      ) throw ();
+
+private:
+
+  static const U32 HASH_BITS = 15u;
+  static const U32 HASH_SIZE = 1u << HASH_BITS;
+  static const U32 WINDOW_BYTES = 32768u;
+  static const U32 MIN_MATCH = 4u;
+  static const U32 MAX_MATCH = 258u;
+  //! Earlier strings compared for each match.
+  static const U32 MAX_CHAIN = 4u;
+  //! Strings inside matches longer than this are not hashed.
+  static const U32 MAX_INSERT = 16u;
+  static const U32 BLOCK_TOKEN_COUNT = 65536u;
+  //! A token is a literal byte, or MATCH | length << 16 | distance - 1.
+  static const U32 MATCH = 0x80000000u;
+
+  static const U16 LITERAL_CODE_COUNT = 286u;
+  static const U16 DISTANCE_CODE_COUNT = 30u;
+  static const U16 LENGTH_CODE_COUNT = 19u;
+  static const U16 END_OF_BLOCK = 256u;
+
+  void
+  PutBits(
+      U32 value,
+      U32 count
+      ) throw ()
+  {
+    Bits |= (U64)value << BitCount;
+    BitCount += count;
+
+    if (32u <= BitCount)
+    {
+      U8 bytes[4] = { (U8)Bits, (U8)(Bits >> 8), (U8)(Bits >> 16), (U8)(Bits >> 24) };
+      Out->insert(Out->end(), bytes, bytes + 4);
+      Bits >>= 32;
+      BitCount -= 32u;
+    }
+  }
+
+  void
+  AlignToByte(
+      ) throw ()
+  {
+    while (0u < BitCount)
+    {
+      Out->push_back((U8)Bits);
+      Bits >>= 8;
+      BitCount = (8u < BitCount) ? BitCount - 8u : 0u;
+    }
+
+    Bits = 0u;
+  }
+
+  static
+  void
+  BuildLengths(
+      const U32 frequency[],
+      U16 symbolCount,
+      U8 maxLength,
+      U8 length[]
+      ) throw ();
+
+  static
+  void
+  BuildCodes(
+      const U8 length[],
+      U16 symbolCount,
+      U16 code[]
+      ) throw ();
+
+  void
+  WriteBlock(
+      const U32 token[],
+      U32 tokenCount,
+      bool isFinal
+      ) throw ();
+
+  std::vector<U32> Head;
+  std::vector<U32> Previous;
+  std::vector<U32> Token;
+
+  U64 Bits;
+  U32 BitCount;
+  std::vector<U8> * Out;
+};
+
+//! Base and extra bits of the deflate length codes 257 to 285, and of the
+//! distance codes.
+static const U16 LENGTH_BASE[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static const U8 LENGTH_EXTRA[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static const U16 DISTANCE_BASE[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+static const U8 DISTANCE_EXTRA[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+//! Order the code length code lengths are written in.
+static const U8 LENGTH_CODE_ORDER[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the length code, less 257, of a match length.
+////////////////////////////////////////////////////////////////////////////////
+static inline U32 GetLengthCode(U32 length) throw ()
+{
+  struct Table
+  {
+    U8 Entry[259];
+
+    Table()
+    {
+      for (U32 c = 0; c < 29u; ++c)
+      {
+        for (U32 l = LENGTH_BASE[c]; (l < LENGTH_BASE[c] + (1u << LENGTH_EXTRA[c])) && (l < 259u); ++l) Entry[l] = (U8)c;
+      }
+
+      Entry[258] = 28u;
+    }
+  };
+  static const Table table;
+
+  return table.Entry[length];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the distance code of distance - 1.
+////////////////////////////////////////////////////////////////////////////////
+static inline U32 GetDistanceCode(U32 distanceLess1) throw ()
+{
+  if (distanceLess1 < 4u) return distanceLess1;
+
+  U32 high = 31u - (U32)__builtin_clz(distanceLess1);
+  return 2u * high + ((distanceLess1 >> (high - 1u)) & 1u);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Sets the lengths of a Huffman code for the symbols' frequencies, none over
+//! maxLength bits. At least two symbols get a code, so the code is complete.
+////////////////////////////////////////////////////////////////////////////////
+void
+Deflater::BuildLengths(
+    const U32 frequency[],
+    U16 symbolCount,
+    U8 maxLength,
+    U8 length[]
+    ) throw ()
+{
+  std::vector<U32> weight(frequency, frequency + symbolCount);
+
+  U16 usedCount = 0u;
+  for (U16 s = 0; s < symbolCount; ++s)
+  {
+    if (0u < weight[s]) ++usedCount;
+  }
+
+  for (U16 s = 0; (usedCount < 2u) && (s < symbolCount); ++s)
+  {
+    if (0u == weight[s])
+    {
+      weight[s] = 1u;
+      ++usedCount;
+    }
+  }
+
+  for (;;)
+  {
+    // Leaves sorted by weight, then merged through a second queue of
+    // internal nodes, which are made in order of weight.
+    std::vector< std::pair<U32, U16> > leaf;
+    for (U16 s = 0; s < symbolCount; ++s)
+    {
+      if (0u < weight[s]) leaf.push_back(std::make_pair(weight[s], s));
+    }
+    std::sort(leaf.begin(), leaf.end());
+
+    U16 n = (U16)leaf.size();
+    std::vector<U32> nodeWeight(n - 1u);
+    std::vector<U16> parent(2u * n - 1u);
+    U16 nextLeaf = 0u, nextNode = 0u;
+
+    for (U16 i = 0; i < n - 1u; ++i)
+    {
+      U16 child[2];
+      U32 sum = 0u;
+
+      for (U8 k = 0; k < 2u; ++k)
+      {
+        bool isLeaf = (nextLeaf < n) && ((nextNode == i) || (leaf[nextLeaf].first <= nodeWeight[nextNode]));
+        child[k] = isLeaf ? nextLeaf++ : (U16)(n + nextNode++);
+        sum += isLeaf ? leaf[child[k]].first : nodeWeight[child[k] - n];
+      }
+
+      nodeWeight[i] = sum;
+      parent[child[0]] = parent[child[1]] = (U16)(n + i);
+    }
+
+    // Depths from the root, the last node, down.
+    std::vector<U8> depth(2u * n - 1u, 0u);
+    U8 maxDepth = 0u;
+    for (S32 i = 2 * n - 3; 0 <= i; --i)
+    {
+      depth[i] = depth[parent[i]] + 1u;
+      if (maxDepth < depth[i]) maxDepth = depth[i];
+    }
+
+    if (maxDepth <= maxLength)
+    {
+      memset(length, 0, symbolCount);
+      for (U16 i = 0; i < n; ++i) length[leaf[i].second] = depth[i];
+      return;
+    }
+
+    // Too deep: flatten the weights and try again.
+    for (U16 s = 0; s < symbolCount; ++s)
+    {
+      if (0u < weight[s]) weight[s] = (weight[s] + 1u) / 2u;
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Sets the canonical codes of the lengths, bit reversed for writing from the
+//! least significant bit.
+////////////////////////////////////////////////////////////////////////////////
+void
+Deflater::BuildCodes(
+    const U8 length[],
+    U16 symbolCount,
+    U16 code[]
+    ) throw ()
+{
+  U16 lengthCount[16] = { 0 };
+  for (U16 s = 0; s < symbolCount; ++s) lengthCount[length[s]]++;
+  lengthCount[0] = 0u;
+
+  U16 next[16] = { 0 };
+  for (U8 l = 1; l < 16u; ++l) next[l] = (U16)((next[l - 1u] + lengthCount[l - 1u]) << 1);
+
+  for (U16 s = 0; s < symbolCount; ++s)
+  {
+    U16 c = (0u < length[s]) ? next[length[s]]++ : 0u;
+    U16 reversed = 0u;
+    for (U8 b = 0; b < length[s]; ++b) reversed = (U16)((reversed << 1) | ((c >> b) & 1u));
+    code[s] = reversed;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Writes tokens as one block with dynamic Huffman codes.
+////////////////////////////////////////////////////////////////////////////////
+void
+Deflater::WriteBlock(
+    const U32 token[],
+    U32 tokenCount,
+    bool isFinal
+    ) throw ()
+{
+  U32 literalFrequency[LITERAL_CODE_COUNT] = { 0 };
+  U32 distanceFrequency[DISTANCE_CODE_COUNT] = { 0 };
+
+  for (U32 i = 0; i < tokenCount; ++i)
+  {
+    if (0u == (token[i] & MATCH))
+    {
+      literalFrequency[token[i]]++;
+    }
+    else
+    {
+      literalFrequency[257u + GetLengthCode((token[i] >> 16) & 0x1FFu)]++;
+      distanceFrequency[GetDistanceCode(token[i] & 0xFFFFu)]++;
+    }
+  }
+
+  literalFrequency[END_OF_BLOCK] = 1u;
+
+  U8 literalLength[LITERAL_CODE_COUNT];
+  U8 distanceLength[DISTANCE_CODE_COUNT];
+  BuildLengths(literalFrequency, LITERAL_CODE_COUNT, 15u, literalLength);
+  BuildLengths(distanceFrequency, DISTANCE_CODE_COUNT, 15u, distanceLength);
+
+  U16 literalCount = LITERAL_CODE_COUNT;
+  while (0u == literalLength[literalCount - 1u]) --literalCount;
+  U16 distanceCount = DISTANCE_CODE_COUNT;
+  while (0u == distanceLength[distanceCount - 1u]) --distanceCount;
+
+  // Both code lengths run together, shortened by run length codes 16 to 18.
+  U8 length[LITERAL_CODE_COUNT + DISTANCE_CODE_COUNT];
+  memcpy(length, literalLength, literalCount);
+  memcpy(&length[literalCount], distanceLength, distanceCount);
+  U16 lengthSymbolCount = literalCount + distanceCount;
+
+  std::vector<U8> symbol;
+  std::vector<U8> extra;
+  U32 symbolFrequency[LENGTH_CODE_COUNT] = { 0 };
+
+  for (U16 i = 0; i < lengthSymbolCount; )
+  {
+    U8 value = length[i];
+    U16 run = 1u;
+    while ((i + run < lengthSymbolCount) && (length[i + run] == value)) ++run;
+    i += run;
+
+    if (0u == value)
+    {
+      while (3u <= run)
+      {
+        U16 n = (138u < run) ? 138u : run;
+        symbol.push_back((11u <= n) ? 18u : 17u);
+        extra.push_back((U8)((11u <= n) ? n - 11u : n - 3u));
+        run -= n;
+      }
+    }
+    else
+    {
+      symbol.push_back(value);
+      extra.push_back(0u);
+      --run;
+
+      while (3u <= run)
+      {
+        U16 n = (6u < run) ? 6u : run;
+        symbol.push_back(16u);
+        extra.push_back((U8)(n - 3u));
+        run -= n;
+      }
+    }
+
+    while (0u < run)
+    {
+      symbol.push_back(value);
+      extra.push_back(0u);
+      --run;
+    }
+  }
+
+  for (U32 i = 0; i < symbol.size(); ++i) symbolFrequency[symbol[i]]++;
+
+  U8 symbolLength[LENGTH_CODE_COUNT];
+  U16 symbolCode[LENGTH_CODE_COUNT];
+  BuildLengths(symbolFrequency, LENGTH_CODE_COUNT, 7u, symbolLength);
+  BuildCodes(symbolLength, LENGTH_CODE_COUNT, symbolCode);
+
+  U8 orderCount = LENGTH_CODE_COUNT;
+  while ((4u < orderCount) && (0u == symbolLength[LENGTH_CODE_ORDER[orderCount - 1u]])) --orderCount;
+
+  U16 literalCode[LITERAL_CODE_COUNT];
+  U16 distanceCode[DISTANCE_CODE_COUNT];
+  BuildCodes(literalLength, LITERAL_CODE_COUNT, literalCode);
+  BuildCodes(distanceLength, DISTANCE_CODE_COUNT, distanceCode);
+
+  PutBits(isFinal ? 1u : 0u, 1u);
+  PutBits(2u, 2u);
+  PutBits(literalCount - 257u, 5u);
+  PutBits(distanceCount - 1u, 5u);
+  PutBits(orderCount - 4u, 4u);
+
+  for (U8 i = 0; i < orderCount; ++i) PutBits(symbolLength[LENGTH_CODE_ORDER[i]], 3u);
+
+  static const U8 SYMBOL_EXTRA_BITS[3] = { 2u, 3u, 7u };
+
+  for (U32 i = 0; i < symbol.size(); ++i)
+  {
+    PutBits(symbolCode[symbol[i]], symbolLength[symbol[i]]);
+    if (16u <= symbol[i]) PutBits(extra[i], SYMBOL_EXTRA_BITS[symbol[i] - 16u]);
+  }
+
+  for (U32 i = 0; i < tokenCount; ++i)
+  {
+    U32 t = token[i];
+
+    if (0u == (t & MATCH))
+    {
+      PutBits(literalCode[t], literalLength[t]);
+      continue;
+    }
+
+    U32 matchLength = (t >> 16) & 0x1FFu;
+    U32 distance = t & 0xFFFFu;
+    U32 lc = GetLengthCode(matchLength);
+    U32 dc = GetDistanceCode(distance);
+
+    PutBits(literalCode[257u + lc], literalLength[257u + lc]);
+    PutBits(matchLength - LENGTH_BASE[lc], LENGTH_EXTRA[lc]);
+    PutBits(distanceCode[dc], distanceLength[dc]);
+    PutBits(distance + 1u - DISTANCE_BASE[dc], DISTANCE_EXTRA[dc]);
+  }
+
+  PutBits(literalCode[END_OF_BLOCK], literalLength[END_OF_BLOCK]);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the hash of the four bytes at p.
+////////////////////////////////////////////////////////////////////////////////
+static inline U32 Hash4(const U8 * p) throw ()
+{
+  U32 word;
+  memcpy(&word, p, sizeof(word));
+  return (word * 2654435761u) >> (32u - 15u);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See Deflater)
+////////////////////////////////////////////////////////////////////////////////
+void
+Deflater::Compress(
+    const U8 data[],
+    U32 byteCount,
+    bool isFinal,
+    std::vector<U8> & out
+    ) throw ()
+{
+  Out = &out;
+  Token.clear();
+  Previous.resize(byteCount);
+
+  // Positions are stored plus one, so zero is none.
+  std::fill(Head.begin(), Head.end(), 0u);
+
+  U32 i = 0u;
+
+  while (i + MIN_MATCH <= byteCount)
+  {
+    U32 h = Hash4(&data[i]);
+    U32 candidate = Head[h];
+    Previous[i] = candidate;
+    Head[h] = i + 1u;
+
+    U32 bestLength = 0u;
+    U32 bestDistance = 0u;
+    U32 limit = byteCount - i;
+    if (MAX_MATCH < limit) limit = MAX_MATCH;
+
+    for (U32 chain = 0; (chain < MAX_CHAIN) && (0u < candidate) && (i + 1u - candidate <= WINDOW_BYTES); ++chain)
+    {
+      const U8 * a = &data[candidate - 1u];
+      const U8 * b = &data[i];
+
+      if (a[bestLength] == b[bestLength])
+      {
+        U32 l = 0u;
+        while ((l < limit) && (a[l] == b[l])) ++l;
+
+        if (bestLength < l)
+        {
+          bestLength = l;
+          bestDistance = i + 1u - candidate;
+          if (l == limit) break;
+        }
+      }
+
+      candidate = Previous[candidate - 1u];
+    }
+
+    if (bestLength < MIN_MATCH)
+    {
+      Token.push_back(data[i]);
+      ++i;
+      continue;
+    }
+
+    Token.push_back(MATCH | (bestLength << 16) | (bestDistance - 1u));
+
+    U32 end = i + bestLength;
+
+    if (bestLength <= MAX_INSERT)
+    {
+      for (++i; (i < end) && (i + MIN_MATCH <= byteCount); ++i)
+      {
+        h = Hash4(&data[i]);
+        Previous[i] = Head[h];
+        Head[h] = i + 1u;
+      }
+    }
+
+    i = end;
+  }
+
+  for (; i < byteCount; ++i)
+  {
+    Token.push_back(data[i]);
+  }
+
+  for (U32 first = 0; first < Token.size(); first += BLOCK_TOKEN_COUNT)
+  {
+    U32 count = (U32)Token.size() - first;
+    if (BLOCK_TOKEN_COUNT < count) count = BLOCK_TOKEN_COUNT;
+
+    WriteBlock(&Token[first], count, isFinal && (first + count == Token.size()));
+  }
+
+  if (! isFinal)
+  {
+    // An empty stored block ends on a byte boundary.
+    PutBits(0u, 3u);
+    AlignToByte();
+    static const U8 EMPTY_STORED[4] = { 0x00u, 0x00u, 0xFFu, 0xFFu };
+    out.insert(out.end(), EMPTY_STORED, EMPTY_STORED + 4);
+  }
+  else
+  {
+    AlignToByte();
+  }
+
+  Out = nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Looks up the field value in any direction of the sphere.
+////////////////////////////////////////////////////////////////////////////////
+class Sampler
+{
+public:
+
+  Sampler(
+      const IcosTopology & topology,
+      const F32 field[],
+      const IcosRasterExport::Options & options,
+      U32 width,
+      U32 height
+      ) throw ()
+      : Field(field)
+      , Projection(options.Projection)
+      , Sampling(options.Sampling)
+      , Width(width)
+      , Height(height)
+  {
+    U16 cellCount = topology.GetCellCount();
+
+    // Compact copies of the cell positions and adjacency keep the walk in
+    // cache.
+    Position.resize(3u * cellCount);
+    Adjacent.resize(IcosCell::MAX_ADJACENT_CELLS * cellCount);
+    AdjacentCount.resize(cellCount);
+
+    for (U16 c = 0; c < cellCount; ++c)
+    {
+      const IcosCell & cell = topology.GetCell(c);
+      Position[3u * c + 0u] = cell.Normal.X;
+      Position[3u * c + 1u] = cell.Normal.Y;
+      Position[3u * c + 2u] = cell.Normal.Z;
+      AdjacentCount[c] = (U8)cell.AdjacentCount;
+      for (U8 i = 0; i < cell.AdjacentCount; ++i) Adjacent[IcosCell::MAX_ADJACENT_CELLS * c + i] = cell.AdjacentID[i];
+    }
+
+    // For each corner i of a cell: the normal of the plane through the
+    // center, the cell and adjacent cell i, and the normal of the plane
+    // through the center, adjacent cells i and i+1.
+    if (IcosRasterExport::SAMPLING_BARYCENTRIC == Sampling)
+    {
+      SpokeNormal.resize(3u * IcosCell::MAX_ADJACENT_CELLS * cellCount);
+      RimNormal.resize(3u * IcosCell::MAX_ADJACENT_CELLS * cellCount);
+      IsClockwise.resize(cellCount);
+
+      for (U16 c = 0; c < cellCount; ++c)
+      {
+        const IcosCell & cell = topology.GetCell(c);
+        const F32 * center = &Position[3u * c];
+
+        for (U8 i = 0; i < cell.AdjacentCount; ++i)
+        {
+          const F32 * a = &Position[3u * cell.AdjacentID[i]];
+          const F32 * b = &Position[3u * cell.AdjacentID[(i + 1u) % cell.AdjacentCount]];
+          Cross(center, a, &SpokeNormal[3u * (IcosCell::MAX_ADJACENT_CELLS * c + i)]);
+          Cross(a, b, &RimNormal[3u * (IcosCell::MAX_ADJACENT_CELLS * c + i)]);
+        }
+
+        IsClockwise[c] = (Dot(&SpokeNormal[3u * IcosCell::MAX_ADJACENT_CELLS * c], &Position[3u * cell.AdjacentID[1]]) < 0.0f);
+      }
+    }
+
+    if (IcosRasterExport::PROJECTION_EQUIRECTANGULAR == Projection)
+    {
+      CosLongitude.resize(width);
+      SinLongitude.resize(width);
+
+      for (U32 x = 0; x < width; ++x)
+      {
+        F64 longitude = M_PI * (2.0 * (x + 0.5) / width - 1.0);
+        CosLongitude[x] = (F32)cos(longitude);
+        SinLongitude[x] = (F32)sin(longitude);
+      }
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Samples one image row into out[]. cell is the cell to start looking
+  //! from, and on return the cell of the last pixel.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  SampleRow(
+      U32 row,
+      F32 out[],
+      U16 & cell
+      ) const throw ()
+  {
+    F32 direction[3];
+
+    if (IcosRasterExport::PROJECTION_EQUIRECTANGULAR == Projection)
+    {
+      F64 latitude = M_PI * (0.5 - (row + 0.5) / Height);
+      F32 cosLatitude = (F32)cos(latitude);
+      direction[1] = (F32)sin(latitude);
+
+      for (U32 x = 0; x < Width; ++x)
+      {
+        direction[0] = cosLatitude * CosLongitude[x];
+        direction[2] = cosLatitude * SinLongitude[x];
+        out[x] = SampleDirection(direction, cell);
+      }
+    }
+    else
+    {
+      U32 face = row / Width;
+      F32 t = 2.0f * ((row % Width) + 0.5f) / Width - 1.0f;
+
+      for (U32 x = 0; x < Width; ++x)
+      {
+        F32 s = 2.0f * (x + 0.5f) / Width - 1.0f;
+
+        switch (face)
+        {
+          case 0u: direction[0] =  1.0f; direction[1] = -t;    direction[2] = -s;    break;
+          case 1u: direction[0] = -1.0f; direction[1] = -t;    direction[2] =  s;    break;
+          case 2u: direction[0] =  s;    direction[1] =  1.0f; direction[2] =  t;    break;
+          case 3u: direction[0] =  s;    direction[1] = -1.0f; direction[2] = -t;    break;
+          case 4u: direction[0] =  s;    direction[1] = -t;    direction[2] =  1.0f; break;
+          default: direction[0] = -s;    direction[1] = -t;    direction[2] = -1.0f; break;
+        }
+
+        // Only the sign of dot products is used, so no need to normalize.
+        out[x] = SampleDirection(direction, cell);
+      }
+    }
+  }
+
+private:
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the cell nearest to direction by walking from cell to whichever
+  //! adjacent cell is nearer until none is.
+  //////////////////////////////////////////////////////////////////////////////
+  U16
+  FindCell(
+      const F32 direction[3],
+      U16 cell
+      ) const throw ()
+  {
+    for (;;)
+    {
+      const U16 * adjacentID = &Adjacent[IcosCell::MAX_ADJACENT_CELLS * cell];
+      U8 count = AdjacentCount[cell];
+      F32 nearest = Dot(&Position[3u * cell], direction);
+      U16 next = cell;
+
+      for (U8 i = 0; i < count; ++i)
+      {
+        U16 adjacent = adjacentID[i];
+        F32 d = Dot(&Position[3u * adjacent], direction);
+        if (nearest < d)
+        {
+          nearest = d;
+          next = adjacent;
+        }
+      }
+
+      if (next == cell) return cell;
+      cell = next;
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the field value in a direction, updating the walk's start cell.
+  //////////////////////////////////////////////////////////////////////////////
+  F32
+  SampleDirection(
+      const F32 direction[3],
+      U16 & cell
+      ) const throw ()
+  {
+    cell = FindCell(direction, cell);
+
+    if (IcosRasterExport::SAMPLING_NEAREST == Sampling)
+    {
+      return Field[cell];
+    }
+
+    // Find the grid triangle around the nearest cell the direction passes
+    // through: the one between the spokes to adjacent cells i and i+1.
+    const U16 * adjacentID = &Adjacent[IcosCell::MAX_ADJACENT_CELLS * cell];
+    U8 count = AdjacentCount[cell];
+    const F32 * spoke = &SpokeNormal[3u * IcosCell::MAX_ADJACENT_CELLS * cell];
+    F32 sign = IsClockwise[cell] ? -1.0f : 1.0f;
+
+    F32 side = sign * Dot(&spoke[0], direction);
+
+    for (U8 i = 0; i < count; ++i)
+    {
+      U8 j = (i + 1u) % count;
+      F32 nextSide = sign * Dot(&spoke[3u * j], direction);
+
+      if ((0.0f <= side) && (nextSide <= 0.0f))
+      {
+        // Weights are the volumes spanned by the direction and two of the
+        // triangle's corners.
+        F32 wCenter = sign * Dot(&RimNormal[3u * (IcosCell::MAX_ADJACENT_CELLS * cell + i)], direction);
+        F32 wA = -nextSide;
+        F32 wB = side;
+        F32 sum = wCenter + wA + wB;
+
+        if (0.0f < sum)
+        {
+          return (wCenter * Field[cell] + wA * Field[adjacentID[i]] + wB * Field[adjacentID[j]]) / sum;
+        }
+      }
+
+      side = nextSide;
+    }
+
+    return Field[cell];
+  }
+
+  const F32 * Field;
+  U8 Projection;
+  U8 Sampling;
+  U32 Width;
+  U32 Height;
+  //! Unit position of each cell.
+  std::vector<F32> Position;
+  std::vector<U16> Adjacent;
+  std::vector<U8> AdjacentCount;
+  std::vector<F32> SpokeNormal;
+  std::vector<F32> RimNormal;
+  std::vector<bool> IsClockwise;
+  std::vector<F32> CosLongitude;
+  std::vector<F32> SinLongitude;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//! State shared by the worker threads and the writing thread of one call to
+//! Sample() or Write(). Bands are numbered in file order.
+////////////////////////////////////////////////////////////////////////////////
+struct IcosRasterExport::Job
+{
+  const Sampler * Source;
+  U8 Format;
+  U32 Width;
+  U32 Height;
+  U32 BandCount;
+  F32 Minimum;
+  F32 Scale;
+  //! Destination of Sample(), or nullptr when writing a file.
+  F32 * Image;
+  //! Index of the next band to be claimed by a worker.
+  std::atomic<U32> NextBand;
+  //! Bands a worker may encode beyond the last written one.
+  U32 MaxBandsInFlight;
+  //! Guards Encoded, Adler, IsEncoded and WrittenBandCount.
+  std::mutex Lock;
+  //! Signalled whenever a band has been encoded.
+  std::condition_variable BandEncoded;
+  //! Signalled whenever a band has been written.
+  std::condition_variable BandWritten;
+  U32 WrittenBandCount;
+  std::vector< std::vector<U8> > Encoded;
+  //! Adler-32 of the PNG scanline bytes of each band.
+  std::vector<U32> Adler;
+  std::vector<bool> IsEncoded;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns a value mapped onto a 16-bit sample.
+////////////////////////////////////////////////////////////////////////////////
+static inline U32 Quantize(F32 value, F32 minimum, F32 scale) throw ()
+{
+  F32 q = (value - minimum) * scale + 0.5f;
+  if (! (0.0f < q)) return 0u;
+  if (65535.0f < q) return 65535u;
+  return (U32)q;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the PNG Paeth predictor of a byte from its left, upper and upper
+//! left neighbors.
+////////////////////////////////////////////////////////////////////////////////
+static inline U8 Paeth(U8 a, U8 b, U8 c) throw ()
+{
+  S32 p = (S32)a + b - c;
+  S32 pa = abs(p - a);
+  S32 pb = abs(p - b);
+  S32 pc = abs(p - c);
+
+  return ((pa <= pb) && (pa <= pc)) ? a : (pb <= pc) ? b : c;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Claims bands until none are left, samples each and encodes it. A worker
+//! writing a file stays at most MaxBandsInFlight bands ahead of the writer,
+//! which bounds the memory held by encoded bands whatever the image size.
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosRasterExport::Work(
+    Job * job
+    ) throw ()
+{
+  std::vector<F32> row(job->Width);
+  std::vector<U8> raw;
+  std::vector<U8> encoded;
+  std::vector<U8> sample[2];
+  Deflater deflater;
+  U16 cell = 0u;
+
+  for (U32 b = job->NextBand++; b < job->BandCount; b = job->NextBand++)
+  {
+    U32 firstRow = b * BAND_ROW_COUNT;
+    U32 rowCount = job->Height - firstRow;
+    if (BAND_ROW_COUNT < rowCount) rowCount = BAND_ROW_COUNT;
+
+    if (nullptr != job->Image)
+    {
+      for (U32 r = firstRow; r < firstRow + rowCount; ++r)
+      {
+        job->Source->SampleRow(r, &job->Image[(U64)r * job->Width], cell);
+      }
+      continue;
+    }
+
+    {
+      std::unique_lock<std::mutex> lock(job->Lock);
+      while (job->WrittenBandCount + job->MaxBandsInFlight <= b) job->BandWritten.wait(lock);
+    }
+
+    // Bytes of one encoded row; PNG rows start with their filter type.
+    U32 rowBytes = (FORMAT_PFM == job->Format) ? job->Width * sizeof(F32)
+        : (FORMAT_PGM == job->Format) ? 2u * job->Width
+        : 1u + 2u * job->Width;
+    std::vector<U8> & rows = (FORMAT_PNG == job->Format) ? raw : encoded;
+    rows.resize(rowCount * rowBytes);
+
+    for (U32 r = 0; r < rowCount; ++r)
+    {
+      // PFM stores the bottom row first.
+      U32 imageRow = (FORMAT_PFM == job->Format) ? job->Height - 1u - (firstRow + r) : firstRow + r;
+      U8 * out = &rows[r * rowBytes];
+
+      if (FORMAT_PFM == job->Format)
+      {
+        job->Source->SampleRow(imageRow, (F32 *)out, cell);
+        continue;
+      }
+
+      job->Source->SampleRow(imageRow, &row[0], cell);
+
+      U8 * big = out;
+
+      if (FORMAT_PNG == job->Format)
+      {
+        sample[r & 1u].resize(2u * job->Width);
+        big = &sample[r & 1u][0];
+      }
+
+      for (U32 x = 0; x < job->Width; ++x)
+      {
+        U32 value = Quantize(row[x], job->Minimum, job->Scale);
+        big[2u * x] = (U8)(value >> 8);
+        big[2u * x + 1u] = (U8)value;
+      }
+
+      if (FORMAT_PNG != job->Format)
+      {
+        continue;
+      }
+
+      // Each band is compressed on its own, so its first row is filtered
+      // with Sub and the others with Paeth, two bytes to a sample.
+      const U8 * above = (0u < r) ? &sample[(r - 1u) & 1u][0] : nullptr;
+      *out++ = (nullptr != above) ? 4u : 1u;
+
+      for (U32 x = 0; x < 2u * job->Width; ++x)
+      {
+        U8 left = (2u <= x) ? big[x - 2u] : 0u;
+
+        if (nullptr == above)
+        {
+          *out++ = (U8)(big[x] - left);
+        }
+        else
+        {
+          U8 upperLeft = (2u <= x) ? above[x - 2u] : 0u;
+          *out++ = (U8)(big[x] - Paeth(left, above[x], upperLeft));
+        }
+      }
+    }
+
+    U32 adler = 1u;
+
+    if (FORMAT_PNG == job->Format)
+    {
+      // Compress the scanlines into one IDAT chunk. The last band ends the
+      // deflate stream.
+      std::vector<U8> data;
+      deflater.Compress(&raw[0], (U32)raw.size(), b + 1u == job->BandCount, data);
+
+      encoded.clear();
+      AppendPngChunk(encoded, "IDAT", &data[0], (U32)data.size());
+      adler = GetAdler(&raw[0], raw.size());
+    }
+
+    std::lock_guard<std::mutex> lock(job->Lock);
+    job->Encoded[b].swap(encoded);
+    job->Adler[b] = adler;
+    job->IsEncoded[b] = true;
+    job->BandEncoded.notify_all();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosRasterExport.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosRasterExport::GetImageSize(
+    const Options & options,
+    U32 & width,
+    U32 & height
+    ) throw (Exception::Type)
+{
+  if ((options.Width < 2u) || (MAX_WIDTH < options.Width)
+      || (PROJECTION_CUBE < options.Projection)
+      || (SAMPLING_BARYCENTRIC < options.Sampling)
+      || (FORMAT_PNG < options.Format))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  width = options.Width;
+  height = (PROJECTION_CUBE == options.Projection) ? 6u * options.Width : options.Width / 2u;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Resolves the thread count of options for a job of bandCount bands.
+////////////////////////////////////////////////////////////////////////////////
+static
+U32
+GetThreadCount(
+    const IcosRasterExport::Options & options,
+    U32 bandCount
+    ) throw ()
+{
+  U32 threadCount = options.ThreadCount;
+
+  if (0u == threadCount)
+  {
+    threadCount = std::thread::hardware_concurrency();
+    if (0u == threadCount) threadCount = 1u;
+  }
+
+  return (bandCount < threadCount) ? bandCount : threadCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosRasterExport.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosRasterExport::Sample(
+    const IcosTopology & topology,
+    const F32 field[],
+    const Options & options,
+    F32 image[]
+    ) throw (Exception::Type)
+{
+  U32 width;
+  U32 height;
+  GetImageSize(options, width, height);
+
+  if (! ((nullptr != field) && (nullptr != image)))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  Sampler sampler(topology, field, options, width, height);
+
+  Job job;
+  job.Source = &sampler;
+  job.Format = options.Format;
+  job.Width = width;
+  job.Height = height;
+  job.BandCount = (height + BAND_ROW_COUNT - 1u) / BAND_ROW_COUNT;
+  job.Image = image;
+  job.NextBand = 0u;
+
+  U32 threadCount = GetThreadCount(options, job.BandCount);
+
+  // The calling thread is the last worker.
+  std::vector<std::thread> worker;
+  for (U32 i = 1; i < threadCount; ++i)
+  {
+    worker.push_back(std::thread(Work, &job));
+  }
+
+  Work(&job);
+
+  for (U32 i = 0; i < worker.size(); ++i)
+  {
+    worker[i].join();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosRasterExport.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosRasterExport::Write(
+    const IcosTopology & topology,
+    const F32 field[],
+    const char * path,
+    const Options & options,
+    Statistics * statistics
+    ) throw (Exception::Type)
+{
+  U32 width;
+  U32 height;
+  GetImageSize(options, width, height);
+
+  if (! ((nullptr != field) && (nullptr != path)))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  Clock::time_point start = Clock::now();
+
+  F32 minimum = options.Minimum;
+  F32 maximum = options.Maximum;
+
+  if (! (minimum < maximum))
+  {
+    minimum = maximum = field[0];
+    for (U16 c = 1; c < topology.GetCellCount(); ++c)
+    {
+      if (field[c] < minimum) minimum = field[c];
+      if (maximum < field[c]) maximum = field[c];
+    }
+  }
+
+  Sampler sampler(topology, field, options, width, height);
+
+  Job job;
+  job.Source = &sampler;
+  job.Format = options.Format;
+  job.Width = width;
+  job.Height = height;
+  job.BandCount = (height + BAND_ROW_COUNT - 1u) / BAND_ROW_COUNT;
+  job.Minimum = minimum;
+  job.Scale = (minimum < maximum) ? 65535.0f / (maximum - minimum) : 0.0f;
+  job.Image = nullptr;
+  job.NextBand = 0u;
+  job.WrittenBandCount = 0u;
+  job.Encoded.resize(job.BandCount);
+  job.Adler.resize(job.BandCount);
+  job.IsEncoded.resize(job.BandCount, false);
+
+  std::vector<U8> prologue;
+  char text[64];
+
+  switch (options.Format)
+  {
+    case FORMAT_PFM:
+    {
+      // A negative scale marks little endian samples.
+      const U32 byteOrderMark = 1u;
+      bool isLittleEndian = (*(const U8 *)&byteOrderMark == 1u);
+      int length = snprintf(text, sizeof(text), "Pf\n%u %u\n%s\n", width, height, isLittleEndian ? "-1.0" : "1.0");
+      prologue.insert(prologue.end(), text, text + length);
+      break;
+    }
+
+    case FORMAT_PGM:
+    {
+      int length = snprintf(text, sizeof(text), "P5\n%u %u\n65535\n", width, height);
+      prologue.insert(prologue.end(), text, text + length);
+      break;
+    }
+
+    case FORMAT_PNG:
+    {
+      // 16-bit greyscale, then the zlib header of the deflate stream that
+      // the band IDAT chunks continue.
+      std::vector<U8> header;
+      AppendBig32(header, width);
+      AppendBig32(header, height);
+      header.push_back(16u);
+      header.push_back(0u);
+      header.push_back(0u);
+      header.push_back(0u);
+      header.push_back(0u);
+
+      static const U8 ZLIB_HEADER[2] = { 0x78u, 0x01u };
+
+      prologue.insert(prologue.end(), PNG_SIGNATURE, PNG_SIGNATURE + sizeof(PNG_SIGNATURE));
+      AppendPngChunk(prologue, "IHDR", &header[0], (U32)header.size());
+      AppendPngChunk(prologue, "IDAT", ZLIB_HEADER, sizeof(ZLIB_HEADER));
+      break;
+    }
+  }
+
+  U32 threadCount = GetThreadCount(options, job.BandCount);
+  job.MaxBandsInFlight = BANDS_IN_FLIGHT_PER_THREAD * threadCount;
+
+  FILE * file = fopen(path, "wb");
+  if (file == nullptr)
+  {
+    throw (Exception::IO_ERROR);
+  }
+
+  std::vector<std::thread> worker;
+  for (U32 i = 0; i < threadCount; ++i)
+  {
+    worker.push_back(std::thread(Work, &job));
+  }
+
+  // Write the bands in file order as they are encoded, releasing each once
+  // written.
+  bool isWritten = (fwrite(&prologue[0], 1, prologue.size(), file) == prologue.size());
+  U64 fileBytes = prologue.size();
+  U32 adler = 1u;
+
+  for (U32 b = 0; isWritten && (b < job.BandCount); ++b)
+  {
+    std::vector<U8> encoded;
+    {
+      std::unique_lock<std::mutex> lock(job.Lock);
+      while (! job.IsEncoded[b]) job.BandEncoded.wait(lock);
+      encoded.swap(job.Encoded[b]);
+    }
+
+    isWritten = (fwrite(&encoded[0], 1, encoded.size(), file) == encoded.size());
+    fileBytes += encoded.size();
+
+    {
+      std::lock_guard<std::mutex> lock(job.Lock);
+      job.WrittenBandCount = b + 1u;
+      job.BandWritten.notify_all();
+    }
+
+    if (FORMAT_PNG == options.Format)
+    {
+      U32 rowCount = height - b * BAND_ROW_COUNT;
+      if (BAND_ROW_COUNT < rowCount) rowCount = BAND_ROW_COUNT;
+      adler = CombineAdler(adler, job.Adler[b], (U64)rowCount * (1u + 2u * width));
+    }
+  }
+
+  // Stop the workers early if writing failed.
+  job.NextBand = job.BandCount;
+
+  {
+    std::lock_guard<std::mutex> lock(job.Lock);
+    job.WrittenBandCount = job.BandCount;
+    job.BandWritten.notify_all();
+  }
+
+  for (U32 i = 0; i < worker.size(); ++i)
+  {
+    worker[i].join();
+  }
+
+  if (isWritten && (FORMAT_PNG == options.Format))
+  {
+    std::vector<U8> epilogue;
+    std::vector<U8> checksum;
+    AppendBig32(checksum, adler);
+    AppendPngChunk(epilogue, "IDAT", &checksum[0], (U32)checksum.size());
+    AppendPngChunk(epilogue, "IEND", nullptr, 0u);
+
+    isWritten = (fwrite(&epilogue[0], 1, epilogue.size(), file) == epilogue.size());
+    fileBytes += epilogue.size();
+  }
+
+  if ((fclose(file) != 0) || ! isWritten)
+  {
+    remove(path);
+    throw (Exception::IO_ERROR);
+  }
+
+  if (nullptr != statistics)
+  {
+    statistics->ThreadCount = threadCount;
+    statistics->Width = width;
+    statistics->Height = height;
+    statistics->FileBytes = fileBytes;
+    statistics->ElapsedSeconds = std::chrono::duration<F64>(Clock::now() - start).count();
+  }
+}
+
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
@@ -0,0 +1,151 @@
+#pragma once
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ *
+ * ****************************************************************************/
+
+
+#include "Exception.h"
+#include "IcosTopology.h"
+#include "NativeTypes.h"
+
+////////////////////////////////////////////////////////////////////////////////
+//! Renders a per cell field of a map into a 2D image without a GPU.
+//!
+//! The sphere is sampled either on an equirectangular grid, Width x Width/2
+//! pixels with latitude 90 at the top row and longitude -180 at the left
+//! column, or as a cube map of six Width x Width faces stacked top to bottom
+//! in the order +X, -X, +Y, -Y, +Z, -Z with the OpenGL face orientations.
+//!
+//! A pixel takes the value of the nearest cell, or the barycentric blend of
+//! the three cells of the grid triangle its direction passes through. Finding
+//! the cell is a walk from the cell of the previous pixel, so a pixel costs a
+//! handful of dot products whatever the map size.
+//!
+//! Images are written as PFM (32-bit float), PGM or PNG (both 16-bit grey,
+//! the value range mapped onto 0 to 65535). The PNG encoder is built in: rows
+//! are Paeth filtered and compressed with deflate, each band on its own. Rows
+//! are sampled and encoded in bands by worker threads while the calling
+//! thread writes the bands in order, the workers staying at most
+//! BANDS_IN_FLIGHT_PER_THREAD bands each ahead of it.
+////////////////////////////////////////////////////////////////////////////////
+class IcosRasterExport
+{
+public:
+
+  static const U8 PROJECTION_EQUIRECTANGULAR = 0u;
+  static const U8 PROJECTION_CUBE = 1u;
+
+  static const U8 SAMPLING_NEAREST = 0u;
+  static const U8 SAMPLING_BARYCENTRIC = 1u;
+
+  static const U8 FORMAT_PFM = 0u;
+  static const U8 FORMAT_PGM = 1u;
+  static const U8 FORMAT_PNG = 2u;
+
+  static const U32 MAX_WIDTH = 32768u;
+  static const U32 BAND_ROW_COUNT = 16u;
+  static const U32 BANDS_IN_FLIGHT_PER_THREAD = 4u;
+
+  struct Options
+  {
+    U8 Projection;
+    U8 Sampling;
+    U8 Format;
+    //! Width of the image, or of one cube face.
+    U32 Width;
+    //! Values mapped to 0 and 65535 by the 16-bit formats. If Minimum is not
+    //! less than Maximum the range of the field is used.
+    F32 Minimum;
+    F32 Maximum;
+    //! Worker threads; zero uses one per core.
+    U32 ThreadCount;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Size and timing of the last call to Write().
+  //////////////////////////////////////////////////////////////////////////////
+  struct Statistics
+  {
+    U32 ThreadCount;
+    U32 Width;
+    U32 Height;
+    U64 FileBytes;
+    F64 ElapsedSeconds;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the width and height of the image the options describe.
+  //////////////////////////////////////////////////////////////////////////////
+  static
+  void
+  GetImageSize(
+      const Options & options,
+      U32 & width,
+      U32 & height
+      ) throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Samples field[], one value per cell of topology, into image[], which must
+  //! hold width x height values as returned by GetImageSize(), top row first.
+  //! Format, Minimum and Maximum are ignored.
+  //////////////////////////////////////////////////////////////////////////////
+  static
+  void
+  Sample(
+      const IcosTopology & topology,
+      const F32 field[],
+      const Options & options,
+      F32 image[]
+      ) throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Samples field[], one value per cell of topology, and writes the image to
+  //! path.
+  //////////////////////////////////////////////////////////////////////////////
+  static
+  void
+  Write(
+      const IcosTopology & topology,
+      const F32 field[],
+      const char * path,
+      const Options & options,
+      Statistics * statistics = nullptr
+      ) throw (Exception::Type);
+
+private:
+
+  struct Job;
+
+  static
+  void
+  Work(
+      Job * job
+      ) throw ();
+};
+
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
@@ -0,0 +1,631 @@
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ *
+ * ****************************************************************************/
+
+
+#include <atomic>
+#include <ctype.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "IcosRasterImport.h"
+
+//! Radius of the disc with the area of a hexagonal cell, in units of the
+//! distance between adjacent cell centers: sqrt(sqrt(3) / (2 pi)).
+static const F64 AREA_RADIUS = 0.5250375;
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns true if this machine stores the low byte of a value first.
+////////////////////////////////////////////////////////////////////////////////
+static inline bool IsLittleEndian() throw ()
+{
+  const U32 byteOrderMark = 1u;
+  return (*(const U8 *)&byteOrderMark == 1u);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Reverses the bytes of count 32-bit values.
+////////////////////////////////////////////////////////////////////////////////
+static void SwapBytes(U8 bytes[], U64 count) throw ()
+{
+  for (U64 i = 0; i < count; ++i, bytes += 4)
+  {
+    U8 t0 = bytes[0];
+    U8 t1 = bytes[1];
+    bytes[0] = bytes[3];
+    bytes[1] = bytes[2];
+    bytes[2] = t1;
+    bytes[3] = t0;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Reads a whole file.
+////////////////////////////////////////////////////////////////////////////////
+static
+void
+ReadFile(
+    const char * path,
+    std::vector<U8> & bytes
+    ) throw (Exception::Type)
+{
+  FILE * file = fopen(path, "rb");
+  if (file == nullptr)
+  {
+    throw (Exception::IO_ERROR);
+  }
+
+  long length = -1;
+  if (fseek(file, 0, SEEK_END) == 0) length = ftell(file);
+
+  bool isRead = (0 <= length) && (fseek(file, 0, SEEK_SET) == 0);
+  if (isRead)
+  {
+    bytes.resize((size_t)length);
+    isRead = (0 == length) || (fread(&bytes[0], 1, bytes.size(), file) == bytes.size());
+  }
+
+  fclose(file);
+
+  if (! isRead)
+  {
+    throw (Exception::IO_ERROR);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Reads the next whitespace separated token of a PFM or PGM header, skipping
+//! comments. Throws FORMAT_ERROR at the end of the file.
+////////////////////////////////////////////////////////////////////////////////
+static
+std::string
+ReadToken(
+    const std::vector<U8> & bytes,
+    size_t & offset
+    ) throw (Exception::Type)
+{
+  for (;;)
+  {
+    while ((offset < bytes.size()) && isspace(bytes[offset])) ++offset;
+    if ((offset < bytes.size()) && ('#' == bytes[offset]))
+    {
+      while ((offset < bytes.size()) && ('\n' != bytes[offset])) ++offset;
+      continue;
+    }
+    break;
+  }
+
+  size_t start = offset;
+  while ((offset < bytes.size()) && ! isspace(bytes[offset])) ++offset;
+
+  if ((start == offset) || (bytes.size() <= offset))
+  {
+    throw (Exception::FORMAT_ERROR);
+  }
+
+  return std::string((const char *)&bytes[start], offset - start);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Parses a raster dimension.
+////////////////////////////////////////////////////////////////////////////////
+static
+U32
+ParseSize(
+    const std::string & token
+    ) throw (Exception::Type)
+{
+  char * end;
+  unsigned long value = strtoul(token.c_str(), &end, 10);
+
+  if ((*end != '\0') || (value < 1u) || (IcosRasterImport::MAX_WIDTH < value))
+  {
+    throw (Exception::FORMAT_ERROR);
+  }
+
+  return (U32)value;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Converts the samples of a PFM file, bottom row first, into raster[].
+////////////////////////////////////////////////////////////////////////////////
+static
+void
+ConvertPfm(
+    std::vector<U8> & bytes,
+    size_t offset,
+    bool isColor,
+    bool isLittleEndian,
+    U32 width,
+    U32 height,
+    F32 raster[]
+    ) throw (Exception::Type)
+{
+  U32 channelCount = isColor ? 3u : 1u;
+  U64 valueCount = (U64)width * height * channelCount;
+
+  if (bytes.size() - offset < valueCount * sizeof(F32))
+  {
+    throw (Exception::FORMAT_ERROR);
+  }
+
+  U8 * data = &bytes[offset];
+  if (isLittleEndian != IsLittleEndian()) SwapBytes(data, valueCount);
+
+  for (U32 y = 0; y < height; ++y)
+  {
+    const U8 * row = data + (U64)(height - 1u - y) * width * channelCount * sizeof(F32);
+
+    for (U32 x = 0; x < width; ++x)
+    {
+      F32 value[3];
+      memcpy(value, row + (U64)x * channelCount * sizeof(F32), channelCount * sizeof(F32));
+      raster[(U64)y * width + x] = isColor ? (value[0] + value[1] + value[2]) / 3.0f : value[0];
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Reads the width, height and byte order of a raw raster from its sidecar.
+////////////////////////////////////////////////////////////////////////////////
+static
+void
+ReadSidecar(
+    const char * path,
+    U32 & width,
+    U32 & height,
+    bool & isLittleEndian
+    ) throw (Exception::Type)
+{
+  std::vector<U8> bytes;
+  ReadFile((std::string(path) + ".hdr").c_str(), bytes);
+  bytes.push_back('\0');
+
+  width = 0u;
+  height = 0u;
+  isLittleEndian = true;
+
+  for (const char * line = (const char *)&bytes[0]; *line != '\0'; )
+  {
+    char key[16];
+    char value[32];
+
+    if (sscanf(line, "%15s %31s", key, value) == 2)
+    {
+      if (strcmp(key, "width") == 0) width = ParseSize(value);
+      else if (strcmp(key, "height") == 0) height = ParseSize(value);
+      else if (strcmp(key, "byteorder") == 0)
+      {
+        if (strcmp(value, "little") == 0) isLittleEndian = true;
+        else if (strcmp(value, "big") == 0) isLittleEndian = false;
+        else throw (Exception::FORMAT_ERROR);
+      }
+    }
+
+    const char * next = strchr(line, '\n');
+    line = (next != nullptr) ? next + 1 : line + strlen(line);
+  }
+
+  if ((0u == width) || (0u == height))
+  {
+    throw (Exception::FORMAT_ERROR);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosRasterImport.h)
+////////////////////////////////////////////////////////////////////////////////
+F32 *
+IcosRasterImport::Read(
+    const char * path,
+    U32 & width,
+    U32 & height
+    ) throw (Exception::Type)
+{
+  if (nullptr == path)
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  std::vector<U8> bytes;
+  ReadFile(path, bytes);
+
+  bool isPfm = (2u <= bytes.size()) && ('P' == bytes[0]) && (('f' == bytes[1]) || ('F' == bytes[1]));
+  bool isPgm = (2u <= bytes.size()) && ('P' == bytes[0]) && ('5' == bytes[1]);
+  size_t offset = 2u;
+
+  if (isPfm || isPgm)
+  {
+    width = ParseSize(ReadToken(bytes, offset));
+    height = ParseSize(ReadToken(bytes, offset));
+  }
+  else
+  {
+    bool isLittleEndian;
+    ReadSidecar(path, width, height, isLittleEndian);
+
+    U64 valueCount = (U64)width * height;
+    if (bytes.size() != valueCount * sizeof(F32))
+    {
+      throw (Exception::FORMAT_ERROR);
+    }
+
+    if (isLittleEndian != IsLittleEndian()) SwapBytes(&bytes[0], valueCount);
+
+    F32 * raster = new F32[valueCount];
+    memcpy(raster, &bytes[0], bytes.size());
+    return raster;
+  }
+
+  F32 * raster = new F32[(U64)width * height];
+
+  try
+  {
+    if (isPfm)
+    {
+      F64 scale = strtod(ReadToken(bytes, offset).c_str(), nullptr);
+      if (0.0 == scale) throw (Exception::FORMAT_ERROR);
+
+      // One whitespace character separates the header from the samples.
+      ConvertPfm(bytes, offset + 1u, 'F' == bytes[1], scale < 0.0, width, height, raster);
+    }
+    else
+    {
+      U32 maxValue = ParseSize(ReadToken(bytes, offset));
+      U32 sampleBytes = (maxValue < 256u) ? 1u : 2u;
+      U64 valueCount = (U64)width * height;
+      offset += 1u;
+
+      if ((65535u < maxValue) || (bytes.size() - offset < valueCount * sampleBytes))
+      {
+        throw (Exception::FORMAT_ERROR);
+      }
+
+      const U8 * data = &bytes[offset];
+      F32 scale = 1.0f / maxValue;
+
+      // 16-bit samples are big endian.
+      for (U64 i = 0; i < valueCount; ++i)
+      {
+        U32 sample = (1u == sampleBytes) ? data[i] : (((U32)data[2u * i] << 8) | data[2u * i + 1u]);
+        raster[i] = sample * scale;
+      }
+    }
+  }
+  catch (Exception::Type error)
+  {
+    delete [] raster;
+    throw (error);
+  }
+
+  return raster;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! State shared by the worker threads of one call to Sample().
+////////////////////////////////////////////////////////////////////////////////
+struct IcosRasterImport::Job
+{
+  const IcosTopology * Topology;
+  const F32 * Raster;
+  U32 Width;
+  U32 Height;
+  U8 Filter;
+  F32 * Field;
+  U32 BatchCount;
+  //! Index of the next batch to be claimed by a worker.
+  std::atomic<U32> NextBatch;
+  //! Sine and cosine of the latitude of each row and longitude of each column
+  //! of pixel centers, for area sampling.
+  std::vector<F32> SinLatitude;
+  std::vector<F32> CosLatitude;
+  std::vector<F32> SinLongitude;
+  std::vector<F32> CosLongitude;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the raster bilinearly interpolated at pixel coordinates (u,v),
+//! wrapping in longitude and clamping in latitude.
+////////////////////////////////////////////////////////////////////////////////
+static
+F32
+SampleBilinear(
+    const F32 raster[],
+    U32 width,
+    U32 height,
+    F32 u,
+    F32 v
+    ) throw ()
+{
+  F32 x = floorf(u);
+  F32 y = floorf(v);
+  F32 fx = u - x;
+  F32 fy = v - y;
+
+  S64 x0 = (S64)x % (S64)width;
+  if (x0 < 0) x0 += width;
+  S64 x1 = (x0 + 1 == (S64)width) ? 0 : x0 + 1;
+
+  S64 y0 = (S64)y;
+  S64 y1 = y0 + 1;
+  if (y0 < 0) y0 = 0;
+  if ((S64)height <= y0) y0 = height - 1u;
+  if (y1 < 0) y1 = 0;
+  if ((S64)height <= y1) y1 = height - 1u;
+
+  const F32 * row0 = &raster[(U64)y0 * width];
+  const F32 * row1 = &raster[(U64)y1 * width];
+
+  F32 top = row0[x0] + (row0[x1] - row0[x0]) * fx;
+  F32 bottom = row1[x0] + (row1[x1] - row1[x0]) * fx;
+
+  return top + (bottom - top) * fy;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the area weighted mean of the pixels whose centers lie within the
+//! equal area disc of a cell, or the bilinear sample if there are none.
+////////////////////////////////////////////////////////////////////////////////
+F32
+IcosRasterImport::SampleArea(
+    const Job & job,
+    U16 cellID,
+    F32 u,
+    F32 v
+    ) throw ()
+{
+  const IcosCell & cell = job.Topology->GetCell(cellID);
+  const Vector & center = cell.Normal;
+
+  F64 spacing = 0.0;
+  for (U8 i = 0; i < cell.AdjacentCount; ++i)
+  {
+    F64 d = center * job.Topology->GetCell(cell.AdjacentID[i]).Normal;
+    spacing += acos((d < 1.0) ? d : 1.0);
+  }
+
+  F64 radius = AREA_RADIUS * spacing / cell.AdjacentCount;
+  F32 cosRadius = (F32)cos(radius);
+
+  F64 latitude = cell.Coordinates.Latitude * (M_PI / 180.0);
+  F64 pixelsPerRadian = job.Height / M_PI;
+
+  S64 firstRow = (S64)ceil(v - radius * pixelsPerRadian);
+  S64 lastRow = (S64)floor(v + radius * pixelsPerRadian);
+  if (firstRow < 0) firstRow = 0;
+  if ((S64)job.Height <= lastRow) lastRow = job.Height - 1u;
+
+  // Half width in longitude of the disc, or all of it around a pole.
+  S64 firstColumn = 0;
+  S64 lastColumn = (S64)job.Width - 1;
+
+  if (M_PI / 2.0 > fabs(latitude) + radius)
+  {
+    F64 halfWidth = asin(sin(radius) / cos(latitude)) * (job.Width / (2.0 * M_PI));
+    firstColumn = (S64)ceil(u - halfWidth);
+    lastColumn = (S64)floor(u + halfWidth);
+  }
+
+  F64 sum = 0.0;
+  F64 weight = 0.0;
+
+  for (S64 y = firstRow; y <= lastRow; ++y)
+  {
+    F32 sinLatitude = job.SinLatitude[y];
+    F32 cosLatitude = job.CosLatitude[y];
+    const F32 * row = &job.Raster[(U64)y * job.Width];
+    F64 rowSum = 0.0;
+    U32 rowCount = 0u;
+
+    for (S64 column = firstColumn; column <= lastColumn; ++column)
+    {
+      S64 x = column % (S64)job.Width;
+      if (x < 0) x += job.Width;
+
+      F32 d = center.X * cosLatitude * job.CosLongitude[x]
+          + center.Y * sinLatitude
+          + center.Z * cosLatitude * job.SinLongitude[x];
+
+      if (cosRadius <= d)
+      {
+        rowSum += row[x];
+        ++rowCount;
+      }
+    }
+
+    // Pixels of a row cover equal areas, proportional to the cosine of its
+    // latitude.
+    sum += rowSum * cosLatitude;
+    weight += rowCount * cosLatitude;
+  }
+
+  if (! (0.0 < weight))
+  {
+    return SampleBilinear(job.Raster, job.Width, job.Height, u, v);
+  }
+
+  return (F32)(sum / weight);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Claims batches of cells until none are left and samples each.
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosRasterImport::Work(
+    Job * job
+    ) throw ()
+{
+  U32 cellCount = job->Topology->GetCellCount();
+  F32 uScale = job->Width / 360.0f;
+  F32 vScale = job->Height / 180.0f;
+
+  F32 latitude[BATCH_CELL_COUNT];
+  F32 longitude[BATCH_CELL_COUNT];
+  F32 u[BATCH_CELL_COUNT];
+  F32 v[BATCH_CELL_COUNT];
+
+  for (U32 b = job->NextBatch++; b < job->BatchCount; b = job->NextBatch++)
+  {
+    U32 first = b * BATCH_CELL_COUNT;
+    U32 count = cellCount - first;
+    if (BATCH_CELL_COUNT < count) count = BATCH_CELL_COUNT;
+
+    for (U32 i = 0; i < count; ++i)
+    {
+      const Coordinates::UnitSphereDegrees & coordinates = job->Topology->GetCell(first + i).Coordinates;
+      latitude[i] = coordinates.Latitude;
+      longitude[i] = coordinates.Longitude;
+    }
+
+    // Straight line arithmetic on separate arrays, so it vectorizes.
+    for (U32 i = 0; i < count; ++i)
+    {
+      u[i] = (longitude[i] + 180.0f) * uScale - 0.5f;
+      v[i] = (90.0f - latitude[i]) * vScale - 0.5f;
+    }
+
+    for (U32 i = 0; i < count; ++i)
+    {
+      job->Field[first + i] = (FILTER_AREA == job->Filter)
+          ? SampleArea(*job, (U16)(first + i), u[i], v[i])
+          : SampleBilinear(job->Raster, job->Width, job->Height, u[i], v[i]);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosRasterImport.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosRasterImport::Sample(
+    const IcosTopology & topology,
+    const F32 raster[],
+    U32 width,
+    U32 height,
+    U8 filter,
+    U32 threadCount,
+    F32 field[]
+    ) throw (Exception::Type)
+{
+  if (! ((nullptr != raster) && (nullptr != field)
+      && (0u < width) && (width <= MAX_WIDTH)
+      && (0u < height) && (height <= MAX_WIDTH)
+      && (filter <= FILTER_AREA)))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  Job job;
+  job.Topology = &topology;
+  job.Raster = raster;
+  job.Width = width;
+  job.Height = height;
+  job.Filter = filter;
+  job.Field = field;
+  job.BatchCount = (topology.GetCellCount() + BATCH_CELL_COUNT - 1u) / BATCH_CELL_COUNT;
+  job.NextBatch = 0u;
+
+  if (FILTER_AREA == filter)
+  {
+    job.SinLatitude.resize(height);
+    job.CosLatitude.resize(height);
+    for (U32 y = 0; y < height; ++y)
+    {
+      F64 latitude = M_PI * (0.5 - (y + 0.5) / height);
+      job.SinLatitude[y] = (F32)sin(latitude);
+      job.CosLatitude[y] = (F32)cos(latitude);
+    }
+
+    job.SinLongitude.resize(width);
+    job.CosLongitude.resize(width);
+    for (U32 x = 0; x < width; ++x)
+    {
+      F64 longitude = M_PI * (2.0 * (x + 0.5) / width - 1.0);
+      job.SinLongitude[x] = (F32)sin(longitude);
+      job.CosLongitude[x] = (F32)cos(longitude);
+    }
+  }
+
+  if (0u == threadCount)
+  {
+    threadCount = std::thread::hardware_concurrency();
+    if (0u == threadCount) threadCount = 1u;
+  }
+
+  if (job.BatchCount < threadCount) threadCount = job.BatchCount;
+
+  // The calling thread is the last worker.
+  std::vector<std::thread> worker;
+  for (U32 i = 1; i < threadCount; ++i)
+  {
+    worker.push_back(std::thread(Work, &job));
+  }
+
+  Work(&job);
+
+  for (U32 i = 0; i < worker.size(); ++i)
+  {
+    worker[i].join();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosRasterImport.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosRasterImport::Import(
+    const IcosTopology & topology,
+    const char * path,
+    U8 filter,
+    U32 threadCount,
+    F32 field[]
+    ) throw (Exception::Type)
+{
+  U32 width;
+  U32 height;
+  F32 * raster = Read(path, width, height);
+
+  try
+  {
+    Sample(topology, raster, width, height, filter, threadCount, field);
+  }
+  catch (Exception::Type error)
+  {
+    delete [] raster;
+    throw (error);
+  }
+
+  delete [] raster;
+}
+
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
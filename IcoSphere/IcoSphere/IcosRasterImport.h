@@ -0,0 +1,127 @@
+#pragma once
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ *
+ * ****************************************************************************/
+
+
+#include "Exception.h"
+#include "IcosTopology.h"
+#include "NativeTypes.h"
+
+////////////////////////////////////////////////////////////////////////////////
+//! Fills a per cell field of a map from an equirectangular raster, such as a
+//! planetary elevation model. The raster covers the whole sphere, latitude 90
+//! along its top edge and longitude -180 along its left edge, the layout
+//! IcosRasterExport writes.
+//!
+//! Rasters are read from
+//!
+//!   PFM      32-bit float, grey ("Pf") or color ("PF", the mean of R, G, B)
+//!   PGM      binary ("P5"), 8 or 16-bit, scaled into [0,1] by its maxval
+//!   raw      32-bit floats, top row first, described by a text sidecar file
+//!            path + ".hdr" holding "width <w>", "height <h>" and optionally
+//!            "byteorder little|big" lines
+//!
+//! Each cell samples the raster at its latitude and longitude, either
+//! bilinearly or as the area weighted mean of the pixels inside a disc of the
+//! cell's area, which is what a raster finer than the grid needs. Cells are
+//! converted to raster coordinates in batches of BATCH_CELL_COUNT laid out for
+//! the compiler's vectorizer, and batches are sampled by worker threads.
+////////////////////////////////////////////////////////////////////////////////
+class IcosRasterImport
+{
+public:
+
+  static const U8 FILTER_BILINEAR = 0u;
+  static const U8 FILTER_AREA = 1u;
+
+  static const U32 MAX_WIDTH = 65536u;
+  static const U32 BATCH_CELL_COUNT = 64u;
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Reads the raster at path into a new array of width x height values, top
+  //! row first, which the caller releases with delete [].
+  //////////////////////////////////////////////////////////////////////////////
+  static
+  F32 *
+  Read(
+      const char * path,
+      U32 & width,
+      U32 & height
+      ) throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Samples raster[], width x height values top row first, at every cell of
+  //! topology into field[]. A threadCount of zero uses one thread per core.
+  //////////////////////////////////////////////////////////////////////////////
+  static
+  void
+  Sample(
+      const IcosTopology & topology,
+      const F32 raster[],
+      U32 width,
+      U32 height,
+      U8 filter,
+      U32 threadCount,
+      F32 field[]
+      ) throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Reads the raster at path and samples it into field[].
+  //////////////////////////////////////////////////////////////////////////////
+  static
+  void
+  Import(
+      const IcosTopology & topology,
+      const char * path,
+      U8 filter,
+      U32 threadCount,
+      F32 field[]
+      ) throw (Exception::Type);
+
+private:
+
+  struct Job;
+
+  static
+  F32
+  SampleArea(
+      const Job & job,
+      U16 cellID,
+      F32 u,
+      F32 v
+      ) throw ();
+
+  static
+  void
+  Work(
+      Job * job
+      ) throw ();
+};
+
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
@@ -0,0 +1,190 @@
+#pragma once
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ *
+ * ****************************************************************************/
+
+
+#include "Coordinates.h"
+#include "Exception.h"
+#include "IcosCell.h"
+#include "NativeTypes.h"
+
+////////////////////////////////////////////////////////////////////////////////
+//! The cells of a map of one size: their types, coordinates, normals and
+//! adjacency, along with the vertex, edge, face and row index tables. A
+//! topology never changes once created and is shared by reference counting,
+//! so any number of maps (worlds) of one size can use a single copy.
+////////////////////////////////////////////////////////////////////////////////
+class IcosTopology
+{
+public:
+
+  static const U8 MIN_SIZE = 1;
+  static const U8 MAX_SIZE = 50;
+  static const U16 MAX_CELL_COUNT = 10u * MAX_SIZE * MAX_SIZE + 2u;
+  static const U16 MAX_ADJACENT_CELLS = 6u;
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the topology of a map of the given size, holding one reference
+  //! for the caller. While IcosTopologyCache is enabled the topology comes from
+  //! the cache; otherwise it is computed.
+  //////////////////////////////////////////////////////////////////////////////
+  static const IcosTopology * Create(U8 size) throw (Exception::Type);
+
+  void AddReference() const throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Drops a reference, destroying the topology with the last one.
+  //////////////////////////////////////////////////////////////////////////////
+  void Release() const throw ();
+
+  U16 GetSize() const throw ();
+
+  U16 GetCellCount() const throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the number of bytes of cell and table data the topology holds.
+  //////////////////////////////////////////////////////////////////////////////
+  U64 GetBytes() const throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the cell ID of the cell with coordinates X and Y. The X
+  //! coordinate is wrapped.
+  //////////////////////////////////////////////////////////////////////////////
+  U16 GetCellID(S16 x, U16 y) const throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns cell (x,y).
+  //////////////////////////////////////////////////////////////////////////////
+  const IcosCell & GetCell(U16 x, U16 y) const throw (Exception::Type);
+
+  U16 GetRowCount() const throw ();
+
+  U16 GetRowCellCount(U16 y) const throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the cell of icosahedron vertex vertexID.
+  //////////////////////////////////////////////////////////////////////////////
+  U16 GetVertexCellID(U16 vertexID) const throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Copies the GetSize() - 1 cells of the edge between two icosahedron
+  //! vertices into cellID[], ordered from vertexID1 towards vertexID2.
+  //////////////////////////////////////////////////////////////////////////////
+  void GetEdgeCellIDs(U16 vertexID1, U16 vertexID2, U16 cellID[]) const throw (Exception::Type);
+
+  inline
+  const IcosCell &
+  GetCell(
+      U16 cellID
+      ) const throw ()
+  {
+    return Cell[cellID];
+  }
+
+private:
+
+  friend class IcosMapFile;
+  friend class IcosTopologyCache;
+
+  typedef void (*ReleaseFunction)(void * image, U64 length);
+
+  IcosTopology();
+  ~IcosTopology();
+
+  IcosTopology(const IcosTopology &);
+  IcosTopology & operator=(const IcosTopology &);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Computes the topology of a map of the given size.
+  //////////////////////////////////////////////////////////////////////////////
+  static IcosTopology * Build(U8 size) throw (Exception::Type);
+
+  void Compute(U8 size) throw (Exception::Type);
+
+  void SetRowCells() throw ();
+
+  void AddVertexCellID(U16 vertexID, U16 cellID) throw ();
+  void AddEdgeCellID(U16 edgeID, U16 cellID) throw ();
+  void AddFaceCellID(U16 faceID, U16 cellID) throw ();
+  void CalculateCellTypeAndTypeID(U16 cellID) throw ();
+  void CalculateLatitudeLongitudeForVertexCells() throw ();
+  void CalculateLatitudeLongitudeForEdgeCells() throw ();
+  void CalculateLatitudeLongitudeForFaceCells() throw ();
+  void CalculateAdjacentCellsForVertexCells() throw ();
+  void CalculateAdjacentCellsForEdgeCells() throw ();
+  void CalculateAdjacentCellsForFaceCells() throw ();
+  void CheckEdgeCellCounts() throw (Exception::Type);
+  void CheckFaceCellCounts() throw (Exception::Type);
+
+  static const U16 VERTEX_COUNT = 12u;
+  static const U16 EDGE_COUNT = 30u;
+  static const U16 FACE_COUNT = 20u;
+
+  static const U16 MAX_ROW_COUNT = 3u * MAX_SIZE + 1u;
+  static const U16 MAX_EDGE_CELL_COUNT = MAX_SIZE - 1u;
+  static const U16 MAX_FACE_CELL_COUNT = ((MAX_SIZE - 2u) * (MAX_SIZE - 1u)) / 2;
+
+  struct Counter;
+
+  //! Number of references held.
+  Counter * ReferenceCount;
+  //! Size of map.
+  U16 Size;
+  //! Total number of cells in map.
+  U16 CellCount;
+  //! Coordinates of each vertex cell.
+  U16 VertexCell[VERTEX_COUNT];
+  //! Expected number of cells in each edge.
+  U16 ExpectedEdgeCellCount;
+  //! Total number of cells in each edge.
+  U16 EdgeCellCount[EDGE_COUNT];
+  //! Coordinates of each edge cell.
+  U16 (*EdgeCell)[MAX_EDGE_CELL_COUNT];
+  //! Expected number of cells in each face.
+  U16 ExpectedFaceCellCount;
+  //! Total number of cells in each face.
+  U16 FaceCellCount[FACE_COUNT];
+  //! Coordinate of each face cell.
+  U16 (*FaceCell)[MAX_FACE_CELL_COUNT];
+  //! Total number of rows.
+  U16 RowCount;
+  //! Total number of cells in a row.
+  U16 RowCellCount[MAX_ROW_COUNT];
+  //! The cells in this map.
+  IcosCell * Cell;
+  //! Pointers to the first cell of each row.
+  IcosCell* RowCell[MAX_ROW_COUNT];
+
+  //! Map file image EdgeCell, FaceCell and Cell point into, and how to let go
+  //! of it. Without an image the arrays are owned.
+  void * Image;
+  U64 ImageLength;
+  ReleaseFunction ReleaseImage;
+};
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
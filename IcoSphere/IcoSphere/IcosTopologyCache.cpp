@@ -0,0 +1,234 @@
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ * Oct 19, 2026 |---| cache IcosTopology objects
+ *
+ * ****************************************************************************/
+
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "IcosMapFile.h"
+#include "IcosTopologyCache.h"
+
+typedef std::map<U8, const IcosTopology *> Registry;
+
+static std::atomic<bool> g_IsEnabled(false);
+static std::mutex g_Lock;
+static std::string g_Directory;
+static Registry g_Registry;
+static IcosTopologyCache::Statistics g_Statistics = IcosTopologyCache::Statistics();
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the path of the topology file of a size in the cache directory.
+////////////////////////////////////////////////////////////////////////////////
+static
+std::string
+GetPath(
+    U8 size
+    )
+{
+  char name[64];
+  snprintf(name, sizeof(name), "/icos_topology_v%u_%u.icm", IcosMapFile::VERSION, (unsigned)size);
+
+  return g_Directory + name;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Writes the file image of a topology to path through a temporary file, so
+//! other processes never see a partial file. Failures are ignored; the file is
+//! only a cache.
+////////////////////////////////////////////////////////////////////////////////
+static
+void
+Publish(
+    const std::string & path,
+    const IcosTopology & topology
+    )
+{
+  std::vector<U8> image(IcosMapFile::GetImageBytes(topology));
+  IcosMapFile::WriteImage(topology, nullptr, &image[0]);
+
+  char suffix[32];
+  snprintf(suffix, sizeof(suffix), ".%ld.tmp", (long)getpid());
+  std::string temporaryPath = path + suffix;
+
+  FILE * file = fopen(temporaryPath.c_str(), "wb");
+  if (file == nullptr) return;
+
+  bool isWritten = (fwrite(&image[0], 1, image.size(), file) == image.size());
+
+  if ((fclose(file) != 0) || ! isWritten || (rename(temporaryPath.c_str(), path.c_str()) != 0))
+  {
+    remove(temporaryPath.c_str());
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosTopologyCache.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosTopologyCache::Enable(
+    const char * directory
+    ) throw (Exception::Type)
+{
+  struct stat status;
+  if ((directory != nullptr) && ((stat(directory, &status) != 0) || ! S_ISDIR(status.st_mode)))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  std::lock_guard<std::mutex> lock(g_Lock);
+
+  g_Directory = (directory != nullptr) ? directory : "";
+  g_IsEnabled.store(true, std::memory_order_release);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosTopologyCache.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+IcosTopologyCache::Disable(
+    ) throw ()
+{
+  std::lock_guard<std::mutex> lock(g_Lock);
+
+  g_IsEnabled.store(false, std::memory_order_release);
+
+  for (Registry::iterator i = g_Registry.begin(); i != g_Registry.end(); ++i)
+  {
+    i->second->Release();
+  }
+
+  g_Registry.clear();
+  g_Statistics.ResidentCount = 0u;
+  g_Statistics.ResidentBytes = 0u;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosTopologyCache.h)
+////////////////////////////////////////////////////////////////////////////////
+bool
+IcosTopologyCache::IsEnabled(
+    ) throw ()
+{
+  // Pairs with the stores in Enable() and Disable().
+  return g_IsEnabled.load(std::memory_order_acquire);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosTopologyCache.h)
+////////////////////////////////////////////////////////////////////////////////
+const IcosTopology *
+IcosTopologyCache::Acquire(
+    U8 size
+    ) throw (Exception::Type)
+{
+  if (size < IcosTopology::MIN_SIZE || IcosTopology::MAX_SIZE < size)
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  std::lock_guard<std::mutex> lock(g_Lock);
+
+  Registry::iterator found = g_Registry.find(size);
+
+  if (found != g_Registry.end())
+  {
+    found->second->AddReference();
+    ++g_Statistics.RegistryHits;
+    return found->second;
+  }
+
+  const IcosTopology * topology = nullptr;
+
+  if (! g_Directory.empty())
+  {
+    U64 length = 0u;
+    void * image = nullptr;
+
+    try
+    {
+      image = IcosMapFile::Map(GetPath(size).c_str(), false, length);
+      topology = IcosMapFile::Attach(image, length, IcosMapFile::Unmap);
+
+      if (topology->GetSize() != size)
+      {
+        // A file renamed by hand; the topology owns the image by now.
+        topology->Release();
+        topology = nullptr;
+      }
+      else
+      {
+        ++g_Statistics.DirectoryHits;
+      }
+    }
+    catch (Exception::Type)
+    {
+      // Missing, stale or foreign file: compute the topology instead.
+      IcosMapFile::Unmap(image, length);
+    }
+  }
+
+  if (topology == nullptr)
+  {
+    topology = IcosTopology::Build(size);
+    ++g_Statistics.Builds;
+
+    if (! g_Directory.empty())
+    {
+      Publish(GetPath(size), *topology);
+    }
+  }
+
+  // One reference for the registry, one for the caller.
+  topology->AddReference();
+  g_Registry[size] = topology;
+  ++g_Statistics.ResidentCount;
+  g_Statistics.ResidentBytes += topology->GetBytes();
+
+  return topology;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See IcosTopologyCache.h)
+////////////////////////////////////////////////////////////////////////////////
+IcosTopologyCache::Statistics
+IcosTopologyCache::GetStatistics(
+    ) throw ()
+{
+  std::lock_guard<std::mutex> lock(g_Lock);
+
+  return g_Statistics;
+}
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
@@ -0,0 +1,90 @@
+#pragma once
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ * Oct 19, 2026 |---| cache IcosTopology objects
+ *
+ * ****************************************************************************/
+
+
+#include "Exception.h"
+#include "IcosTopology.h"
+#include "NativeTypes.h"
+
+////////////////////////////////////////////////////////////////////////////////
+//! Cache of map topology keyed by map size and IcosMapFile::VERSION.
+//!
+//! While enabled, IcosTopology::Create() and so IcosMap::Initialize() hand out
+//! the topology held in an in-process registry, so every map of one size
+//! shares one read-only copy. The first request for a size fills the registry
+//! by mapping the size's file from the cache directory, or, when there is none
+//! yet, by computing the topology and writing the file for later processes.
+//! Without a directory the topology is computed once per process.
+//!
+//! The registry holds a reference to each topology until the cache is
+//! disabled.
+////////////////////////////////////////////////////////////////////////////////
+class IcosTopologyCache
+{
+public:
+
+  struct Statistics
+  {
+    //! Topologies handed out from the registry.
+    U32 RegistryHits;
+    //! Topologies mapped from the cache directory.
+    U32 DirectoryHits;
+    //! Topologies computed.
+    U32 Builds;
+    //! Topologies currently in the registry.
+    U32 ResidentCount;
+    //! Bytes of topology currently in the registry.
+    U64 ResidentBytes;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Enables the cache. Topology files are kept in directory, which must
+  //! exist; with nullptr the cache is in-process only.
+  //////////////////////////////////////////////////////////////////////////////
+  static void Enable(const char * directory) throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Disables the cache and empties the registry. Topologies still in use stay
+  //! alive until their last map lets go of them.
+  //////////////////////////////////////////////////////////////////////////////
+  static void Disable() throw ();
+
+  static bool IsEnabled() throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the cached topology of the given size, holding one reference for
+  //! the caller.
+  //////////////////////////////////////////////////////////////////////////////
+  static const IcosTopology * Acquire(U8 size) throw (Exception::Type);
+
+  static Statistics GetStatistics() throw ();
+};
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
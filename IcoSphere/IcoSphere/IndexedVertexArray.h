@@ -0,0 +1,345 @@
+#pragma once
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ * Oct 19, 2026 |---| added bulk vertex and index writes
+ * Oct 19, 2026 |---| vertices may be changed in place
+ * Oct 19, 2026 |---| added read access to the indices
+ * Oct 19, 2026 |---| added compact vertex formats
+ * Oct 19, 2026 |---| templated on the vertex layout
+ *
+ * ****************************************************************************/
+
+#include "ColorRGBA.h"
+#include "NativeTypes.h"
+#include "Vector.h"
+#include "Vertex.h"
+#include "VertexArray.h"
+#include "VertexFormat.h"
+
+////////////////////////////////////////////////////////////////////////////////
+//! A vertex array of any size with a list of indices into it, so a whole mesh
+//! of shared vertices is drawn with one call. Vertices are of type LAYOUT:
+//! Vertex, or one of the compact layouts of VertexLayouts.h. Storage is
+//! allocated once by Allocate() and reused by every Reset().
+////////////////////////////////////////////////////////////////////////////////
+template<typename LAYOUT = Vertex>
+class IndexedVertexArray : public VertexArray
+{
+public:
+
+  IndexedVertexArray(
+      Type drawType
+      ) throw ()
+      : VertexArray(drawType)
+      , Color()
+      , Vertices(nullptr)
+      , VertexCapacity(0)
+      , VertexCount(0)
+      , Indices(nullptr)
+      , IndexCapacity(0)
+      , IndexCount(0)
+  {
+  }
+
+  ~IndexedVertexArray(
+      ) throw ()
+  {
+    delete [] Vertices;
+    delete [] Indices;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Makes room for the given number of vertices and indices and resets the
+  //! array.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  Allocate(
+      Size vertexCapacity,
+      Size indexCapacity
+      ) throw ()
+  {
+    if (VertexCapacity < vertexCapacity)
+    {
+      delete [] Vertices;
+      Vertices = new LAYOUT[vertexCapacity];
+      VertexCapacity = vertexCapacity;
+    }
+
+    if (IndexCapacity < indexCapacity)
+    {
+      delete [] Indices;
+      Indices = new U32[indexCapacity];
+      IndexCapacity = indexCapacity;
+    }
+
+    Reset();
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Resets the vertex and index counts to zero.
+  //////////////////////////////////////////////////////////////////////////////
+  inline
+  void
+  Reset(
+      ) throw ()
+  {
+    VertexCount = 0;
+    IndexCount = 0;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Adds a vertex of the current Color, with the position as its normal, and
+  //! returns its index. Vertices beyond the capacity are counted but not
+  //! stored.
+  //////////////////////////////////////////////////////////////////////////////
+  inline
+  U32
+  AddVertex(
+      const Vector & pos
+      ) throw ()
+  {
+    if (VertexCount < VertexCapacity)
+    {
+      Vertices[VertexCount].Set(pos, pos, Color);
+    }
+    return (U32)VertexCount++;
+  }
+
+  inline
+  void
+  AddTriangle(
+      U32 a,
+      U32 b,
+      U32 c
+      ) throw ()
+  {
+    if (IndexCount + 3 <= IndexCapacity)
+    {
+      Indices[IndexCount] = a;
+      Indices[IndexCount + 1] = b;
+      Indices[IndexCount + 2] = c;
+    }
+    IndexCount += 3;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Adds count vertices and returns where the caller is to write them, or
+  //! null if there is no room for them.
+  //////////////////////////////////////////////////////////////////////////////
+  inline
+  LAYOUT *
+  AddVertices(
+      Size count
+      ) throw ()
+  {
+    LAYOUT * vertex = (VertexCount + count <= VertexCapacity) ? &Vertices[VertexCount] : nullptr;
+    VertexCount += count;
+    return vertex;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Adds count indices and returns where the caller is to write them, or
+  //! null if there is no room for them.
+  //////////////////////////////////////////////////////////////////////////////
+  inline
+  U32 *
+  AddIndices(
+      Size count
+      ) throw ()
+  {
+    U32 * index = (IndexCount + count <= IndexCapacity) ? &Indices[IndexCount] : nullptr;
+    IndexCount += count;
+    return index;
+  }
+
+  inline
+  Size
+  GetVertexCount(
+      ) const throw ()
+  {
+    return VertexCount;
+  }
+
+  inline
+  Size
+  GetIndexCount(
+      ) const throw ()
+  {
+    return IndexCount;
+  }
+
+  inline
+  const U32 *
+  GetIndices(
+      ) const throw ()
+  {
+    return Indices;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the vertices, which may be changed in place.
+  //////////////////////////////////////////////////////////////////////////////
+  inline
+  LAYOUT *
+  GetVertices(
+      ) throw ()
+  {
+    return Vertices;
+  }
+
+  inline
+  const LAYOUT *
+  GetVertices(
+      ) const throw ()
+  {
+    return Vertices;
+  }
+
+  inline
+  const LAYOUT &
+  operator[](
+      Size i
+      ) const throw ()
+  {
+    return Vertices[i];
+  }
+
+  ColorRGBA Color;
+
+protected:
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the number of indices to draw, or none if any vertex or index
+  //! was dropped for lack of room.
+  //////////////////////////////////////////////////////////////////////////////
+  Size
+  GetDrawCount(
+      ) const throw ()
+  {
+    return ((VertexCount <= VertexCapacity) && (IndexCount <= IndexCapacity)) ? IndexCount : 0;
+  }
+
+  Size
+  GetStride(
+      ) const throw ()
+  {
+    return sizeof(LAYOUT);
+  }
+
+  Size
+  GetGLVertexSize(
+      ) const throw ()
+  {
+    return VertexFormat::Describe(LAYOUT::FORMAT).Position.Count;
+  }
+
+  const void *
+  GetGLVertexPointer(
+      ) const throw ()
+  {
+    return (nullptr != Vertices) ? Vertices[0].GetGLVertexPointer() : nullptr;
+  }
+
+  Size
+  GetGLColorSize(
+      ) const throw ()
+  {
+    return VertexFormat::Describe(LAYOUT::FORMAT).Color.Count;
+  }
+
+  const void *
+  GetGLColorPointer(
+      ) const throw ()
+  {
+    return (nullptr != Vertices) ? Vertices[0].GetGLColorPointer() : nullptr;
+  }
+
+  Size
+  GetGLNormalSize(
+      ) const throw ()
+  {
+    return VertexFormat::Describe(LAYOUT::FORMAT).Normal.Count;
+  }
+
+  const void *
+  GetGLNormalPointer(
+      ) const throw ()
+  {
+    return (nullptr != Vertices) ? Vertices[0].GetGLNormalPointer() : nullptr;
+  }
+
+  Size
+  GetGLTextureCoordinateSize(
+      ) const throw ()
+  {
+    return 0;
+  }
+
+  const void *
+  GetGLTextureCoordinatePointer(
+      ) const throw ()
+  {
+    return nullptr;
+  }
+
+  U8
+  GetFormat(
+      ) const throw ()
+  {
+    return LAYOUT::FORMAT;
+  }
+
+  const U32 *
+  GetIndexPointer(
+      ) const throw ()
+  {
+    return Indices;
+  }
+
+private:
+
+  LAYOUT * Vertices;
+  Size VertexCapacity;
+  Size VertexCount;
+
+  U32 * Indices;
+  Size IndexCapacity;
+  Size IndexCount;
+
+private:
+
+  IndexedVertexArray(
+      const IndexedVertexArray<LAYOUT> &
+      ) throw ();
+
+  IndexedVertexArray<LAYOUT> &
+  operator=(
+      const IndexedVertexArray<LAYOUT> &
+      ) throw ();
+
+};
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
@@ -18,6 +18,7 @@
  * Chagne Date        Description
  * -----------------------------------------------------------------------------
  * Aug 19, 2019 |---| added license notice
+ * Oct 19, 2026 |---| added natural logarithm
  *
  * ****************************************************************************/
 
@@ -82,6 +83,14 @@ F32 Math::SquareRoot(F32 value) throw ()
   return sqrtf(value);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// (See Math.h)
+////////////////////////////////////////////////////////////////////////////////
+F32 Math::NaturalLogarithm(F32 value) throw ()
+{
+  return logf(value);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // (See Math.h)
 ////////////////////////////////////////////////////////////////////////////////
@@ -19,6 +19,7 @@
  * Chagne Date        Description
  * -----------------------------------------------------------------------------
  * Aug 19, 2019 |---| added license notice
+ * Oct 19, 2026 |---| added natural logarithm
  *
  * ****************************************************************************/
 
@@ -102,6 +103,7 @@ namespace Math
   //! Operators.
   //////////////////////////////////////////////////////////////////////////////
   F32 SquareRoot(F32 value) throw ();
+  F32 NaturalLogarithm(F32 value) throw ();
 
   //////////////////////////////////////////////////////////////////////////////
   //! Returns value rounded to the nearest decimal fraction with the given
@@ -18,6 +18,8 @@
  * Chagne Date        Description
  * -----------------------------------------------------------------------------
  * Aug 19, 2019 |---| added license notice
+ * Oct 19, 2026 |---| added bulk generation, packed 32 bit state
+ * Oct 19, 2026 |---| added saving and loading of the generator state
  *
  * ****************************************************************************/
 
@@ -30,14 +32,57 @@
 
 #define UUT_RANDOM_NUMBER_GENERATOR 1
 
+#include "Math.h"
 #include "NumberGenerator.hpp"
+#include "Vector.h"
 
 #define M                 397
 #define MATRIX_A          0x9908b0dfUL
 #define UPPER_MASK        0x80000000UL
 #define LOWER_MASK        0x7fffffffUL
 
-static const U64 sMag01[2] = {0x0UL, MATRIX_A};
+//! Number of values converted per chunk by the floating point Fill calls.
+static const Size FILL_CHUNK_SIZE = 256;
+
+////////////////////////////////////////////////////////////////////////////////
+//! Mixes two adjacent state words. Branch free so the twist loops vectorize.
+////////////////////////////////////////////////////////////////////////////////
+static inline
+U32
+Mix(
+    U32 upper,
+    U32 lower,
+    U32 shifted
+    ) throw ()
+{
+  U32 temp = (upper & UPPER_MASK) | (lower & LOWER_MASK);
+
+  return shifted ^ (temp >> 1) ^ ((0u - (temp & 0x1UL)) & MATRIX_A);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Tempers count state words into value[].
+////////////////////////////////////////////////////////////////////////////////
+static inline
+void
+Temper(
+    const U32 state[],
+    U32 value[],
+    Size count
+    ) throw ()
+{
+  for (Size i = 0; i < count; ++i)
+  {
+    U32 temp = state[i];
+
+    temp ^= (temp >> 11);
+    temp ^= (temp << 7) & 0x9d2c5680UL;
+    temp ^= (temp << 15) & 0xefc60000UL;
+    temp ^= (temp >> 18);
+
+    value[i] = temp;
+  }
+}
 
 /* *****************************************************************************
  * (See NumberGenerator.hpp)
@@ -81,6 +126,44 @@ NumberGenerator::operator=(
   return *this;
 }
 
+/* *****************************************************************************
+ * (See NumberGenerator.hpp)
+ * ****************************************************************************/
+void
+NumberGenerator::SaveState(
+    U32 state[]
+    ) const throw ()
+{
+  for (U32 i = 0; i < STATE_SIZE; ++i)
+  {
+    state[i] = mMT[i];
+  }
+
+  state[STATE_SIZE] = mIndex;
+}
+
+/* *****************************************************************************
+ * (See NumberGenerator.hpp)
+ * ****************************************************************************/
+void
+NumberGenerator::LoadState(
+    const U32 state[]
+    ) throw (Exception::Type)
+{
+  // STATE_SIZE + 1 marks a generator that was never seeded.
+  if (state[STATE_SIZE] > STATE_SIZE + 1)
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  for (U32 i = 0; i < STATE_SIZE; ++i)
+  {
+    mMT[i] = state[i];
+  }
+
+  mIndex = state[STATE_SIZE];
+}
+
 /* *****************************************************************************
  * (See NumberGenerator.hpp)
  * ****************************************************************************/
@@ -165,51 +248,188 @@ NumberGenerator::GenerateF64(
 /* *****************************************************************************
  * (See NumberGenerator.hpp)
  * ****************************************************************************/
-inline
-U32
-NumberGenerator::Generate(
+void
+NumberGenerator::FillU32(
+    U32 value[],
+    Size count
+    ) throw ()
+{
+  while (0 < count)
+  {
+    if (mIndex >= STATE_SIZE)
+    {
+      Twist();
+    }
+
+    Size n = STATE_SIZE - mIndex;
+    if (count < n) n = count;
+
+    Temper(&mMT[mIndex], value, n);
+
+    mIndex += n;
+    value += n;
+    count -= n;
+  }
+}
+
+void
+NumberGenerator::FillF32(
+    F32 value[],
+    Size count
     ) throw ()
 {
-  U64 temp;
+  U32 chunk[FILL_CHUNK_SIZE];
 
-  if (mIndex >= STATE_SIZE)
+  for (Size done = 0; done < count; done += FILL_CHUNK_SIZE)
   {
-    if (mIndex == (STATE_SIZE+1))
+    Size n = ((count - done) < FILL_CHUNK_SIZE) ? (count - done) : FILL_CHUNK_SIZE;
+
+    FillU32(chunk, n);
+
+    // Keep 24 bits so the result is exact and never rounds up to 1.
+    for (Size i = 0; i < n; ++i)
     {
-      Seed(5489UL);
+      value[done + i] = (F32)(chunk[i] >> 8) * (1.0f/16777216.0f);
     }
+  }
+}
+
+void
+NumberGenerator::FillF64(
+    F64 value[],
+    Size count
+    ) throw ()
+{
+  U32 chunk[FILL_CHUNK_SIZE];
+
+  for (Size done = 0; done < count; done += FILL_CHUNK_SIZE)
+  {
+    Size n = ((count - done) < FILL_CHUNK_SIZE) ? (count - done) : FILL_CHUNK_SIZE;
+
+    FillU32(chunk, n);
+
+    for (Size i = 0; i < n; ++i)
+    {
+      value[done + i] = (F64)chunk[i] * (1.0/4294967296.0);
+    }
+  }
+}
 
-    U32 i = 0;
+void
+NumberGenerator::FillUnitVectors(
+    Vector vector[],
+    Size count
+    ) throw ()
+{
+  // Marsaglia (1972): a point (u,v) uniform in the unit disc maps to a point
+  // uniform on the sphere without any trigonometry.
+  F32 chunk[FILL_CHUNK_SIZE];
+  Size next = FILL_CHUNK_SIZE;
+  Size done = 0;
+
+  while (done < count)
+  {
+    if (next >= FILL_CHUNK_SIZE)
+    {
+      FillF32(chunk, FILL_CHUNK_SIZE);
+      next = 0;
+    }
 
-    for (; i < (STATE_SIZE-M); ++i)
+    F32 u = 2.0f * chunk[next++] - 1.0f;
+    F32 v = 2.0f * chunk[next++] - 1.0f;
+    F32 s = u * u + v * v;
+
+    if ((0.0f < s) && (s < 1.0f))
     {
-      temp = (mMT[i] & UPPER_MASK) | (mMT[i+1] & LOWER_MASK);
+      F32 scale = 2.0f * Math::SquareRoot(1.0f - s);
+      vector[done++] = Vector(u * scale, v * scale, 1.0f - 2.0f * s);
+    }
+  }
+}
+
+void
+NumberGenerator::FillNormal(
+    F32 value[],
+    Size count
+    ) throw ()
+{
+  // Marsaglia polar method, two values per accepted point.
+  F32 chunk[FILL_CHUNK_SIZE];
+  Size next = FILL_CHUNK_SIZE;
+  Size done = 0;
 
-      mMT[i] = mMT[i+M] ^ (temp >> 1) ^ sMag01[temp & 0x1UL];
+  while (done < count)
+  {
+    if (next >= FILL_CHUNK_SIZE)
+    {
+      FillF32(chunk, FILL_CHUNK_SIZE);
+      next = 0;
     }
 
-    for ( ; i < STATE_SIZE-1; ++i)
+    F32 u = 2.0f * chunk[next++] - 1.0f;
+    F32 v = 2.0f * chunk[next++] - 1.0f;
+    F32 s = u * u + v * v;
+
+    if ((0.0f < s) && (s < 1.0f))
     {
-      temp = (mMT[i] & UPPER_MASK) | (mMT[i+1] & LOWER_MASK);
+      F32 scale = Math::SquareRoot(-2.0f * Math::NaturalLogarithm(s) / s);
 
-      mMT[i] = mMT[i+(M-STATE_SIZE)] ^ (temp >> 1) ^ sMag01[temp & 0x1UL];
+      value[done++] = u * scale;
+
+      if (done < count)
+      {
+        value[done++] = v * scale;
+      }
     }
+  }
+}
+
+inline
+U32
+NumberGenerator::Generate(
+    ) throw ()
+{
+  if (mIndex >= STATE_SIZE)
+  {
+    Twist();
+  }
+
+  U32 temp;
+
+  Temper(&mMT[mIndex++], &temp, 1);
 
-    temp = (mMT[STATE_SIZE-1] & UPPER_MASK) | (mMT[0] & LOWER_MASK);
+  return temp;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Generates the next STATE_SIZE words of state. Seeds with the default seed
+//! if the generator has never been seeded.
+////////////////////////////////////////////////////////////////////////////////
+void
+NumberGenerator::Twist(
+    ) throw ()
+{
+  if (mIndex == (STATE_SIZE+1))
+  {
+    Seed(5489UL);
+  }
 
-    mMT[STATE_SIZE-1] = mMT[M-1] ^ (temp >> 1) ^ sMag01[temp & 0x1UL];
+  U32 * mt = mMT;
+  U32 i = 0;
 
-    mIndex = 0;
+  for (; i < (STATE_SIZE-M); ++i)
+  {
+    mt[i] = Mix(mt[i], mt[i+1], mt[i+M]);
   }
 
-  temp = mMT[mIndex++];
+  for ( ; i < STATE_SIZE-1; ++i)
+  {
+    mt[i] = Mix(mt[i], mt[i+1], mt[i+(M-STATE_SIZE)]);
+  }
 
-  temp ^= (temp >> 11);
-  temp ^= (temp << 7) & 0x9d2c5680UL;
-  temp ^= (temp << 15) & 0xefc60000UL;
-  temp ^= (temp >> 18);
+  mt[STATE_SIZE-1] = Mix(mt[STATE_SIZE-1], mt[0], mt[M-1]);
 
-  return (U32)(temp & 0x00000000FFFFFFFFUL);
+  mIndex = 0;
 }
 
 /* *****************************************************************************
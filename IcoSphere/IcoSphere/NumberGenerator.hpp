@@ -19,13 +19,18 @@
  * Chagne Date        Description
  * -----------------------------------------------------------------------------
  * Aug 19, 2019 |---| added license notice
+ * Oct 19, 2026 |---| added bulk generation, packed 32 bit state
+ * Oct 19, 2026 |---| added saving and loading of the generator state
  *
  * ****************************************************************************/
 
+#include "Exception.h"
 #include "NativeTypes.h"
 
 #include "Array.h"
 
+struct Vector;
+
 /* *****************************************************************************
  *
  * A C++ implementation of the Mersenne Twister PRNG, derived from the the
@@ -34,6 +39,10 @@
  * ****************************************************************************/
 class NumberGenerator
 {
+private:
+
+  static const U32 STATE_SIZE = 624;
+
 public:
 
   /* ***************************************************************************
@@ -92,6 +101,83 @@ public:
   GenerateF64(
       ) throw ();
 
+  /* ***************************************************************************
+   *
+   * Bulk generation. Each Fill call continues the same sequence GenerateU32()
+   * draws from; FillU32 produces exactly the values count calls to
+   * GenerateU32() would. Values are tempered a state block at a time in loops
+   * the compiler can vectorize.
+   *
+   * **************************************************************************/
+  void
+  FillU32(
+      U32 value[],
+      Size count
+      ) throw ();
+
+  /* ***************************************************************************
+   *
+   * Uniform values in [0,1). Unlike GenerateF64(), 1 is never produced.
+   *
+   * **************************************************************************/
+  void
+  FillF32(
+      F32 value[],
+      Size count
+      ) throw ();
+
+  /* ***************************************************************************
+   *
+   * Uniform values in [0,1). Unlike GenerateF64(), 1 is never produced.
+   *
+   * **************************************************************************/
+  void
+  FillF64(
+      F64 value[],
+      Size count
+      ) throw ();
+
+  /* ***************************************************************************
+   *
+   * Unit vectors uniformly distributed over the sphere, W = 1.
+   *
+   * **************************************************************************/
+  void
+  FillUnitVectors(
+      Vector vector[],
+      Size count
+      ) throw ();
+
+  /* ***************************************************************************
+   *
+   * Normally distributed values with mean 0 and standard deviation 1.
+   *
+   * **************************************************************************/
+  void
+  FillNormal(
+      F32 value[],
+      Size count
+      ) throw ();
+
+  /* ***************************************************************************
+   *
+   * The complete state of the generator, STATE_WORD_COUNT words: the state
+   * array followed by the index of the next word to temper. A generator
+   * loaded with a saved state continues exactly where the saved one was.
+   *
+   * **************************************************************************/
+  static const U32 STATE_WORD_COUNT = STATE_SIZE + 1;
+
+  void
+  SaveState(
+      U32 state[]
+      ) const throw ();
+
+  void
+  LoadState(
+      const U32 state[]
+      ) throw (Exception::Type);
+
 private:
 
   inline
@@ -99,11 +185,13 @@ private:
   Generate(
       ) throw ();
 
-private:
+  void
+  Twist(
+      ) throw ();
 
-  static const U32 STATE_SIZE = 624;
+private:
 
-  Containers::Array<U64, STATE_SIZE> mMT;
+  Containers::Array<U32, STATE_SIZE> mMT;
 
   U32 mIndex;
 
@@ -0,0 +1,239 @@
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ * Oct 19, 2026 |---| added compact vertex formats
+ *
+ * ****************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include "RenderCommandBuffer.h"
+
+////////////////////////////////////////////////////////////////////////////////
+//! Recorded commands, kept out of the header with the standard library.
+////////////////////////////////////////////////////////////////////////////////
+struct RenderCommandBuffer::Storage
+{
+  std::vector<Command> List;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns true when two commands bind the same arrays.
+////////////////////////////////////////////////////////////////////////////////
+static
+inline
+bool
+IsSameArrays(
+    const RenderCommandBuffer::Command & a,
+    const RenderCommandBuffer::Command & b
+    ) throw ()
+{
+  return (a.Format == b.Format) && (a.VertexPointer == b.VertexPointer)
+      && (a.ColorPointer == b.ColorPointer)
+      && (a.NormalPointer == b.NormalPointer) && (a.Stride == b.Stride);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Orders commands by draw type, then format and arrays, then index array and
+//! first element, so that commands which may be merged end up next to each
+//! other.
+////////////////////////////////////////////////////////////////////////////////
+static
+bool
+IsBefore(
+    const RenderCommandBuffer::Command & a,
+    const RenderCommandBuffer::Command & b
+    ) throw ()
+{
+  if (a.DrawType != b.DrawType) return (a.DrawType < b.DrawType);
+  if (a.Format != b.Format) return (a.Format < b.Format);
+  if (a.VertexPointer != b.VertexPointer) return (a.VertexPointer < b.VertexPointer);
+  if (a.ColorPointer != b.ColorPointer) return (a.ColorPointer < b.ColorPointer);
+  if (a.NormalPointer != b.NormalPointer) return (a.NormalPointer < b.NormalPointer);
+  if (a.Stride != b.Stride) return (a.Stride < b.Stride);
+  if (a.IndexPointer != b.IndexPointer) return (a.IndexPointer < b.IndexPointer);
+  return (a.First < b.First);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See RenderCommandBuffer.h)
+////////////////////////////////////////////////////////////////////////////////
+RenderCommandBuffer::Counter::Counter(
+    ) throw ()
+    : DrawCount(0u)
+    , BindCount(0u)
+    , ElementCount(0u)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See RenderCommandBuffer.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+RenderCommandBuffer::Counter::BindArrays(
+    const Command * command
+    ) throw ()
+{
+  if (nullptr != command)
+  {
+    ++BindCount;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See RenderCommandBuffer.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+RenderCommandBuffer::Counter::DrawCommand(
+    const Command & command
+    ) throw ()
+{
+  ++DrawCount;
+  ElementCount += command.Count;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See RenderCommandBuffer.h)
+////////////////////////////////////////////////////////////////////////////////
+RenderCommandBuffer::RenderCommandBuffer(
+    ) throw ()
+    : Commands(new Storage())
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See RenderCommandBuffer.h)
+////////////////////////////////////////////////////////////////////////////////
+RenderCommandBuffer::~RenderCommandBuffer(
+    ) throw ()
+{
+  delete Commands;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See RenderCommandBuffer.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+RenderCommandBuffer::Record(
+    const Command & command
+    ) throw ()
+{
+  if (0 < command.Count)
+  {
+    Commands->List.push_back(command);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See RenderCommandBuffer.h)
+////////////////////////////////////////////////////////////////////////////////
+Size
+RenderCommandBuffer::GetCommandCount(
+    ) const throw ()
+{
+  return Commands->List.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See RenderCommandBuffer.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+RenderCommandBuffer::Sort(
+    ) throw ()
+{
+  std::vector<Command> & list = Commands->List;
+
+  if (list.empty())
+  {
+    return;
+  }
+
+  std::stable_sort(list.begin(), list.end(), IsBefore);
+
+  // Fold each command into the one before it when it continues its range.
+  Size last = 0;
+
+  for (Size i = 1; i < (Size)list.size(); ++i)
+  {
+    Command & previous = list[last];
+    const Command & command = list[i];
+
+    if ((VertexArray::TYPE_TRIANGLE_FAN != command.DrawType) &&
+        (previous.DrawType == command.DrawType) &&
+        IsSameArrays(previous, command) &&
+        (previous.IndexPointer == command.IndexPointer) &&
+        (previous.First + previous.Count == command.First))
+    {
+      previous.Count += command.Count;
+    }
+    else
+    {
+      list[++last] = command;
+    }
+  }
+
+  list.resize(last + 1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See RenderCommandBuffer.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+RenderCommandBuffer::Replay(
+    Backend & backend
+    ) const throw ()
+{
+  const std::vector<Command> & list = Commands->List;
+  const Command * bound = nullptr;
+
+  for (Size i = 0; i < (Size)list.size(); ++i)
+  {
+    if ((nullptr == bound) || ! IsSameArrays(*bound, list[i]))
+    {
+      bound = &list[i];
+      backend.BindArrays(bound);
+    }
+
+    backend.DrawCommand(list[i]);
+  }
+
+  if (nullptr != bound)
+  {
+    backend.BindArrays(nullptr);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See RenderCommandBuffer.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+RenderCommandBuffer::Clear(
+    ) throw ()
+{
+  Commands->List.clear();
+}
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
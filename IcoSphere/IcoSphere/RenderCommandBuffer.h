@@ -0,0 +1,173 @@
+#pragma once
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ * Oct 19, 2026 |---| added compact vertex formats
+ *
+ * ****************************************************************************/
+
+#include "NativeTypes.h"
+#include "VertexArray.h"
+
+////////////////////////////////////////////////////////////////////////////////
+//! Draw commands recorded for later submission. Sort() orders the commands by
+//! draw type, vertex format and then the vertex arrays they bind, and merges
+//! commands drawing adjoining ranges of one array into one. Replay() then
+//! hands the commands to a Backend, binding arrays only when they differ from
+//! the last command's.
+//!
+//! Sorting changes the order commands are drawn in, which leaves depth tested
+//! opaque drawing unchanged except where fragments tie in depth.
+////////////////////////////////////////////////////////////////////////////////
+class RenderCommandBuffer
+{
+public:
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Draws elements [First, First + Count) of vertex arrays bound as OpenGL
+  //! attribute pointers: indices when IndexPointer is set, vertices otherwise.
+  //! Format is the VertexFormat describing the pointers.
+  //////////////////////////////////////////////////////////////////////////////
+  struct Command
+  {
+    VertexArray::Type DrawType;
+    U8 Format;
+    const void * VertexPointer;
+    const void * ColorPointer;
+    const void * NormalPointer;
+    Size Stride;
+    const U32 * IndexPointer;
+    Size First;
+    Size Count;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Receives replayed commands.
+  //////////////////////////////////////////////////////////////////////////////
+  class Backend
+  {
+  public:
+
+    virtual
+    ~Backend(
+        ) throw ()
+    {
+    }
+
+    //! Binds the arrays of command, or unbinds all arrays when nullptr.
+    virtual
+    void
+    BindArrays(
+        const Command * command
+        ) throw () = 0;
+
+    //! Draws command with its arrays bound.
+    virtual
+    void
+    DrawCommand(
+        const Command & command
+        ) throw () = 0;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Backend drawing nothing and counting what it would submit.
+  //////////////////////////////////////////////////////////////////////////////
+  class Counter : public Backend
+  {
+  public:
+
+    Counter(
+        ) throw ();
+
+    void
+    BindArrays(
+        const Command * command
+        ) throw ();
+
+    void
+    DrawCommand(
+        const Command & command
+        ) throw ();
+
+    //! Draw calls submitted.
+    U32 DrawCount;
+    //! Times arrays were bound.
+    U32 BindCount;
+    //! Elements drawn by all draw calls.
+    U64 ElementCount;
+  };
+
+  RenderCommandBuffer(
+      ) throw ();
+
+  ~RenderCommandBuffer(
+      ) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Appends a command. Commands drawing no elements are dropped.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  Record(
+      const Command & command
+      ) throw ();
+
+  Size
+  GetCommandCount(
+      ) const throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Sorts the commands and merges those drawing adjoining ranges. Commands
+  //! with equal keys keep their recorded order. Triangle fans are never
+  //! merged.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  Sort(
+      ) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Submits the commands to backend in order, and unbinds the arrays at the
+  //! end. The commands are kept, so they may be replayed again.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  Replay(
+      Backend & backend
+      ) const throw ();
+
+  void
+  Clear(
+      ) throw ();
+
+private:
+
+  RenderCommandBuffer(const RenderCommandBuffer &);
+  RenderCommandBuffer & operator=(const RenderCommandBuffer &);
+
+  struct Storage;
+
+  //! Recorded commands.
+  Storage * Commands;
+};
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
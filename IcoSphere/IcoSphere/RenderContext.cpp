@@ -18,29 +18,51 @@
  * Chagne Date        Description
  * -----------------------------------------------------------------------------
  * Aug 19, 2019 |---| added license notice
+ * Oct 19, 2026 |---| draw indexed vertex arrays with one glDrawElements
+ * Oct 19, 2026 |---| added drawing a range of an array
+ * Oct 19, 2026 |---| added a software rasterizer backend
+ * Oct 19, 2026 |---| added recorded command buffers
+ * Oct 19, 2026 |---| added compact vertex formats
+ * Oct 19, 2026 |---| build without OpenGL under TESTING
  *
  * ****************************************************************************/
 
 #include "NativeTypes.h"
 #include "RenderContext.h"
+#include "SoftwareRasterizer.h"
 #include "VertexArray.h"
 
+#ifndef TESTING
 #include <OpenGL/gl3.h>
+#endif
 
 RenderContext::RenderContext(
     ) throw ()
+    : Software(nullptr)
+    , IsRecording(false)
+    , Program()
+    , Commands()
 {
 }
 
 RenderContext::~RenderContext(
     ) throw ()
 {
+  delete Software;
 }
 
 void
 RenderContext::Reset(
     ) throw ()
 {
+  Flush();
+
+  if (nullptr != Software)
+  {
+    Software->Clear();
+    return;
+  }
+
 #ifndef TESTING
   glEnable(GL_DEPTH_TEST);
   glDepthFunc(GL_LESS);
@@ -55,38 +77,279 @@ RenderContext::Draw(
     const VertexArray & array
     ) throw ()
 {
-#ifndef TESTING
-  Size stride = array.GetStride();
-  Size drawCount = array.GetDrawCount();
-  U32 drawType = GetGLDrawType(array.DrawType);
-  const F32 *vertexPointer = array.GetGLVertexPointer();
-  Size vertexSize = array.GetGLVertexSize();
-  const F32 *colorPointer = array.GetGLColorPointer();
-  Size colorSize = array.GetGLColorSize();
+  Draw(array, 0, array.GetDrawCount());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See RenderContext.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+RenderContext::Draw(
+    const VertexArray & array,
+    Size first,
+    Size count
+    ) throw ()
+{
+  RenderCommandBuffer::Command command;
+  command.DrawType = array.DrawType;
+  command.Format = array.GetFormat();
+  command.VertexPointer = array.GetGLVertexPointer();
+  command.ColorPointer = array.GetGLColorPointer();
+  command.NormalPointer = array.GetGLNormalPointer();
+  command.Stride = array.GetStride();
+  command.IndexPointer = array.GetIndexPointer();
+  command.First = first;
+  command.Count = count;
+
+  if (IsRecording)
+  {
+    Commands.Record(command);
+    return;
+  }
 
-  // Enable vertex arrays.
-  glEnableVertexAttribArray(0); // position
-  glVertexAttribPointer(0, vertexSize, GL_FLOAT, GL_FALSE, stride, vertexPointer);
+  BindArrays(&command);
+  DrawCommand(command);
+  BindArrays(nullptr);
+}
 
-  if (nullptr != colorPointer)
+////////////////////////////////////////////////////////////////////////////////
+// (See RenderContext.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+RenderContext::SetRecording(
+    bool isRecording
+    ) throw ()
+{
+  if (! isRecording)
   {
-    glEnableVertexAttribArray(1); // color
-    glVertexAttribPointer(1, colorSize, GL_FLOAT, GL_FALSE, stride, colorPointer);
+    Flush();
   }
 
-  // Draw the vertex arrays.
-  glDrawArrays(drawType, 0, drawCount);
+  IsRecording = isRecording;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See RenderContext.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+RenderContext::Flush(
+    ) throw ()
+{
+  Flush(*this);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See RenderContext.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+RenderContext::Flush(
+    RenderCommandBuffer::Backend & backend
+    ) throw ()
+{
+  Commands.Sort();
+  Commands.Replay(backend);
+  Commands.Clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Enables the vertex attribute arrays of a command, or disables them all.
+//! The software backend reads the arrays from each command instead.
+////////////////////////////////////////////////////////////////////////////////
+void
+RenderContext::BindArrays(
+    const RenderCommandBuffer::Command * command
+    ) throw ()
+{
+  if (nullptr != Software)
+  {
+    return;
+  }
 
-  // Disable vertex arrays.
-  if (nullptr != colorPointer)
+#ifndef TESTING
+  if (nullptr == command)
   {
+    glDisableVertexAttribArray(2);
     glDisableVertexAttribArray(1);
+    glDisableVertexAttribArray(0);
+    return;
+  }
+
+  if ((command->Format < VertexFormat::COUNT) && (0u != Program[command->Format]))
+  {
+    glUseProgram(Program[command->Format]);
+  }
+
+  const VertexFormat::Description & format = VertexFormat::Describe(command->Format);
+
+  BindAttribute(0, format.Position, command->Stride, command->VertexPointer); // position
+  BindAttribute(1, format.Color, command->Stride, command->ColorPointer); // color
+  BindAttribute(2, format.Normal, command->Stride, command->NormalPointer); // normal
+#else
+  // Overrides RenderCommandBuffer::Backend, so it exists without OpenGL too.
+  (void)command;
+#endif
+}
+
+#ifndef TESTING
+////////////////////////////////////////////////////////////////////////////////
+//! Enables a vertex attribute array, or disables it when the format lacks the
+//! attribute or the pointer is null.
+////////////////////////////////////////////////////////////////////////////////
+void
+RenderContext::BindAttribute(
+    U32 index,
+    const VertexFormat::Attribute & attribute,
+    Size stride,
+    const void * pointer
+    ) throw ()
+{
+  if ((0u == attribute.Count) || (nullptr == pointer))
+  {
+    glDisableVertexAttribArray(index);
+    return;
+  }
+
+  U32 type = GL_FLOAT;
+
+  if (VertexFormat::COMPONENT_UNSIGNED_BYTE == attribute.Component)
+  {
+    type = GL_UNSIGNED_BYTE;
+  }
+  else if (VertexFormat::COMPONENT_UNSIGNED_SHORT == attribute.Component)
+  {
+    type = GL_UNSIGNED_SHORT;
+  }
+  else if (VertexFormat::COMPONENT_SHORT == attribute.Component)
+  {
+    type = GL_SHORT;
   }
 
-  glDisableVertexAttribArray(0);
+  glEnableVertexAttribArray(index);
+  glVertexAttribPointer(index, attribute.Count, type, attribute.IsNormalized ? GL_TRUE : GL_FALSE, stride, pointer);
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+//! Draws a command with its arrays bound.
+////////////////////////////////////////////////////////////////////////////////
+void
+RenderContext::DrawCommand(
+    const RenderCommandBuffer::Command & command
+    ) throw ()
+{
+  if (nullptr != Software)
+  {
+    Software->Draw(command.DrawType, command.Format,
+                   command.VertexPointer, command.ColorPointer,
+                   command.Stride, command.IndexPointer, command.First, command.Count);
+    return;
+  }
+
+#ifndef TESTING
+  U32 drawType = GetGLDrawType(command.DrawType);
+
+  if (nullptr != command.IndexPointer)
+  {
+    glDrawElements(drawType, command.Count, GL_UNSIGNED_INT, command.IndexPointer + command.First);
+  }
+  else
+  {
+    glDrawArrays(drawType, command.First, command.Count);
+  }
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See RenderContext.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+RenderContext::UseSoftwareRasterizer(
+    U32 width,
+    U32 height,
+    U32 threadCount
+    ) throw (Exception::Type)
+{
+  SoftwareRasterizer * software = new SoftwareRasterizer();
+
+  try
+  {
+    software->Initialize(width, height, threadCount);
+  }
+  catch (Exception::Type error)
+  {
+    delete software;
+    throw (error);
+  }
+
+  delete Software;
+  Software = software;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See RenderContext.h)
+////////////////////////////////////////////////////////////////////////////////
+SoftwareRasterizer *
+RenderContext::GetSoftwareRasterizer(
+    ) const throw ()
+{
+  return Software;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See RenderContext.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+RenderContext::SetTransform(
+    const F32 viewProjection[16]
+    ) throw ()
+{
+  Flush();
+
+  if (nullptr != Software)
+  {
+    Software->SetTransform(viewProjection);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See RenderContext.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+RenderContext::SetProgram(
+    U8 format,
+    U32 program
+    ) throw ()
+{
+  // Recorded commands are drawn with the programs set when they were made.
+  Flush();
+
+  if (format < VertexFormat::COUNT)
+  {
+    Program[format] = program;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See RenderContext.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+RenderContext::Finish(
+    ) throw ()
+{
+  Flush();
+
+  if (nullptr != Software)
+  {
+    Software->Finish();
+    return;
+  }
+
+#ifndef TESTING
+  glFlush();
 #endif
 }
 
+#ifndef TESTING
 ////////////////////////////////////////////////////////////////////////////////
 //! Returns the OpenGL ES 2.0 array type.
 ////////////////////////////////////////////////////////////////////////////////
@@ -105,9 +368,14 @@ RenderContext::GetGLDrawType(
   {
     drawType = GL_TRIANGLE_FAN;
   }
+  else if (VertexArray::TYPE_TRIANGLES == type)
+  {
+    drawType = GL_TRIANGLES;
+  }
 
   return drawType;
 }
+#endif
 
 /* *****************************************************************************
  *
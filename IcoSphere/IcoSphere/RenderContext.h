@@ -19,12 +19,31 @@
  * Chagne Date        Description
  * -----------------------------------------------------------------------------
  * Aug 19, 2019 |---| added license notice
+ * Oct 19, 2026 |---| added drawing a range of an array
+ * Oct 19, 2026 |---| added a software rasterizer backend
+ * Oct 19, 2026 |---| added recorded command buffers
+ * Oct 19, 2026 |---| added compact vertex formats
+ * Oct 19, 2026 |---| build without OpenGL under TESTING
  *
  * ****************************************************************************/
 
+#include "Exception.h"
+#include "RenderCommandBuffer.h"
 #include "VertexArray.h"
+#include "VertexFormat.h"
 
-class RenderContext
+class SoftwareRasterizer;
+
+////////////////////////////////////////////////////////////////////////////////
+//! Draws vertex arrays with OpenGL, or, once UseSoftwareRasterizer() has been
+//! called, into the in-memory image of a SoftwareRasterizer, which needs no
+//! GPU or window.
+//!
+//! Draws are submitted at once, or, while recording, appended to a command
+//! buffer which Flush() sorts, merges and submits with as few array bindings
+//! as it can.
+////////////////////////////////////////////////////////////////////////////////
+class RenderContext : private RenderCommandBuffer::Backend
 {
 public:
 
@@ -34,6 +53,10 @@ public:
   ~RenderContext(
       ) throw ();
 
+  //////////////////////////////////////////////////////////////////////////////
+  //! Clears the depth buffer, and under the software backend the image. Any
+  //! recorded commands are submitted first.
+  //////////////////////////////////////////////////////////////////////////////
   void
   Reset(
       ) throw ();
@@ -43,12 +66,130 @@ public:
       const VertexArray & array
       ) throw ();
 
+  //////////////////////////////////////////////////////////////////////////////
+  //! Draws elements [first, first + count) of the array's draw list: indices
+  //! of an indexed array, vertices otherwise.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  Draw(
+      const VertexArray & array,
+      Size first,
+      Size count
+      ) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Starts or stops recording draws instead of submitting them. Stopping
+  //! submits the recorded commands.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  SetRecording(
+      bool isRecording
+      ) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Sorts the recorded commands and submits them to this context.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  Flush(
+      ) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Sorts the recorded commands and replays them into backend instead, such
+  //! as a RenderCommandBuffer::Counter measuring a frame's draw calls and
+  //! array bindings without drawing it.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  Flush(
+      RenderCommandBuffer::Backend & backend
+      ) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Draws into a new width x height software image from now on, rasterized
+  //! by threadCount threads, zero using one per core.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  UseSoftwareRasterizer(
+      U32 width,
+      U32 height,
+      U32 threadCount = 0u
+      ) throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the software rasterizer, or nullptr when drawing with OpenGL.
+  //////////////////////////////////////////////////////////////////////////////
+  SoftwareRasterizer *
+  GetSoftwareRasterizer(
+      ) const throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Sets the column-major matrix taking positions to clip space. Under
+  //! OpenGL the application's shader applies it instead. Any recorded
+  //! commands are submitted first.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  SetTransform(
+      const F32 viewProjection[16]
+      ) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Sets the OpenGL program that draws arrays of a VertexFormat, or zero,
+  //! the default, to use the current program. Attributes are bound as the
+  //! format describes them: position at 0, color at 1 and normal at 2, so a
+  //! program for a compact format decodes them itself. The software backend
+  //! decodes every format and ignores the programs.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  SetProgram(
+      U8 format,
+      U32 program
+      ) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Submits any recorded commands and completes all drawing: the software
+  //! image is final once this returns.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  Finish(
+      ) throw ();
+
 private:
 
+  RenderContext(const RenderContext &);
+  RenderContext & operator=(const RenderContext &);
+
+#ifndef TESTING
   U32 GetGLDrawType(
       VertexArray::Type type
       ) const throw ();
+#endif
+
+  void
+  BindArrays(
+      const RenderCommandBuffer::Command * command
+      ) throw ();
+
+#ifndef TESTING
+  void
+  BindAttribute(
+      U32 index,
+      const VertexFormat::Attribute & attribute,
+      Size stride,
+      const void * pointer
+      ) throw ();
+#endif
+
+  void
+  DrawCommand(
+      const RenderCommandBuffer::Command & command
+      ) throw ();
 
+  //! Software backend in use, or nullptr for OpenGL.
+  SoftwareRasterizer * Software;
+  //! True while draws are recorded into Commands.
+  bool IsRecording;
+  //! OpenGL program of each VertexFormat, or zero.
+  U32 Program[VertexFormat::COUNT];
+  RenderCommandBuffer Commands;
 };
 
 /* *****************************************************************************
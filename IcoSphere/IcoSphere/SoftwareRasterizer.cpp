@@ -0,0 +1,855 @@
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ * Oct 19, 2026 |---| added compact vertex formats
+ *
+ * ****************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+#include "SoftwareRasterizer.h"
+#include "VertexLayouts.h"
+
+typedef std::chrono::steady_clock Clock;
+
+//! Bits of sub-pixel precision of snapped vertices.
+static const S32 SUBPIXEL_BITS = 4;
+static const S32 SUBPIXEL_ONE = 1 << SUBPIXEL_BITS;
+
+//! Triangles are clipped to |x|, |y| <= GUARD_BAND * w rather than to the
+//! viewport, so only those reaching far off screen are cut, and snapped
+//! coordinates stay well inside 32 bits.
+static const F32 GUARD_BAND = 1024.0f;
+
+//! Most vertices a triangle can have after clipping to six planes.
+static const U8 MAX_CLIP_VERTEX_COUNT = 9u;
+
+////////////////////////////////////////////////////////////////////////////////
+//! A triangle or point set up for rasterization, in snapped image coordinates
+//! with y growing downwards.
+////////////////////////////////////////////////////////////////////////////////
+struct RasterPrimitive
+{
+  S32 X[3];
+  S32 Y[3];
+  //! Pixels whose centers may be covered, inclusive.
+  S32 MinX;
+  S32 MinY;
+  S32 MaxX;
+  S32 MaxY;
+  //! Twice the area, in squared sub-pixels; positive.
+  S64 Area;
+  //! Depth in [0,1], 1/w, and color divided by w, of each vertex.
+  F32 Depth[3];
+  F32 InverseW[3];
+  F32 Color[3][4];
+  bool IsPoint;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//! Image, depth buffer and queued primitives.
+////////////////////////////////////////////////////////////////////////////////
+struct SoftwareRasterizer::Frame
+{
+  U32 Width;
+  U32 Height;
+  U32 TileColumnCount;
+  U32 TileRowCount;
+  std::vector<U8> Image;
+  std::vector<F32> Depth;
+  std::vector<RasterPrimitive> Primitives;
+  //! Primitives touching each tile, in submission order.
+  std::vector< std::vector<U32> > Bins;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//! State shared by the worker threads of one call to Finish().
+////////////////////////////////////////////////////////////////////////////////
+struct SoftwareRasterizer::Job
+{
+  const Frame * Pending;
+  U32 TileCount;
+  //! Index of the next tile to be claimed by a worker.
+  std::atomic<U32> NextTile;
+  std::atomic<U64> FragmentCount;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the seconds elapsed between two clock readings.
+////////////////////////////////////////////////////////////////////////////////
+static
+F64
+Seconds(
+    const Clock::time_point & start,
+    const Clock::time_point & stop
+    ) throw ()
+{
+  return std::chrono::duration<F64>(stop - start).count();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Returns the distance of a clip space vertex inside one of the six planes
+//! of the clip volume, negative outside.
+////////////////////////////////////////////////////////////////////////////////
+static
+F32
+PlaneDistance(
+    const F32 clip[4],
+    U8 plane
+    ) throw ()
+{
+  switch (plane)
+  {
+    case 0:  return clip[3] + clip[2];
+    case 1:  return clip[3] - clip[2];
+    case 2:  return GUARD_BAND * clip[3] + clip[0];
+    case 3:  return GUARD_BAND * clip[3] - clip[0];
+    case 4:  return GUARD_BAND * clip[3] + clip[1];
+    default: return GUARD_BAND * clip[3] - clip[1];
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Reads the components of a vertex attribute into the first Count values of
+//! value[], converting normalized integers as OpenGL does.
+////////////////////////////////////////////////////////////////////////////////
+static
+inline
+void
+ReadAttribute(
+    const VertexFormat::Attribute & attribute,
+    const U8 * data,
+    F32 value[4]
+    ) throw ()
+{
+  for (U8 i = 0; (i < attribute.Count) && (i < 4u); ++i)
+  {
+    switch (attribute.Component)
+    {
+      case VertexFormat::COMPONENT_UNSIGNED_BYTE:
+        value[i] = attribute.IsNormalized ? data[i] / 255.0f : data[i];
+        break;
+      case VertexFormat::COMPONENT_UNSIGNED_SHORT:
+        value[i] = attribute.IsNormalized ? ((const U16 *)data)[i] / 65535.0f : ((const U16 *)data)[i];
+        break;
+      case VertexFormat::COMPONENT_SHORT:
+      {
+        F32 s = ((const S16 *)data)[i];
+        value[i] = attribute.IsNormalized ? ((s < -32767.0f) ? -1.0f : s / 32767.0f) : s;
+        break;
+      }
+      default:
+        value[i] = ((const F32 *)data)[i];
+        break;
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+SoftwareRasterizer::SoftwareRasterizer(
+    ) throw ()
+    : Width(0u)
+    , Height(0u)
+    , ThreadCount(1u)
+    , Pending(nullptr)
+    , Stats()
+{
+  for (U8 i = 0; i < 16u; ++i)
+  {
+    Transform[i] = (0u == i % 5u) ? 1.0f : 0.0f;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+SoftwareRasterizer::~SoftwareRasterizer(
+    ) throw ()
+{
+  delete Pending;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See SoftwareRasterizer.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+SoftwareRasterizer::Initialize(
+    U32 width,
+    U32 height,
+    U32 threadCount
+    ) throw (Exception::Type)
+{
+  if ((0u == width) || (0u == height) || (MAX_WIDTH < width) || (MAX_WIDTH < height))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  if (0u == threadCount)
+  {
+    threadCount = std::thread::hardware_concurrency();
+    if (0u == threadCount) threadCount = 1u;
+  }
+
+  delete Pending;
+  Pending = new Frame();
+
+  Width = width;
+  Height = height;
+  ThreadCount = threadCount;
+
+  Pending->Width = width;
+  Pending->Height = height;
+  Pending->TileColumnCount = (width + TILE_SIZE - 1u) / TILE_SIZE;
+  Pending->TileRowCount = (height + TILE_SIZE - 1u) / TILE_SIZE;
+  Pending->Image.resize(4u * width * height);
+  Pending->Depth.resize(width * height);
+  Pending->Bins.resize(Pending->TileColumnCount * Pending->TileRowCount);
+
+  Clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See SoftwareRasterizer.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+SoftwareRasterizer::SetTransform(
+    const F32 viewProjection[16]
+    ) throw ()
+{
+  if (nullptr != viewProjection)
+  {
+    memcpy(Transform, viewProjection, sizeof(Transform));
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See SoftwareRasterizer.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+SoftwareRasterizer::Clear(
+    ) throw ()
+{
+  if (nullptr == Pending)
+  {
+    return;
+  }
+
+  memset(&Pending->Image[0], 0, Pending->Image.size());
+
+  for (U32 i = 0; i < Pending->Depth.size(); ++i)
+  {
+    Pending->Depth[i] = 1.0f;
+  }
+
+  Pending->Primitives.clear();
+
+  for (U32 i = 0; i < Pending->Bins.size(); ++i)
+  {
+    Pending->Bins[i].clear();
+  }
+
+  Stats = Statistics();
+  Stats.ThreadCount = ThreadCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See SoftwareRasterizer.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+SoftwareRasterizer::Draw(
+    VertexArray::Type type,
+    U8 format,
+    const void * position,
+    const void * color,
+    Size stride,
+    const U32 * index,
+    Size first,
+    Size count
+    ) throw ()
+{
+  if ((nullptr == Pending) || (nullptr == position) || (count <= 0))
+  {
+    return;
+  }
+
+  Clock::time_point start = Clock::now();
+
+  const VertexFormat::Description & description = VertexFormat::Describe(format);
+
+  // Vertices of one primitive in clip space, and their colors.
+  F32 clip[3][4];
+  F32 rgba[3][4];
+  U8 vertexCount = 0u;
+
+  for (Size e = first; e < first + count; ++e)
+  {
+    Size v = (nullptr != index) ? (Size)index[e] : e;
+
+    // A fan's first vertex stays in slot 0 for all its triangles.
+    U8 slot = vertexCount;
+    if ((VertexArray::TYPE_TRIANGLE_FAN == type) && (3u == vertexCount))
+    {
+      memcpy(clip[1], clip[2], sizeof(clip[1]));
+      memcpy(rgba[1], rgba[2], sizeof(rgba[1]));
+      slot = 2u;
+    }
+
+    F32 p[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+    ReadAttribute(description.Position, (const U8 *)position + v * stride, p);
+
+    if (nullptr != color)
+    {
+      rgba[slot][0] = rgba[slot][1] = rgba[slot][2] = 0.0f;
+      rgba[slot][3] = 1.0f;
+      ReadAttribute(description.Color, (const U8 *)color + v * stride, rgba[slot]);
+    }
+    else
+    {
+      rgba[slot][0] = rgba[slot][1] = rgba[slot][2] = rgba[slot][3] = 1.0f;
+    }
+
+    // Elevation vertices hold a direction, and a radius and grey level.
+    if (VertexFormat::D2S16_E2U16 == format)
+    {
+      F32 radius = rgba[slot][0] * VertexElevation::MAX_RADIUS;
+      F32 shade = rgba[slot][1];
+
+      VertexPacking::DecodeOctahedral((const S16 *)((const U8 *)position + v * stride), p);
+      p[0] *= radius;
+      p[1] *= radius;
+      p[2] *= radius;
+      p[3] = 1.0f;
+
+      rgba[slot][0] = rgba[slot][1] = rgba[slot][2] = shade;
+      rgba[slot][3] = 1.0f;
+    }
+
+    for (U8 r = 0; r < 4u; ++r)
+    {
+      clip[slot][r] = Transform[r] * p[0] + Transform[4u + r] * p[1] + Transform[8u + r] * p[2] + Transform[12u + r] * p[3];
+    }
+
+    if (VertexArray::TYPE_POINTS == type)
+    {
+      AddPoint(clip[0], rgba[0]);
+      continue;
+    }
+
+    vertexCount = slot + 1u;
+
+    if (3u == vertexCount)
+    {
+      AddTriangle(clip, rgba);
+
+      if (VertexArray::TYPE_TRIANGLES == type) vertexCount = 0u;
+    }
+  }
+
+  Stats.SetupSeconds += Seconds(start, Clock::now());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Clips a triangle to the view volume and queues the triangles it leaves.
+////////////////////////////////////////////////////////////////////////////////
+void
+SoftwareRasterizer::AddTriangle(
+    const F32 clip[3][4],
+    const F32 color[3][4]
+    ) throw ()
+{
+  // Vertex j of the polygon is clip position polygon[j][0..3] followed by
+  // color polygon[j][4..7].
+  F32 polygon[MAX_CLIP_VERTEX_COUNT][8];
+  U8 polygonCount = 3u;
+
+  for (U8 j = 0; j < 3u; ++j)
+  {
+    memcpy(&polygon[j][0], clip[j], 4u * sizeof(F32));
+    memcpy(&polygon[j][4], color[j], 4u * sizeof(F32));
+  }
+
+  for (U8 plane = 0; plane < 6u; ++plane)
+  {
+    F32 distance[MAX_CLIP_VERTEX_COUNT];
+    U8 insideCount = 0u;
+
+    for (U8 j = 0; j < polygonCount; ++j)
+    {
+      distance[j] = PlaneDistance(polygon[j], plane);
+      if (0.0f <= distance[j]) ++insideCount;
+    }
+
+    if (0u == insideCount)
+    {
+      return;
+    }
+
+    if (insideCount == polygonCount)
+    {
+      continue;
+    }
+
+    F32 clipped[MAX_CLIP_VERTEX_COUNT][8];
+    U8 clippedCount = 0u;
+
+    for (U8 j = 0; j < polygonCount; ++j)
+    {
+      U8 next = (j + 1u) % polygonCount;
+
+      if (0.0f <= distance[j])
+      {
+        memcpy(clipped[clippedCount++], polygon[j], sizeof(polygon[j]));
+      }
+
+      if ((0.0f <= distance[j]) != (0.0f <= distance[next]))
+      {
+        F32 t = distance[j] / (distance[j] - distance[next]);
+
+        for (U8 k = 0; k < 8u; ++k)
+        {
+          clipped[clippedCount][k] = polygon[j][k] + t * (polygon[next][k] - polygon[j][k]);
+        }
+        ++clippedCount;
+      }
+    }
+
+    memcpy(polygon, clipped, clippedCount * sizeof(polygon[0]));
+    polygonCount = clippedCount;
+  }
+
+  // Snap the polygon to the image and queue it as a fan.
+  S32 x[MAX_CLIP_VERTEX_COUNT];
+  S32 y[MAX_CLIP_VERTEX_COUNT];
+  F32 depth[MAX_CLIP_VERTEX_COUNT];
+  F32 inverseW[MAX_CLIP_VERTEX_COUNT];
+
+  for (U8 j = 0; j < polygonCount; ++j)
+  {
+    inverseW[j] = 1.0f / polygon[j][3];
+    x[j] = (S32)lrintf((polygon[j][0] * inverseW[j] + 1.0f) * 0.5f * Width * SUBPIXEL_ONE);
+    y[j] = (S32)lrintf((1.0f - polygon[j][1] * inverseW[j]) * 0.5f * Height * SUBPIXEL_ONE);
+    depth[j] = polygon[j][2] * inverseW[j] * 0.5f + 0.5f;
+  }
+
+  Frame & frame = *Pending;
+
+  for (U8 j = 1; j + 1u < polygonCount; ++j)
+  {
+    U8 v[3] = { 0u, j, (U8)(j + 1u) };
+
+    S64 area = (S64)(x[v[1]] - x[v[0]]) * (y[v[2]] - y[v[0]]) - (S64)(y[v[1]] - y[v[0]]) * (x[v[2]] - x[v[0]]);
+
+    if (0 == area)
+    {
+      continue;
+    }
+
+    if (area < 0)
+    {
+      v[1] = (U8)(j + 1u);
+      v[2] = j;
+      area = -area;
+    }
+
+    RasterPrimitive primitive;
+    primitive.IsPoint = false;
+    primitive.Area = area;
+
+    S32 minX = x[v[0]], maxX = x[v[0]], minY = y[v[0]], maxY = y[v[0]];
+
+    for (U8 k = 0; k < 3u; ++k)
+    {
+      primitive.X[k] = x[v[k]];
+      primitive.Y[k] = y[v[k]];
+      primitive.Depth[k] = depth[v[k]];
+      primitive.InverseW[k] = inverseW[v[k]];
+
+      for (U8 c = 0; c < 4u; ++c)
+      {
+        primitive.Color[k][c] = polygon[v[k]][4u + c] * inverseW[v[k]];
+      }
+
+      if (x[v[k]] < minX) minX = x[v[k]];
+      if (maxX < x[v[k]]) maxX = x[v[k]];
+      if (y[v[k]] < minY) minY = y[v[k]];
+      if (maxY < y[v[k]]) maxY = y[v[k]];
+    }
+
+    // Pixels whose centers, at (p + 1/2) pixels, lie within the bounds.
+    const S32 half = SUBPIXEL_ONE / 2;
+    primitive.MinX = (minX - half + SUBPIXEL_ONE - 1) >> SUBPIXEL_BITS;
+    primitive.MaxX = (maxX - half) >> SUBPIXEL_BITS;
+    primitive.MinY = (minY - half + SUBPIXEL_ONE - 1) >> SUBPIXEL_BITS;
+    primitive.MaxY = (maxY - half) >> SUBPIXEL_BITS;
+
+    if (primitive.MinX < 0) primitive.MinX = 0;
+    if (primitive.MinY < 0) primitive.MinY = 0;
+    if ((S32)Width <= primitive.MaxX) primitive.MaxX = Width - 1;
+    if ((S32)Height <= primitive.MaxY) primitive.MaxY = Height - 1;
+
+    if ((primitive.MaxX < primitive.MinX) || (primitive.MaxY < primitive.MinY))
+    {
+      continue;
+    }
+
+    U32 id = frame.Primitives.size();
+    frame.Primitives.push_back(primitive);
+    Stats.TriangleCount++;
+
+    for (U32 row = primitive.MinY / TILE_SIZE; row <= primitive.MaxY / TILE_SIZE; ++row)
+    {
+      for (U32 column = primitive.MinX / TILE_SIZE; column <= primitive.MaxX / TILE_SIZE; ++column)
+      {
+        frame.Bins[row * frame.TileColumnCount + column].push_back(id);
+        Stats.BinnedCount++;
+      }
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Queues a point as the pixel holding it, if inside the view volume.
+////////////////////////////////////////////////////////////////////////////////
+void
+SoftwareRasterizer::AddPoint(
+    const F32 clip[4],
+    const F32 color[4]
+    ) throw ()
+{
+  for (U8 plane = 0; plane < 2u; ++plane)
+  {
+    if (PlaneDistance(clip, plane) < 0.0f) return;
+  }
+
+  if (clip[3] <= 0.0f)
+  {
+    return;
+  }
+
+  F32 inverseW = 1.0f / clip[3];
+  F32 sx = (clip[0] * inverseW + 1.0f) * 0.5f * Width;
+  F32 sy = (1.0f - clip[1] * inverseW) * 0.5f * Height;
+
+  if (! ((0.0f <= sx) && (sx < Width) && (0.0f <= sy) && (sy < Height)))
+  {
+    return;
+  }
+
+  RasterPrimitive primitive;
+  primitive.IsPoint = true;
+  primitive.MinX = primitive.MaxX = (S32)sx;
+  primitive.MinY = primitive.MaxY = (S32)sy;
+  primitive.Depth[0] = clip[2] * inverseW * 0.5f + 0.5f;
+  memcpy(primitive.Color[0], color, 4u * sizeof(F32));
+
+  Frame & frame = *Pending;
+  frame.Bins[(primitive.MinY / TILE_SIZE) * frame.TileColumnCount + primitive.MinX / TILE_SIZE].push_back(frame.Primitives.size());
+  frame.Primitives.push_back(primitive);
+  Stats.TriangleCount++;
+  Stats.BinnedCount++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See SoftwareRasterizer.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+SoftwareRasterizer::Finish(
+    ) throw ()
+{
+  if ((nullptr == Pending) || Pending->Primitives.empty())
+  {
+    return;
+  }
+
+  Job job;
+  job.Pending = Pending;
+  job.TileCount = Pending->Bins.size();
+  job.NextTile = 0u;
+  job.FragmentCount = 0u;
+
+  U32 threadCount = (ThreadCount < job.TileCount) ? ThreadCount : job.TileCount;
+
+  Clock::time_point start = Clock::now();
+
+  // The calling thread is the last worker.
+  std::vector<std::thread> worker;
+  for (U32 i = 1; i < threadCount; ++i)
+  {
+    worker.push_back(std::thread(Work, &job));
+  }
+
+  Work(&job);
+
+  for (U32 i = 0; i < worker.size(); ++i)
+  {
+    worker[i].join();
+  }
+
+  Stats.RasterSeconds += Seconds(start, Clock::now());
+  Stats.FragmentCount += job.FragmentCount;
+
+  Pending->Primitives.clear();
+
+  for (U32 i = 0; i < Pending->Bins.size(); ++i)
+  {
+    Pending->Bins[i].clear();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Claims tiles until none are left. Tiles own disjoint pixels, so workers
+//! write the image without locking.
+////////////////////////////////////////////////////////////////////////////////
+void
+SoftwareRasterizer::Work(
+    Job * job
+    ) throw ()
+{
+  U64 fragmentCount = 0u;
+
+  for (U32 tile = job->NextTile++; tile < job->TileCount; tile = job->NextTile++)
+  {
+    RasterizeTile(*job->Pending, tile, fragmentCount);
+  }
+
+  job->FragmentCount += fragmentCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Depth tests and writes one fragment.
+////////////////////////////////////////////////////////////////////////////////
+static
+inline
+void
+WriteFragment(
+    U8 * image,
+    F32 * depthBuffer,
+    U32 pixel,
+    F32 depth,
+    const F32 color[4]
+    ) throw ()
+{
+  if (! ((depth < depthBuffer[pixel]) && (0.0f <= depth)))
+  {
+    return;
+  }
+
+  depthBuffer[pixel] = depth;
+
+  for (U8 c = 0; c < 4u; ++c)
+  {
+    F32 value = color[c];
+    if (value < 0.0f) value = 0.0f;
+    if (1.0f < value) value = 1.0f;
+    image[4u * pixel + c] = (U8)(value * 255.0f + 0.5f);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Rasterizes the primitives binned in one tile, in order.
+////////////////////////////////////////////////////////////////////////////////
+void
+SoftwareRasterizer::RasterizeTile(
+    const Frame & frame,
+    U32 tile,
+    U64 & fragmentCount
+    ) throw ()
+{
+  const std::vector<U32> & bin = frame.Bins[tile];
+
+  if (bin.empty())
+  {
+    return;
+  }
+
+  U8 * image = const_cast<U8 *>(&frame.Image[0]);
+  F32 * depthBuffer = const_cast<F32 *>(&frame.Depth[0]);
+
+  const S32 tileMinX = (tile % frame.TileColumnCount) * TILE_SIZE;
+  const S32 tileMinY = (tile / frame.TileColumnCount) * TILE_SIZE;
+  const S32 tileMaxX = tileMinX + TILE_SIZE - 1;
+  const S32 tileMaxY = tileMinY + TILE_SIZE - 1;
+
+  for (U32 b = 0; b < bin.size(); ++b)
+  {
+    const RasterPrimitive & primitive = frame.Primitives[bin[b]];
+
+    if (primitive.IsPoint)
+    {
+      WriteFragment(image, depthBuffer, primitive.MinY * frame.Width + primitive.MinX, primitive.Depth[0], primitive.Color[0]);
+      ++fragmentCount;
+      continue;
+    }
+
+    S32 minX = (primitive.MinX < tileMinX) ? tileMinX : primitive.MinX;
+    S32 maxX = (tileMaxX < primitive.MaxX) ? tileMaxX : primitive.MaxX;
+    S32 minY = (primitive.MinY < tileMinY) ? tileMinY : primitive.MinY;
+    S32 maxY = (tileMaxY < primitive.MaxY) ? tileMaxY : primitive.MaxY;
+
+    // Edge i runs between the two vertices other than i and is positive on
+    // the side of vertex i. A pixel center exactly on an edge belongs to the
+    // triangle for one direction of the edge only, so two triangles sharing
+    // the edge never both draw it.
+    S64 stepX[3], stepY[3], rowEdge[3];
+    S32 centerX = minX * SUBPIXEL_ONE + SUBPIXEL_ONE / 2;
+    S32 centerY = minY * SUBPIXEL_ONE + SUBPIXEL_ONE / 2;
+
+    for (U8 i = 0; i < 3u; ++i)
+    {
+      U8 a = (i + 1u) % 3u;
+      U8 c = (i + 2u) % 3u;
+      S64 dx = primitive.X[c] - primitive.X[a];
+      S64 dy = primitive.Y[c] - primitive.Y[a];
+
+      stepX[i] = -dy * SUBPIXEL_ONE;
+      stepY[i] = dx * SUBPIXEL_ONE;
+      rowEdge[i] = dx * (centerY - primitive.Y[a]) - dy * (centerX - primitive.X[a]);
+
+      bool isOwned = (dy < 0) || ((0 == dy) && (0 < dx));
+      if (! isOwned) rowEdge[i] -= 1;
+    }
+
+    const F32 inverseArea = 1.0f / (F32)primitive.Area;
+
+    for (S32 y = minY; y <= maxY; ++y)
+    {
+      S64 edge[3] = { rowEdge[0], rowEdge[1], rowEdge[2] };
+
+      for (S32 x = minX; x <= maxX; ++x)
+      {
+        if (0 <= (edge[0] | edge[1] | edge[2]))
+        {
+          F32 weight[3] = { edge[0] * inverseArea, edge[1] * inverseArea, edge[2] * inverseArea };
+
+          F32 depth = weight[0] * primitive.Depth[0] + weight[1] * primitive.Depth[1] + weight[2] * primitive.Depth[2];
+          F32 w = 1.0f / (weight[0] * primitive.InverseW[0] + weight[1] * primitive.InverseW[1] + weight[2] * primitive.InverseW[2]);
+
+          F32 color[4];
+          for (U8 c = 0; c < 4u; ++c)
+          {
+            color[c] = (weight[0] * primitive.Color[0][c] + weight[1] * primitive.Color[1][c] + weight[2] * primitive.Color[2][c]) * w;
+          }
+
+          WriteFragment(image, depthBuffer, y * frame.Width + x, depth, color);
+          ++fragmentCount;
+        }
+
+        edge[0] += stepX[0];
+        edge[1] += stepX[1];
+        edge[2] += stepX[2];
+      }
+
+      rowEdge[0] += stepY[0];
+      rowEdge[1] += stepY[1];
+      rowEdge[2] += stepY[2];
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See SoftwareRasterizer.h)
+////////////////////////////////////////////////////////////////////////////////
+U32
+SoftwareRasterizer::GetWidth(
+    ) const throw ()
+{
+  return Width;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See SoftwareRasterizer.h)
+////////////////////////////////////////////////////////////////////////////////
+U32
+SoftwareRasterizer::GetHeight(
+    ) const throw ()
+{
+  return Height;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See SoftwareRasterizer.h)
+////////////////////////////////////////////////////////////////////////////////
+const U8 *
+SoftwareRasterizer::GetImage(
+    ) const throw ()
+{
+  return (nullptr != Pending) ? &Pending->Image[0] : nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See SoftwareRasterizer.h)
+////////////////////////////////////////////////////////////////////////////////
+const F32 *
+SoftwareRasterizer::GetDepth(
+    ) const throw ()
+{
+  return (nullptr != Pending) ? &Pending->Depth[0] : nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See SoftwareRasterizer.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+SoftwareRasterizer::WriteImage(
+    const char * path
+    ) const throw (Exception::Type)
+{
+  if ((nullptr == path) || (nullptr == Pending))
+  {
+    throw (Exception::PARAMETER_ERROR);
+  }
+
+  FILE * file = fopen(path, "wb");
+
+  if (nullptr == file)
+  {
+    throw (Exception::IO_ERROR);
+  }
+
+  bool isWritten = (0 < fprintf(file, "P7\nWIDTH %u\nHEIGHT %u\nDEPTH 4\nMAXVAL 255\nTUPLTYPE RGB_ALPHA\nENDHDR\n", Width, Height));
+  isWritten = isWritten && (fwrite(&Pending->Image[0], 1, Pending->Image.size(), file) == Pending->Image.size());
+  isWritten = (0 == fclose(file)) && isWritten;
+
+  if (! isWritten)
+  {
+    throw (Exception::IO_ERROR);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See SoftwareRasterizer.h)
+////////////////////////////////////////////////////////////////////////////////
+const SoftwareRasterizer::Statistics &
+SoftwareRasterizer::GetStatistics(
+    ) const throw ()
+{
+  return Stats;
+}
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
@@ -0,0 +1,206 @@
+#pragma once
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ * Oct 19, 2026 |---| added compact vertex formats
+ *
+ * ****************************************************************************/
+
+#include "Exception.h"
+#include "NativeTypes.h"
+#include "VertexArray.h"
+
+////////////////////////////////////////////////////////////////////////////////
+//! Draws vertex arrays into an in-memory RGBA image without a GPU, following
+//! the OpenGL conventions RenderContext relies on: positions are taken to clip
+//! space by one matrix, primitives are clipped to the view volume, colors are
+//! interpolated with perspective correction, and a depth buffer cleared to 1
+//! keeps the nearest fragment with GL_LESS.
+//!
+//! Drawing is deferred. Draw() transforms, clips and sets up each triangle and
+//! bins it into every TILE_SIZE x TILE_SIZE tile of the image its bounds
+//! touch. Finish() then rasterizes the tiles on worker threads, each tile's
+//! triangles in submission order, so the image does not depend on the number
+//! of threads. Vertices are snapped to 1/16 pixel and edges are evaluated in
+//! integers with a tie rule giving a pixel on a shared edge to exactly one of
+//! its triangles, so meshes are drawn without cracks or double blending.
+//! Points are drawn as single pixels.
+////////////////////////////////////////////////////////////////////////////////
+class SoftwareRasterizer
+{
+public:
+
+  SoftwareRasterizer(
+      ) throw ();
+
+  ~SoftwareRasterizer(
+      ) throw ();
+
+  static const U32 MAX_WIDTH = 8192u;
+  static const U32 TILE_SIZE = 64u;
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Allocates a width x height image drawn with threadCount threads, zero
+  //! using one per core, and clears it.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  Initialize(
+      U32 width,
+      U32 height,
+      U32 threadCount
+      ) throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Sets the column-major matrix taking positions to clip space for the
+  //! following Draw() calls. It starts as the identity.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  SetTransform(
+      const F32 viewProjection[16]
+      ) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Discards pending primitives and clears the image to transparent black
+  //! and the depth buffer to 1.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  Clear(
+      ) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Queues elements [first, first + count) of a vertex array: vertex indices
+  //! from index[], or consecutive vertices if index is null. position and
+  //! color point at the first vertex's attributes, stride bytes apart, laid
+  //! out as the VertexFormat format gives; a null color draws white.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  Draw(
+      VertexArray::Type type,
+      U8 format,
+      const void * position,
+      const void * color,
+      Size stride,
+      const U32 * index,
+      Size first,
+      Size count
+      ) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Rasterizes every queued primitive into the image.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  Finish(
+      ) throw ();
+
+  U32 GetWidth() const throw ();
+
+  U32 GetHeight() const throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the image, 4 bytes R, G, B, A per pixel, top row first, as of
+  //! the last Finish().
+  //////////////////////////////////////////////////////////////////////////////
+  const U8 *
+  GetImage(
+      ) const throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the depth buffer, top row first, as of the last Finish().
+  //////////////////////////////////////////////////////////////////////////////
+  const F32 *
+  GetDepth(
+      ) const throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Writes the image as a binary RGB_ALPHA PAM file ("P7").
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  WriteImage(
+      const char * path
+      ) const throw (Exception::Type);
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Counts of the last frame, since Clear().
+  //////////////////////////////////////////////////////////////////////////////
+  struct Statistics
+  {
+    U32 ThreadCount;
+    //! Triangles queued after clipping and culling of empty ones.
+    U64 TriangleCount;
+    //! Triangle references across all tile bins.
+    U64 BinnedCount;
+    U64 FragmentCount;
+    F64 SetupSeconds;
+    F64 RasterSeconds;
+  };
+
+  const Statistics &
+  GetStatistics(
+      ) const throw ();
+
+private:
+
+  SoftwareRasterizer(const SoftwareRasterizer &);
+  SoftwareRasterizer & operator=(const SoftwareRasterizer &);
+
+  struct Frame;
+  struct Job;
+
+  void
+  AddTriangle(
+      const F32 clip[3][4],
+      const F32 color[3][4]
+      ) throw ();
+
+  void
+  AddPoint(
+      const F32 clip[4],
+      const F32 color[4]
+      ) throw ();
+
+  static
+  void
+  Work(
+      Job * job
+      ) throw ();
+
+  static
+  void
+  RasterizeTile(
+      const Frame & frame,
+      U32 tile,
+      U64 & fragmentCount
+      ) throw ();
+
+  U32 Width;
+  U32 Height;
+  U32 ThreadCount;
+  F32 Transform[16];
+  //! Primitives, bins and buffers.
+  Frame * Pending;
+  Statistics Stats;
+};
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
@@ -19,14 +19,18 @@
  * Chagne Date        Description
  * -----------------------------------------------------------------------------
  * Aug 19, 2019 |---| added license notice
+ * Oct 19, 2026 |---| added compact vertex formats
  *
  * ****************************************************************************/
 
 #include "ColorRGBA.h"
 #include "Vector.h"
+#include "VertexFormat.h"
 
 struct Vertex
 {
+  static const U8 FORMAT = VertexFormat::P4F_C4F;
+
   Vector    Position;   //! Position of vertex in model space.
   ColorRGBA Color;      //! Color of vertex.
 
@@ -86,6 +90,38 @@ struct Vertex
     return *this;
   }
 
+  //////////////////////////////////////////////////////////////////////////////
+  //! Sets the vertex as the layouts of VertexLayouts.h are set. Vertex keeps
+  //! no normal.
+  //////////////////////////////////////////////////////////////////////////////
+  inline
+  void
+  Set(
+      const Vector & position,
+      const Vector & /*normal*/,
+      const ColorRGBA & color
+      ) throw ()
+  {
+    Position = position;
+    Color = color;
+  }
+
+  inline
+  Vector
+  GetPosition(
+      ) const throw ()
+  {
+    return Position;
+  }
+
+  inline
+  ColorRGBA
+  GetColor(
+      ) const throw ()
+  {
+    return Color;
+  }
+
   inline
   Size
   GetGLVertexSize(
@@ -18,12 +18,17 @@
  * Chagne Date        Description
  * -----------------------------------------------------------------------------
  * Aug 19, 2019 |---| added license notice
+ * Oct 19, 2026 |---| added indexed triangle lists
+ * Oct 19, 2026 |---| added compact vertex formats
+ * Oct 19, 2026 |---| build without OpenGL under TESTING
  *
  * ****************************************************************************/
 
 #include "VertexArray.h"
 
+#ifndef TESTING
 #include <OpenGL/gl3.h>
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 // (See VertexArray.h)
@@ -43,6 +48,26 @@ VertexArray::~VertexArray(
 {
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// (See VertexArray.h)
+////////////////////////////////////////////////////////////////////////////////
+U8
+VertexArray::GetFormat(
+    ) const throw ()
+{
+  return VertexFormat::P4F_C4F;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See VertexArray.h)
+////////////////////////////////////////////////////////////////////////////////
+const U32 *
+VertexArray::GetIndexPointer(
+    ) const throw ()
+{
+  return nullptr;
+}
+
 /* *****************************************************************************
  *
  * Copyright (C) 2014, 2019 by owner of https://github.com/JDubs-S.
@@ -19,12 +19,15 @@
  * Chagne Date        Description
  * -----------------------------------------------------------------------------
  * Aug 19, 2019 |---| added license notice
+ * Oct 19, 2026 |---| added indexed triangle lists
+ * Oct 19, 2026 |---| added compact vertex formats
  *
  * ****************************************************************************/
 
 #include "Exception.h"
 #include "NativeTypes.h"
 #include "Vertex.h"
+#include "VertexFormat.h"
 
 class RenderContext;
 
@@ -35,7 +38,8 @@ public:
   enum Type
   {
     TYPE_POINTS,
-    TYPE_TRIANGLE_FAN
+    TYPE_TRIANGLE_FAN,
+    TYPE_TRIANGLES
   };
 
   VertexArray(
@@ -66,7 +70,7 @@ protected:
       ) const throw () = 0;
 
   virtual
-  const F32 *
+  const void *
   GetGLVertexPointer(
       ) const throw () = 0;
 
@@ -76,7 +80,7 @@ protected:
       ) const throw () = 0;
 
   virtual
-  const F32 *
+  const void *
   GetGLColorPointer(
       ) const throw () = 0;
 
@@ -86,7 +90,7 @@ protected:
       ) const throw () = 0;
 
   virtual
-  const F32 *
+  const void *
   GetGLNormalPointer(
       ) const throw () = 0;
 
@@ -96,10 +100,29 @@ protected:
       ) const throw () = 0;
 
   virtual
-  const F32 *
+  const void *
   GetGLTextureCoordinatePointer(
       ) const throw () = 0;
 
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the VertexFormat of the vertices, which gives the component
+  //! types and counts of the pointers above. Arrays of Vertex need not
+  //! override it.
+  //////////////////////////////////////////////////////////////////////////////
+  virtual
+  U8
+  GetFormat(
+      ) const throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the indices of the vertices to draw, GetDrawCount() of them, or
+  //! null to draw the first GetDrawCount() vertices in order.
+  //////////////////////////////////////////////////////////////////////////////
+  virtual
+  const U32 *
+  GetIndexPointer(
+      ) const throw ();
+
 private:
 
   Type DrawType;
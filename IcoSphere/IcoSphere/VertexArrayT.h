@@ -19,14 +19,20 @@
  * Chagne Date        Description
  * -----------------------------------------------------------------------------
  * Aug 19, 2019 |---| added license notice
+ * Oct 19, 2026 |---| added compact vertex formats
  *
  * ****************************************************************************/
 
 #include "Vector.h"
 #include "Vertex.h"
 #include "VertexArray.h"
+#include "VertexFormat.h"
 
-template<Size MAX_VERTEX_COUNT>
+////////////////////////////////////////////////////////////////////////////////
+//! A vertex array of up to MAX_VERTEX_COUNT vertices of type LAYOUT: Vertex,
+//! or one of the compact layouts of VertexLayouts.h.
+////////////////////////////////////////////////////////////////////////////////
+template<Size MAX_VERTEX_COUNT, typename LAYOUT = Vertex>
 class VertexArrayT : public VertexArray
 {
 public:
@@ -46,7 +52,7 @@ public:
   }
 
   inline
-  const Vertex &
+  const LAYOUT &
   operator[](
       Size i
       ) const throw ()
@@ -69,11 +75,24 @@ public:
   void AddVertex(
       const Vector & pos
       ) throw ()
+  {
+    AddVertex(pos, pos);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Adds a vertex of the current Color with a normal, which only layouts
+  //! having one keep. AddVertex(pos) takes the position as the normal, which
+  //! is the sphere's.
+  //////////////////////////////////////////////////////////////////////////////
+  inline
+  void AddVertex(
+      const Vector & pos,
+      const Vector & normal
+      ) throw ()
   {
     if (DrawCount < MAX_VERTEX_COUNT)
     {
-      Array[DrawCount].Position = pos;
-      Array[DrawCount].Color = Color;
+      Array[DrawCount].Set(pos, normal, Color);
     }
     DrawCount++;
   }
@@ -93,17 +112,17 @@ protected:
   GetStride(
       ) const throw ()
   {
-    return sizeof(Vertex);
+    return sizeof(LAYOUT);
   }
 
   Size
   GetGLVertexSize(
       ) const throw ()
   {
-    return Array[0].GetGLVertexSize();
+    return VertexFormat::Describe(LAYOUT::FORMAT).Position.Count;
   }
 
-  const F32 *
+  const void *
   GetGLVertexPointer(
       ) const throw ()
   {
@@ -114,10 +133,10 @@ protected:
   GetGLColorSize(
       ) const throw ()
   {
-    return Array[0].GetGLColorSize();
+    return VertexFormat::Describe(LAYOUT::FORMAT).Color.Count;
   }
 
-  const F32 *
+  const void *
   GetGLColorPointer(
       ) const throw ()
   {
@@ -128,10 +147,10 @@ protected:
   GetGLNormalSize(
       ) const throw ()
   {
-    return Array[0].GetGLNormalSize();
+    return VertexFormat::Describe(LAYOUT::FORMAT).Normal.Count;
   }
 
-  const F32 *
+  const void *
   GetGLNormalPointer(
       ) const throw ()
   {
@@ -142,31 +161,38 @@ protected:
   GetGLTextureCoordinateSize(
       ) const throw ()
   {
-    return Array[0].GetGLTextureCoordinateSize();
+    return 0;
   }
 
-  const F32 *
+  const void *
   GetGLTextureCoordinatePointer(
       ) const throw ()
   {
-    return Array[0].GetGLTextureCoordinatePointer();
+    return nullptr;
+  }
+
+  U8
+  GetFormat(
+      ) const throw ()
+  {
+    return LAYOUT::FORMAT;
   }
 
 private:
 
   Size DrawCount;
 
-  Vertex Array[MAX_VERTEX_COUNT];
+  LAYOUT Array[MAX_VERTEX_COUNT];
 
 private:
 
   VertexArrayT(
-      const VertexArrayT<MAX_VERTEX_COUNT> &
+      const VertexArrayT<MAX_VERTEX_COUNT, LAYOUT> &
       ) throw ();
 
-  VertexArrayT<MAX_VERTEX_COUNT> &
+  VertexArrayT<MAX_VERTEX_COUNT, LAYOUT> &
   operator=(
-      const VertexArrayT<MAX_VERTEX_COUNT> &
+      const VertexArrayT<MAX_VERTEX_COUNT, LAYOUT> &
       ) throw ();
 
 } __attribute__((packed));
@@ -0,0 +1,331 @@
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ *
+ * ****************************************************************************/
+
+#include <vector>
+
+#include "VertexCacheOptimizer.h"
+
+//! Marks a vertex without a number.
+static const U32 NONE = 0xFFFFFFFFu;
+
+////////////////////////////////////////////////////////////////////////////////
+//! Working storage of OptimizeTriangles(). Vertices of the range being
+//! reordered are numbered locally, 0 to the number of distinct vertices.
+////////////////////////////////////////////////////////////////////////////////
+struct VertexCacheOptimizer::Scratch
+{
+  //! Local number of each mesh vertex, NONE outside OptimizeTriangles().
+  std::vector<U32> LocalID;
+  //! Mesh vertex of each local vertex.
+  std::vector<U32> GlobalID;
+  //! Triangles using each local vertex: AdjacentTriangle[AdjacentFirst[v]]
+  //! onwards.
+  std::vector<U32> AdjacentFirst;
+  std::vector<U32> AdjacentTriangle;
+  //! Triangles not yet emitted using each local vertex.
+  std::vector<U32> LiveCount;
+  //! Time each local vertex last entered the cache.
+  std::vector<U32> CacheTime;
+  std::vector<bool> IsEmitted;
+  //! Vertices recently emitted, to restart from when a fan runs out.
+  std::vector<U32> DeadEnd;
+  std::vector<U32> Candidate;
+  std::vector<U32> Output;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// (See VertexCacheOptimizer.h)
+////////////////////////////////////////////////////////////////////////////////
+VertexCacheOptimizer::VertexCacheOptimizer(
+    ) throw ()
+    : Work(new Scratch())
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See VertexCacheOptimizer.h)
+////////////////////////////////////////////////////////////////////////////////
+VertexCacheOptimizer::~VertexCacheOptimizer(
+    ) throw ()
+{
+  delete Work;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See VertexCacheOptimizer.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+VertexCacheOptimizer::OptimizeTriangles(
+    U32 index[],
+    U32 indexCount,
+    U32 vertexCount,
+    U32 cacheSize
+    ) throw ()
+{
+  const U32 triangleCount = indexCount / 3u;
+
+  if ((nullptr == index) || (triangleCount < 2u))
+  {
+    return;
+  }
+
+  Scratch & s = *Work;
+
+  if (s.LocalID.size() < vertexCount)
+  {
+    s.LocalID.resize(vertexCount, NONE);
+  }
+
+  // Number the vertices of the range locally.
+  s.GlobalID.clear();
+
+  for (U32 i = 0; i < 3u * triangleCount; ++i)
+  {
+    U32 & local = s.LocalID[index[i]];
+
+    if (NONE == local)
+    {
+      local = s.GlobalID.size();
+      s.GlobalID.push_back(index[i]);
+    }
+  }
+
+  const U32 localCount = s.GlobalID.size();
+
+  s.LiveCount.assign(localCount, 0u);
+  s.AdjacentFirst.assign(localCount + 1u, 0u);
+
+  for (U32 i = 0; i < 3u * triangleCount; ++i)
+  {
+    s.LiveCount[s.LocalID[index[i]]]++;
+  }
+
+  for (U32 v = 0; v < localCount; ++v)
+  {
+    s.AdjacentFirst[v + 1u] = s.AdjacentFirst[v] + s.LiveCount[v];
+  }
+
+  // AdjacentFirst[v + 1] counts up to the end of v's triangles as they are
+  // filled in, then is the start of v + 1's again.
+  s.AdjacentTriangle.resize(3u * triangleCount);
+
+  for (U32 t = 0; t < triangleCount; ++t)
+  {
+    for (U8 k = 0; k < 3u; ++k)
+    {
+      U32 v = s.LocalID[index[3u * t + k]];
+      s.AdjacentTriangle[s.AdjacentFirst[v + 1u] - s.LiveCount[v]] = t;
+      s.LiveCount[v]--;
+    }
+  }
+
+  for (U32 i = 0; i < 3u * triangleCount; ++i)
+  {
+    s.LiveCount[s.LocalID[index[i]]]++;
+  }
+
+  s.CacheTime.assign(localCount, 0u);
+  s.IsEmitted.assign(triangleCount, false);
+  s.DeadEnd.clear();
+  s.Output.clear();
+
+  U32 time = cacheSize + 1u;
+  U32 cursor = 0u;
+  U32 fan = s.LocalID[index[0]];
+
+  while (NONE != fan)
+  {
+    s.Candidate.clear();
+
+    // Emit the triangles left around the fanning vertex.
+    for (U32 a = s.AdjacentFirst[fan]; a < s.AdjacentFirst[fan + 1u]; ++a)
+    {
+      U32 t = s.AdjacentTriangle[a];
+
+      if (s.IsEmitted[t])
+      {
+        continue;
+      }
+
+      for (U8 k = 0; k < 3u; ++k)
+      {
+        U32 v = s.LocalID[index[3u * t + k]];
+
+        s.Output.push_back(index[3u * t + k]);
+        s.DeadEnd.push_back(v);
+        s.Candidate.push_back(v);
+        s.LiveCount[v]--;
+
+        if (cacheSize < time - s.CacheTime[v])
+        {
+          s.CacheTime[v] = time++;
+        }
+      }
+
+      s.IsEmitted[t] = true;
+    }
+
+    // Fan next around the candidate still in the cache, with triangles left,
+    // that entered it earliest, as long as fanning around it keeps it there.
+    fan = NONE;
+    S64 bestPriority = -1;
+
+    for (U32 c = 0; c < s.Candidate.size(); ++c)
+    {
+      U32 v = s.Candidate[c];
+
+      if (0u < s.LiveCount[v])
+      {
+        S64 age = (S64)time - s.CacheTime[v];
+        S64 priority = (age + 2 * (S64)s.LiveCount[v] <= (S64)cacheSize) ? age : 0;
+
+        if (bestPriority < priority)
+        {
+          bestPriority = priority;
+          fan = v;
+        }
+      }
+    }
+
+    // Otherwise restart from a recently used vertex, or the next in order.
+    while ((NONE == fan) && ! s.DeadEnd.empty())
+    {
+      U32 v = s.DeadEnd.back();
+      s.DeadEnd.pop_back();
+
+      if (0u < s.LiveCount[v]) fan = v;
+    }
+
+    while ((NONE == fan) && (cursor < localCount))
+    {
+      if (0u < s.LiveCount[cursor]) fan = cursor;
+      ++cursor;
+    }
+  }
+
+  for (U32 i = 0; i < 3u * triangleCount; ++i)
+  {
+    index[i] = s.Output[i];
+  }
+
+  for (U32 v = 0; v < localCount; ++v)
+  {
+    s.LocalID[s.GlobalID[v]] = NONE;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See VertexCacheOptimizer.h)
+////////////////////////////////////////////////////////////////////////////////
+void
+VertexCacheOptimizer::OptimizeVertices(
+    U32 index[],
+    U32 indexCount,
+    U32 vertexCount,
+    U32 remap[]
+    ) throw ()
+{
+  for (U32 v = 0; v < vertexCount; ++v)
+  {
+    remap[v] = NONE;
+  }
+
+  U32 next = 0u;
+
+  for (U32 i = 0; i < indexCount; ++i)
+  {
+    U32 & vertex = remap[index[i]];
+
+    if (NONE == vertex)
+    {
+      vertex = next++;
+    }
+
+    index[i] = vertex;
+  }
+
+  for (U32 v = 0; v < vertexCount; ++v)
+  {
+    if (NONE == remap[v])
+    {
+      remap[v] = next++;
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// (See VertexCacheOptimizer.h)
+////////////////////////////////////////////////////////////////////////////////
+VertexCacheOptimizer::Statistics
+VertexCacheOptimizer::Measure(
+    const U32 index[],
+    U32 indexCount,
+    U32 cacheSize
+    ) throw ()
+{
+  Statistics stats = Statistics();
+  stats.TriangleCount = indexCount / 3u;
+
+  if ((nullptr == index) || (0u == stats.TriangleCount))
+  {
+    return stats;
+  }
+
+  U32 maxIndex = 0u;
+
+  for (U32 i = 0; i < 3u * stats.TriangleCount; ++i)
+  {
+    if (maxIndex < index[i]) maxIndex = index[i];
+  }
+
+  // A FIFO cache holds the last cacheSize vertices that missed, so a vertex
+  // is cached while fewer than cacheSize misses followed its own.
+  std::vector<U32> missNumber(maxIndex + 1u, NONE);
+
+  for (U32 i = 0; i < 3u * stats.TriangleCount; ++i)
+  {
+    U32 & miss = missNumber[index[i]];
+
+    if (NONE == miss)
+    {
+      stats.VertexCount++;
+    }
+
+    if ((NONE == miss) || (cacheSize <= stats.TransformCount - miss))
+    {
+      miss = stats.TransformCount++;
+    }
+  }
+
+  stats.Acmr = (F64)stats.TransformCount / stats.TriangleCount;
+  stats.Atvr = (F64)stats.TransformCount / stats.VertexCount;
+
+  return stats;
+}
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
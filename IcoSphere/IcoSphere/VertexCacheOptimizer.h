@@ -0,0 +1,126 @@
+#pragma once
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ *
+ * ****************************************************************************/
+
+#include "NativeTypes.h"
+
+////////////////////////////////////////////////////////////////////////////////
+//! Reorders indexed triangle lists for the GPU's post-transform vertex cache
+//! and its vertex fetches, and measures how well a list uses the cache.
+//!
+//! OptimizeTriangles() is Tipsify (Sander, Nehab and Barczak, "Fast Triangle
+//! Reordering for Vertex Locality and Reduced Overdraw", 2007): it fans around
+//! one vertex at a time, choosing the next among the vertices just emitted the
+//! one with triangles left that entered the cache earliest, as long as fanning
+//! around it would keep it in the cache. It runs in time linear in the number
+//! of indices and keeps each triangle's winding.
+//! OptimizeVertices() then renumbers the vertices in order of first use, so
+//! vertices are fetched from memory mostly in order.
+//!
+//! Measure() simulates a FIFO cache of cacheSize vertices and reports
+//!
+//!   ACMR   average cache miss ratio, vertices transformed per triangle: 3 for
+//!          no reuse, about 0.5 at best for a regular mesh
+//!   ATVR   average transform to vertex ratio, vertices transformed per
+//!          vertex referenced: 1 at best
+////////////////////////////////////////////////////////////////////////////////
+class VertexCacheOptimizer
+{
+public:
+
+  //! Cache size optimized for when none is given; reorderings for 16 do well
+  //! on larger caches too.
+  static const U32 DEFAULT_CACHE_SIZE = 16u;
+
+  VertexCacheOptimizer(
+      ) throw ();
+
+  ~VertexCacheOptimizer(
+      ) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Reorders the indexCount / 3 triangles of index[], whose indices are less
+  //! than vertexCount. Working storage is kept between calls, so one optimizer
+  //! may reorder many ranges of a mesh cheaply, each in place.
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  OptimizeTriangles(
+      U32 index[],
+      U32 indexCount,
+      U32 vertexCount,
+      U32 cacheSize = DEFAULT_CACHE_SIZE
+      ) throw ();
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Renumbers vertices in order of first use in index[], rewriting index[],
+  //! and sets remap[v] to the new number of old vertex v for each of the
+  //! vertexCount vertices. Unused vertices are numbered last.
+  //////////////////////////////////////////////////////////////////////////////
+  static
+  void
+  OptimizeVertices(
+      U32 index[],
+      U32 indexCount,
+      U32 vertexCount,
+      U32 remap[]
+      ) throw ();
+
+  struct Statistics
+  {
+    U32 TriangleCount;
+    //! Distinct vertices referenced.
+    U32 VertexCount;
+    //! Vertices transformed, that is cache misses.
+    U32 TransformCount;
+    F64 Acmr;
+    F64 Atvr;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Measures index[] drawn through a FIFO cache of cacheSize vertices.
+  //////////////////////////////////////////////////////////////////////////////
+  static
+  Statistics
+  Measure(
+      const U32 index[],
+      U32 indexCount,
+      U32 cacheSize = DEFAULT_CACHE_SIZE
+      ) throw ();
+
+private:
+
+  VertexCacheOptimizer(const VertexCacheOptimizer &);
+  VertexCacheOptimizer & operator=(const VertexCacheOptimizer &);
+
+  struct Scratch;
+
+  //! Working storage of OptimizeTriangles().
+  Scratch * Work;
+};
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
@@ -0,0 +1,109 @@
+#pragma once
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ * Oct 19, 2026 |---| build clean with -Wextra
+ *
+ * ****************************************************************************/
+
+#include "NativeTypes.h"
+
+////////////////////////////////////////////////////////////////////////////////
+//! Identifies how the vertices of an array are laid out, and describes the
+//! vertex attributes of each layout the way glVertexAttribPointer() takes
+//! them. The layouts themselves are Vertex and those of VertexLayouts.h.
+////////////////////////////////////////////////////////////////////////////////
+struct VertexFormat
+{
+  enum Type
+  {
+    //! Vertex: 4 float position, 4 float color. 32 bytes.
+    P4F_C4F,
+    //! VertexP3C8: 3 float position, RGBA8 color. 16 bytes.
+    P3F_C4U8,
+    //! VertexP3C16: 3 float position, 16-bit RGBA color. 20 bytes.
+    P3F_C4U16,
+    //! VertexP3N2C8: 3 float position, octahedral normal, RGBA8 color.
+    //! 20 bytes.
+    P3F_N2S16_C4U8,
+    //! VertexElevation: octahedral unit direction, then radius and grey level
+    //! in the color attribute. The position is the direction times the radius,
+    //! which a shader (or the software rasterizer) has to reconstruct.
+    //! 8 bytes.
+    D2S16_E2U16,
+    COUNT
+  };
+
+  enum Component
+  {
+    COMPONENT_NONE,
+    COMPONENT_FLOAT,
+    COMPONENT_UNSIGNED_BYTE,
+    COMPONENT_UNSIGNED_SHORT,
+    COMPONENT_SHORT
+  };
+
+  struct Attribute
+  {
+    U8 Component;
+    //! Number of components, zero when the layout lacks the attribute.
+    U8 Count;
+    //! True when integers are mapped to [0,1], or [-1,1] if signed.
+    bool IsNormalized;
+  };
+
+  struct Description
+  {
+    Attribute Position;
+    Attribute Color;
+    Attribute Normal;
+    //! Size of one vertex in bytes.
+    U8 Stride;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Returns the description of a format, that of P4F_C4F if it is unknown.
+  //////////////////////////////////////////////////////////////////////////////
+  static
+  inline
+  const Description &
+  Describe(
+      U8 format
+      ) throw ()
+  {
+    static const Description DESCRIPTION[COUNT] =
+    {
+      { { COMPONENT_FLOAT, 4u, false }, { COMPONENT_FLOAT, 4u, false },          { COMPONENT_NONE, 0u, false },  32u },
+      { { COMPONENT_FLOAT, 3u, false }, { COMPONENT_UNSIGNED_BYTE, 4u, true },   { COMPONENT_NONE, 0u, false },  16u },
+      { { COMPONENT_FLOAT, 3u, false }, { COMPONENT_UNSIGNED_SHORT, 4u, true },  { COMPONENT_NONE, 0u, false },  20u },
+      { { COMPONENT_FLOAT, 3u, false }, { COMPONENT_UNSIGNED_BYTE, 4u, true },   { COMPONENT_SHORT, 2u, true },  20u },
+      { { COMPONENT_SHORT, 2u, true },  { COMPONENT_UNSIGNED_SHORT, 2u, true },  { COMPONENT_NONE, 0u, false },  8u },
+    };
+
+    return DESCRIPTION[(format < COUNT) ? format : (U8)P4F_C4F];
+  }
+};
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
@@ -0,0 +1,383 @@
+#pragma once
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 Jason William Staiert. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, see <https://www.gnu.org/licenses>.
+ *
+ * Chagne Date        Description
+ * -----------------------------------------------------------------------------
+ * Oct 19, 2026 |---| initial version
+ * Oct 19, 2026 |---| build clean with -Wextra
+ *
+ * ****************************************************************************/
+
+#include "ColorRGBA.h"
+#include "Math.h"
+#include "NativeTypes.h"
+#include "Vector.h"
+#include "VertexFormat.h"
+
+////////////////////////////////////////////////////////////////////////////////
+//! Conversions between floats and the packed components of the compact vertex
+//! layouts.
+////////////////////////////////////////////////////////////////////////////////
+struct VertexPacking
+{
+  //! Maps [0,1] to [0,255], rounding and clamping.
+  static
+  inline
+  U8
+  ToU8(
+      F32 value
+      ) throw ()
+  {
+    return (value <= 0.0f) ? 0u : (1.0f <= value) ? 255u : (U8)(value * 255.0f + 0.5f);
+  }
+
+  //! Maps [0,1] to [0,65535], rounding and clamping.
+  static
+  inline
+  U16
+  ToU16(
+      F32 value
+      ) throw ()
+  {
+    return (value <= 0.0f) ? 0u : (1.0f <= value) ? 65535u : (U16)(value * 65535.0f + 0.5f);
+  }
+
+  //! Maps [-1,1] to [-32767,32767], rounding and clamping.
+  static
+  inline
+  S16
+  ToS16(
+      F32 value
+      ) throw ()
+  {
+    return (value <= -1.0f) ? -32767 : (1.0f <= value) ? 32767 : (S16)(value * 32767.0f + ((value < 0.0f) ? -0.5f : 0.5f));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Encodes a direction as a point of the unit octahedron unfolded onto the
+  //! square [-1,1]^2: two signed 16-bit values, accurate to about 0.005
+  //! degrees everywhere on the sphere.
+  //////////////////////////////////////////////////////////////////////////////
+  static
+  inline
+  void
+  EncodeOctahedral(
+      F32 x,
+      F32 y,
+      F32 z,
+      S16 encoded[2]
+      ) throw ()
+  {
+    F32 ax = (x < 0.0f) ? -x : x;
+    F32 ay = (y < 0.0f) ? -y : y;
+    F32 az = (z < 0.0f) ? -z : z;
+    F32 sum = ax + ay + az;
+
+    if (0.0f == sum)
+    {
+      encoded[0] = encoded[1] = 0;
+      return;
+    }
+
+    F32 u = x / sum;
+    F32 v = y / sum;
+
+    // The lower half folds over the diagonals onto the corners.
+    if (z < 0.0f)
+    {
+      F32 foldU = (1.0f - ay / sum) * ((x < 0.0f) ? -1.0f : 1.0f);
+      F32 foldV = (1.0f - ax / sum) * ((y < 0.0f) ? -1.0f : 1.0f);
+      u = foldU;
+      v = foldV;
+    }
+
+    encoded[0] = ToS16(u);
+    encoded[1] = ToS16(v);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Decodes an octahedral direction into a unit vector.
+  //////////////////////////////////////////////////////////////////////////////
+  static
+  inline
+  void
+  DecodeOctahedral(
+      const S16 encoded[2],
+      F32 direction[3]
+      ) throw ()
+  {
+    F32 u = encoded[0] * (1.0f / 32767.0f);
+    F32 v = encoded[1] * (1.0f / 32767.0f);
+    F32 au = (u < 0.0f) ? -u : u;
+    F32 av = (v < 0.0f) ? -v : v;
+    F32 z = 1.0f - au - av;
+
+    if (z < 0.0f)
+    {
+      F32 foldU = (1.0f - av) * ((u < 0.0f) ? -1.0f : 1.0f);
+      F32 foldV = (1.0f - au) * ((v < 0.0f) ? -1.0f : 1.0f);
+      u = foldU;
+      v = foldV;
+    }
+
+    F32 length = Math::SquareRoot(u * u + v * v + z * z);
+    direction[0] = u / length;
+    direction[1] = v / length;
+    direction[2] = z / length;
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//! Compact alternatives to Vertex for VertexArrayT. Each layout has the same
+//! members: FORMAT, Set() from a float position, normal and color, decoding
+//! GetPosition() and GetColor(), and the GL attribute pointers. Positions drop
+//! W, which OpenGL fills in as 1, and colors are normalized integers OpenGL
+//! converts back to floats, so the shaders drawing Vertex draw them as well.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+//! 3 float position, RGBA8 color. 16 bytes.
+////////////////////////////////////////////////////////////////////////////////
+struct VertexP3C8
+{
+  static const U8 FORMAT = VertexFormat::P3F_C4U8;
+
+  F32 Position[3];
+  U8 Color[4];
+
+  inline
+  void
+  Set(
+      const Vector & position,
+      const Vector & /*normal*/,
+      const ColorRGBA & color
+      ) throw ()
+  {
+    Position[0] = position.X;
+    Position[1] = position.Y;
+    Position[2] = position.Z;
+    Color[0] = VertexPacking::ToU8(color.R);
+    Color[1] = VertexPacking::ToU8(color.G);
+    Color[2] = VertexPacking::ToU8(color.B);
+    Color[3] = VertexPacking::ToU8(color.A);
+  }
+
+  inline
+  Vector
+  GetPosition(
+      ) const throw ()
+  {
+    return Vector(Position[0], Position[1], Position[2]);
+  }
+
+  inline
+  ColorRGBA
+  GetColor(
+      ) const throw ()
+  {
+    return ColorRGBA(Color[0] / 255.0f, Color[1] / 255.0f, Color[2] / 255.0f, Color[3] / 255.0f);
+  }
+
+  inline const void * GetGLVertexPointer() const throw () { return Position; }
+  inline const void * GetGLColorPointer() const throw () { return Color; }
+  inline const void * GetGLNormalPointer() const throw () { return nullptr; }
+} __attribute__((packed));
+
+////////////////////////////////////////////////////////////////////////////////
+//! 3 float position, 16-bit RGBA color. 20 bytes.
+////////////////////////////////////////////////////////////////////////////////
+struct VertexP3C16
+{
+  static const U8 FORMAT = VertexFormat::P3F_C4U16;
+
+  F32 Position[3];
+  U16 Color[4];
+
+  inline
+  void
+  Set(
+      const Vector & position,
+      const Vector & /*normal*/,
+      const ColorRGBA & color
+      ) throw ()
+  {
+    Position[0] = position.X;
+    Position[1] = position.Y;
+    Position[2] = position.Z;
+    Color[0] = VertexPacking::ToU16(color.R);
+    Color[1] = VertexPacking::ToU16(color.G);
+    Color[2] = VertexPacking::ToU16(color.B);
+    Color[3] = VertexPacking::ToU16(color.A);
+  }
+
+  inline
+  Vector
+  GetPosition(
+      ) const throw ()
+  {
+    return Vector(Position[0], Position[1], Position[2]);
+  }
+
+  inline
+  ColorRGBA
+  GetColor(
+      ) const throw ()
+  {
+    return ColorRGBA(Color[0] / 65535.0f, Color[1] / 65535.0f, Color[2] / 65535.0f, Color[3] / 65535.0f);
+  }
+
+  inline const void * GetGLVertexPointer() const throw () { return Position; }
+  inline const void * GetGLColorPointer() const throw () { return Color; }
+  inline const void * GetGLNormalPointer() const throw () { return nullptr; }
+} __attribute__((packed));
+
+////////////////////////////////////////////////////////////////////////////////
+//! 3 float position, octahedral normal, RGBA8 color. 20 bytes.
+////////////////////////////////////////////////////////////////////////////////
+struct VertexP3N2C8
+{
+  static const U8 FORMAT = VertexFormat::P3F_N2S16_C4U8;
+
+  F32 Position[3];
+  S16 Normal[2];
+  U8 Color[4];
+
+  inline
+  void
+  Set(
+      const Vector & position,
+      const Vector & normal,
+      const ColorRGBA & color
+      ) throw ()
+  {
+    Position[0] = position.X;
+    Position[1] = position.Y;
+    Position[2] = position.Z;
+    S16 encoded[2];
+    VertexPacking::EncodeOctahedral(normal.X, normal.Y, normal.Z, encoded);
+    Normal[0] = encoded[0];
+    Normal[1] = encoded[1];
+    Color[0] = VertexPacking::ToU8(color.R);
+    Color[1] = VertexPacking::ToU8(color.G);
+    Color[2] = VertexPacking::ToU8(color.B);
+    Color[3] = VertexPacking::ToU8(color.A);
+  }
+
+  inline
+  Vector
+  GetPosition(
+      ) const throw ()
+  {
+    return Vector(Position[0], Position[1], Position[2]);
+  }
+
+  inline
+  Vector
+  GetNormal(
+      ) const throw ()
+  {
+    // Copied out, the members being unaligned.
+    S16 encoded[2] = { Normal[0], Normal[1] };
+    F32 normal[3];
+    VertexPacking::DecodeOctahedral(encoded, normal);
+    return Vector(normal[0], normal[1], normal[2]);
+  }
+
+  inline
+  ColorRGBA
+  GetColor(
+      ) const throw ()
+  {
+    return ColorRGBA(Color[0] / 255.0f, Color[1] / 255.0f, Color[2] / 255.0f, Color[3] / 255.0f);
+  }
+
+  inline const void * GetGLVertexPointer() const throw () { return Position; }
+  inline const void * GetGLColorPointer() const throw () { return Color; }
+  inline const void * GetGLNormalPointer() const throw () { return Normal; }
+} __attribute__((packed));
+
+////////////////////////////////////////////////////////////////////////////////
+//! A vertex of a sphere stored as its octahedral unit direction plus its
+//! radius and grey level as 16-bit fractions, with radii in [0, MAX_RADIUS).
+//! The position is reconstructed as direction * radius. 8 bytes.
+////////////////////////////////////////////////////////////////////////////////
+struct VertexElevation
+{
+  static const U8 FORMAT = VertexFormat::D2S16_E2U16;
+
+  //! Largest radius stored; the color attribute's first component is the
+  //! radius divided by it.
+  static const U8 MAX_RADIUS = 2u;
+
+  S16 Direction[2];
+  //! Radius / MAX_RADIUS, then the grey level.
+  U16 Elevation[2];
+
+  //////////////////////////////////////////////////////////////////////////////
+  //! Stores the direction and length of position and the red component of
+  //! color as the grey level. The normal is not stored.
+  //////////////////////////////////////////////////////////////////////////////
+  inline
+  void
+  Set(
+      const Vector & position,
+      const Vector & /*normal*/,
+      const ColorRGBA & color
+      ) throw ()
+  {
+    S16 encoded[2];
+    VertexPacking::EncodeOctahedral(position.X, position.Y, position.Z, encoded);
+    Direction[0] = encoded[0];
+    Direction[1] = encoded[1];
+    Elevation[0] = VertexPacking::ToU16(position.Length() / (F32)MAX_RADIUS);
+    Elevation[1] = VertexPacking::ToU16(color.R);
+  }
+
+  inline
+  Vector
+  GetPosition(
+      ) const throw ()
+  {
+    // Copied out, the members being unaligned.
+    S16 encoded[2] = { Direction[0], Direction[1] };
+    F32 direction[3];
+    VertexPacking::DecodeOctahedral(encoded, direction);
+    F32 radius = Elevation[0] * ((F32)MAX_RADIUS / 65535.0f);
+    return Vector(direction[0] * radius, direction[1] * radius, direction[2] * radius);
+  }
+
+  inline
+  ColorRGBA
+  GetColor(
+      ) const throw ()
+  {
+    F32 shade = Elevation[1] / 65535.0f;
+    return ColorRGBA(shade, shade, shade, 1.0f);
+  }
+
+  inline const void * GetGLVertexPointer() const throw () { return Direction; }
+  inline const void * GetGLColorPointer() const throw () { return Elevation; }
+  inline const void * GetGLNormalPointer() const throw () { return nullptr; }
+} __attribute__((packed));
+
+/* *****************************************************************************
+ *
+ * Copyright (C) 2026 by owner of https://github.com/JDubs-S.
+ * All Rights Reserved
+ *
+ * ****************************************************************************/
@@ -18,6 +18,9 @@
  * Chagne Date        Description
  * -----------------------------------------------------------------------------
  * Aug 19, 2019 |---| added license notice
+ * Oct 19, 2026 |---| cull the map's patches against the view
+ * Oct 19, 2026 |---| pass the view matrix to the render context
+ * Oct 19, 2026 |---| draw the compact map surface with its own shader
  *
  * ****************************************************************************/
 
@@ -74,6 +77,9 @@ static F32 g_AngleY = 0.0f;
 static GLfloat g_ViewRotX = 0.0f;
 
 static GLint g_Matrix = -1;
+static GLint g_MatrixElevation = -1;
+static GLuint g_Program = 0;
+static GLuint g_ProgramElevation = 0;
 static GLint g_AttrPos = 0;
 static GLint g_AttrColor = 1;
 
@@ -144,22 +150,13 @@ static void MatrixMultiply(GLfloat *prod, const GLfloat *a, const GLfloat *b)
  * This function is a nearly verbatim copy of the create_shaders function from
  * the "OpenGL Gears" example application.
  * ****************************************************************************/
-static void CreateShaders(void)
+static GLuint CreateProgram(const char *vertShaderText, GLint *matrix)
 {
 	static const char *fragShaderText =
 	"varying vec4 v_color;\n"
 	"void main() {\n"
 	"   gl_FragColor = v_color;\n"
 	"}\n";
-	static const char *vertShaderText =
-	"uniform mat4 modelviewProjection;\n"
-	"attribute vec4 pos;\n"
-	"attribute vec4 color;\n"
-	"varying vec4 v_color;\n"
-	"void main() {\n"
-	"   gl_Position = modelviewProjection * pos;\n"
-	"   v_color = color;\n"
-	"}\n";
 
 	GLuint fragShader, vertShader, program;
 	GLint stat;
@@ -202,7 +199,49 @@ static void CreateShaders(void)
     glBindAttribLocation(program, g_AttrColor, "color");
     glLinkProgram(program);
 
-	g_Matrix = glGetUniformLocation(program, "modelviewProjection");
+	*matrix = glGetUniformLocation(program, "modelviewProjection");
+
+	return program;
+}
+
+/* *****************************************************************************
+ * Creates the program drawing Vertex arrays, and the one drawing the
+ * VertexElevation arrays of the map surface, which rebuilds each position
+ * from its octahedral direction and radius as VertexPacking does.
+ * ****************************************************************************/
+static void CreateShaders(void)
+{
+	static const char *vertShaderText =
+	"uniform mat4 modelviewProjection;\n"
+	"attribute vec4 pos;\n"
+	"attribute vec4 color;\n"
+	"varying vec4 v_color;\n"
+	"void main() {\n"
+	"   gl_Position = modelviewProjection * pos;\n"
+	"   v_color = color;\n"
+	"}\n";
+	// pos.xy is the direction, color.x the radius over
+	// VertexElevation::MAX_RADIUS (2) and color.y the grey level.
+	static const char *elevationShaderText =
+	"uniform mat4 modelviewProjection;\n"
+	"attribute vec4 pos;\n"
+	"attribute vec4 color;\n"
+	"varying vec4 v_color;\n"
+	"void main() {\n"
+	"   vec3 d = vec3(pos.xy, 1.0 - abs(pos.x) - abs(pos.y));\n"
+	"   if (d.z < 0.0) {\n"
+	"      vec2 s = vec2(pos.x < 0.0 ? -1.0 : 1.0, pos.y < 0.0 ? -1.0 : 1.0);\n"
+	"      d.xy = (1.0 - abs(pos.yx)) * s;\n"
+	"   }\n"
+	"   gl_Position = modelviewProjection * vec4(normalize(d) * (color.x * 2.0), 1.0);\n"
+	"   v_color = vec4(color.yyy, 1.0);\n"
+	"}\n";
+
+	g_ProgramElevation = CreateProgram(elevationShaderText, &g_MatrixElevation);
+	g_Program = CreateProgram(vertShaderText, &g_Matrix);
+
+	g_RC.SetProgram(VertexFormat::P4F_C4F, g_Program);
+	g_RC.SetProgram(VertexFormat::D2S16_E2U16, g_ProgramElevation);
 }
 
 /* *****************************************************************************
@@ -247,10 +286,15 @@ GLvoid DrawGLScene(void)
 	MatrixMultiply(rot, (GLfloat *)g_MatRotX.M, (GLfloat *)g_MatRotY.M);
 	MatrixMultiply(mat, rot, scale);
 
+	glUseProgram(g_ProgramElevation);
+	glUniformMatrix4fv(g_MatrixElevation, 1, GL_FALSE, mat);
+	glUseProgram(g_Program);
 	glUniformMatrix4fv(g_Matrix, 1, GL_FALSE, mat);
 
 	g_RC.Reset();
+	g_RC.SetTransform(mat);
 
+	g_MapView.SetView(mat);
 	g_MapView.Render(g_RC);
 
     glutPostRedisplay();